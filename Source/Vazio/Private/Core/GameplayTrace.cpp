@@ -0,0 +1,297 @@
+#include "Core/GameplayTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogGameplayTrace, Log, All);
+
+static const TCHAR* const GTraceCategoryNames[] =
+{
+    TEXT("Spawn"),
+    TEXT("Tick"),
+    TEXT("Move"),
+    TEXT("Overlap"),
+    TEXT("Damage"),
+    TEXT("Combat"),
+    TEXT("Drop"),
+    TEXT("Boss"),
+    TEXT("AI"),
+};
+static_assert(UE_ARRAY_COUNT(GTraceCategoryNames) == static_cast<int32>(EGameplayTraceCategory::Count), "GTraceCategoryNames fora de sincronia com EGameplayTraceCategory");
+
+const TCHAR* FGameplayTrace::GetCategoryName(EGameplayTraceCategory Category)
+{
+    const int32 Index = static_cast<int32>(Category);
+    return Index < static_cast<int32>(EGameplayTraceCategory::Count) ? GTraceCategoryNames[Index] : TEXT("?");
+}
+
+EGameplayTraceCategory FGameplayTrace::FindCategory(const FString& Name)
+{
+    for (int32 i = 0; i < static_cast<int32>(EGameplayTraceCategory::Count); ++i)
+    {
+        if (Name.Equals(GTraceCategoryNames[i], ESearchCase::IgnoreCase))
+        {
+            return static_cast<EGameplayTraceCategory>(i);
+        }
+    }
+    return EGameplayTraceCategory::Count;
+}
+
+#if VAZIO_GAMEPLAY_TRACE
+
+namespace GameplayTrace
+{
+    static constexpr int32 NumCategories = static_cast<int32>(EGameplayTraceCategory::Count);
+    static_assert((FGameplayTrace::Capacity & (FGameplayTrace::Capacity - 1)) == 0, "Capacity precisa ser potência de 2");
+
+    // Sequence = índice global + 1 quando o slot está completo, 0 enquanto está sendo escrito
+    struct FSlot
+    {
+        std::atomic<uint64> Sequence{0};
+        FGameplayTraceEvent Event;
+    };
+
+    static FSlot Slots[FGameplayTrace::Capacity];
+    static std::atomic<uint64> Head{0};
+    static std::atomic<uint64> Dropped{0};
+
+    // Limite por categoria (eventos/s, 0 = sem limite); janelas de 1s contadas sem lock
+    static std::atomic<int32> Rates[NumCategories] = { {500}, {200}, {600}, {300}, {500}, {300}, {300}, {200}, {300} };
+    static std::atomic<uint32> WindowIds[NumCategories];
+    static std::atomic<int32> WindowCounts[NumCategories];
+}
+
+static int32 GGameplayTraceMask = 0x7FFFFFFF;
+static FAutoConsoleVariableRef CVarGameplayTraceMask(
+    TEXT("Vazio.Trace.Mask"),
+    GGameplayTraceMask,
+    TEXT("Máscara de categorias gravadas no trace de gameplay (bit 0 = Spawn, 1 = Tick, 2 = Move, 3 = Overlap, 4 = Damage, 5 = Combat, 6 = Drop, 7 = Boss, 8 = AI). 0 desliga."),
+    ECVF_Default);
+
+bool FGameplayTrace::IsCategoryEnabled(EGameplayTraceCategory Category)
+{
+    return (GGameplayTraceMask & (1 << static_cast<int32>(Category))) != 0;
+}
+
+void FGameplayTrace::Record(EGameplayTraceCategory Category, const TCHAR* Name, const TCHAR* Fields, const UObject* Object,
+                            std::initializer_list<float> Values)
+{
+    using namespace GameplayTrace;
+
+    if (Category >= EGameplayTraceCategory::Count || !IsCategoryEnabled(Category))
+    {
+        return;
+    }
+
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+    const int32 CategoryIndex = static_cast<int32>(Category);
+    const int32 Rate = Rates[CategoryIndex].load(std::memory_order_relaxed);
+    if (Rate > 0)
+    {
+        const uint32 Window = static_cast<uint32>(NowCycles * FPlatformTime::GetSecondsPerCycle64());
+        uint32 CurrentWindow = WindowIds[CategoryIndex].load(std::memory_order_relaxed);
+        if (CurrentWindow != Window && WindowIds[CategoryIndex].compare_exchange_strong(CurrentWindow, Window, std::memory_order_relaxed))
+        {
+            WindowCounts[CategoryIndex].store(0, std::memory_order_relaxed);
+        }
+        if (WindowCounts[CategoryIndex].fetch_add(1, std::memory_order_relaxed) >= Rate)
+        {
+            Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    const uint64 Index = Head.fetch_add(1, std::memory_order_relaxed);
+    FSlot& Slot = Slots[Index & (Capacity - 1)];
+
+    Slot.Sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    FGameplayTraceEvent& Event = Slot.Event;
+    Event.Cycles = NowCycles;
+    Event.Frame = GFrameCounter;
+    Event.Name = Name;
+    Event.Fields = Fields;
+    Event.Object = Object ? Object->GetFName() : NAME_None;
+    Event.Category = Category;
+
+    int32 NumValues = 0;
+    for (float Value : Values)
+    {
+        if (NumValues == FGameplayTraceEvent::MaxValues)
+        {
+            break;
+        }
+        Event.Values[NumValues++] = Value;
+    }
+    Event.NumValues = static_cast<uint8>(NumValues);
+
+    Slot.Sequence.store(Index + 1, std::memory_order_release);
+}
+
+void FGameplayTrace::Snapshot(TArray<FGameplayTraceEvent>& OutEvents, double WindowSeconds)
+{
+    using namespace GameplayTrace;
+
+    OutEvents.Reset();
+
+    const uint64 End = Head.load(std::memory_order_acquire);
+    const uint64 Begin = End > static_cast<uint64>(Capacity) ? End - Capacity : 0;
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+    const uint64 WindowCycles = WindowSeconds > 0.0 ? static_cast<uint64>(WindowSeconds / FPlatformTime::GetSecondsPerCycle64()) : NowCycles;
+    const uint64 MinCycles = NowCycles > WindowCycles ? NowCycles - WindowCycles : 0;
+
+    OutEvents.Reserve(static_cast<int32>(End - Begin));
+    for (uint64 Index = Begin; Index < End; ++Index)
+    {
+        const FSlot& Slot = Slots[Index & (Capacity - 1)];
+        const uint64 Before = Slot.Sequence.load(std::memory_order_acquire);
+        if (Before != Index + 1)
+        {
+            continue; // ainda sendo escrito ou já sobrescrito
+        }
+
+        FGameplayTraceEvent Copy = Slot.Event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (Slot.Sequence.load(std::memory_order_relaxed) != Before || Copy.Cycles < MinCycles)
+        {
+            continue;
+        }
+        OutEvents.Add(Copy);
+    }
+}
+
+FString FGameplayTrace::FormatEvents(const TArray<FGameplayTraceEvent>& Events, uint64 NowCycles)
+{
+    const double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+
+    FString Text;
+    Text.Reserve(Events.Num() * 96);
+    Text += FString::Printf(TEXT("# Gameplay trace: %d events (recorded=%llu dropped=%llu) frame=%llu\n"),
+                            Events.Num(), GetNumRecorded(), GetNumDropped(), GFrameCounter);
+    Text += TEXT("# age(s) frame category event object values\n");
+
+    TArray<FString> Labels;
+    for (const FGameplayTraceEvent& Event : Events)
+    {
+        const double Age = NowCycles >= Event.Cycles ? (NowCycles - Event.Cycles) * SecondsPerCycle : 0.0;
+        Text += FString::Printf(TEXT("-%.4f %llu [%s] %s %s"), Age, Event.Frame, GetCategoryName(Event.Category),
+                                Event.Name ? Event.Name : TEXT("?"), *Event.Object.ToString());
+
+        Labels.Reset();
+        if (Event.Fields)
+        {
+            FString(Event.Fields).ParseIntoArrayWS(Labels);
+        }
+        for (int32 i = 0; i < Event.NumValues; ++i)
+        {
+            if (Labels.IsValidIndex(i))
+            {
+                Text += FString::Printf(TEXT(" %s=%.2f"), *Labels[i], Event.Values[i]);
+            }
+            else
+            {
+                Text += FString::Printf(TEXT(" %.2f"), Event.Values[i]);
+            }
+        }
+        Text += TEXT("\n");
+    }
+    return Text;
+}
+
+FString FGameplayTrace::DumpToFile(const FString& FileName, double WindowSeconds)
+{
+    TArray<FGameplayTraceEvent> Events;
+    Snapshot(Events, WindowSeconds);
+    const FString Text = FormatEvents(Events, FPlatformTime::Cycles64());
+
+    FString Path = FileName;
+    if (Path.IsEmpty())
+    {
+        Path = FString::Printf(TEXT("GameplayTrace-%s.log"), *FDateTime::Now().ToString());
+    }
+    if (FPaths::IsRelative(Path))
+    {
+        Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Traces"), Path);
+    }
+
+    if (!FFileHelper::SaveStringToFile(Text, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogGameplayTrace, Error, TEXT("Falha ao gravar trace em %s"), *Path);
+        return FString();
+    }
+
+    UE_LOG(LogGameplayTrace, Log, TEXT("Trace com %d eventos gravado em %s"), Events.Num(), *Path);
+    return Path;
+}
+
+void FGameplayTrace::SetCategoryRate(EGameplayTraceCategory Category, int32 EventsPerSecond)
+{
+    if (Category < EGameplayTraceCategory::Count)
+    {
+        GameplayTrace::Rates[static_cast<int32>(Category)].store(FMath::Max(0, EventsPerSecond), std::memory_order_relaxed);
+    }
+}
+
+uint64 FGameplayTrace::GetNumRecorded()
+{
+    return GameplayTrace::Head.load(std::memory_order_relaxed);
+}
+
+uint64 FGameplayTrace::GetNumDropped()
+{
+    return GameplayTrace::Dropped.load(std::memory_order_relaxed);
+}
+
+static FAutoConsoleCommand CmdGameplayTraceDump(
+    TEXT("Vazio.Trace.Dump"),
+    TEXT("Vazio.Trace.Dump [Arquivo] [Segundos] - grava o trace de gameplay em Saved/Traces (Segundos = janela recente, 0 = tudo)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+    {
+        const FString FileName = Args.Num() > 0 ? Args[0] : FString();
+        const double Window = Args.Num() > 1 ? FCString::Atod(*Args[1]) : 0.0;
+        FGameplayTrace::DumpToFile(FileName, Window);
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommand CmdGameplayTraceRate(
+    TEXT("Vazio.Trace.Rate"),
+    TEXT("Vazio.Trace.Rate <Categoria> <EventosPorSegundo> - limite por categoria (0 = sem limite)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+    {
+        if (Args.Num() < 2)
+        {
+            for (int32 i = 0; i < GameplayTrace::NumCategories; ++i)
+            {
+                UE_LOG(LogGameplayTrace, Log, TEXT("  %-8s %d/s"), GTraceCategoryNames[i], GameplayTrace::Rates[i].load(std::memory_order_relaxed));
+            }
+            return;
+        }
+
+        const EGameplayTraceCategory Category = FGameplayTrace::FindCategory(Args[0]);
+        if (Category == EGameplayTraceCategory::Count)
+        {
+            UE_LOG(LogGameplayTrace, Warning, TEXT("Categoria desconhecida: %s"), *Args[0]);
+            return;
+        }
+        FGameplayTrace::SetCategoryRate(Category, FCString::Atoi(*Args[1]));
+    }),
+    ECVF_Default
+);
+
+#else // !VAZIO_GAMEPLAY_TRACE
+
+bool FGameplayTrace::IsCategoryEnabled(EGameplayTraceCategory) { return false; }
+void FGameplayTrace::Record(EGameplayTraceCategory, const TCHAR*, const TCHAR*, const UObject*, std::initializer_list<float>) {}
+void FGameplayTrace::Snapshot(TArray<FGameplayTraceEvent>& OutEvents, double) { OutEvents.Reset(); }
+FString FGameplayTrace::FormatEvents(const TArray<FGameplayTraceEvent>&, uint64) { return FString(); }
+FString FGameplayTrace::DumpToFile(const FString&, double) { return FString(); }
+void FGameplayTrace::SetCategoryRate(EGameplayTraceCategory, int32) {}
+uint64 FGameplayTrace::GetNumRecorded() { return 0; }
+uint64 FGameplayTrace::GetNumDropped() { return 0; }
+
+#endif // VAZIO_GAMEPLAY_TRACE
@@ -0,0 +1,234 @@
+#include "Core/SpikeCaptureSubsystem.h"
+#include "Core/GameplayTrace.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemyBase.h"
+#include "Enemy/EnemyPoolSubsystem.h"
+#include "Enemy/EnemySimSubsystem.h"
+#include "Enemy/EnemySpawnerSubsystem.h"
+#include "Enemy/Types/BossEnemy.h"
+#include "World/Common/Collectables/XPOrb.h"
+#include "World/Common/Projectiles/RangedProjectile.h"
+#include "Algo/Reverse.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpikeCapture, Log, All);
+
+static float GSpikeThresholdMs = 50.f;
+static FAutoConsoleVariableRef CVarSpikeThreshold(
+    TEXT("Vazio.Spike.ThresholdMs"),
+    GSpikeThresholdMs,
+    TEXT("Frame mais longo que isso (ms) dispara a captura de pico. 0 desliga"),
+    ECVF_Default
+);
+
+static float GSpikeWindowSeconds = 3.f;
+static FAutoConsoleVariableRef CVarSpikeWindow(
+    TEXT("Vazio.Spike.WindowSeconds"),
+    GSpikeWindowSeconds,
+    TEXT("Janela (s) de contadores e eventos de trace gravada antes do pico"),
+    ECVF_Default
+);
+
+static float GSpikeCooldownSeconds = 10.f;
+static FAutoConsoleVariableRef CVarSpikeCooldown(
+    TEXT("Vazio.Spike.Cooldown"),
+    GSpikeCooldownSeconds,
+    TEXT("Intervalo mínimo (s) entre duas capturas automáticas"),
+    ECVF_Default
+);
+
+static int32 GSpikeMaxCaptures = 20;
+static FAutoConsoleVariableRef CVarSpikeMaxCaptures(
+    TEXT("Vazio.Spike.MaxCaptures"),
+    GSpikeMaxCaptures,
+    TEXT("Máximo de capturas automáticas por mundo"),
+    ECVF_Default
+);
+
+// Ignora os primeiros segundos do mundo (carregamento, shaders, pool enchendo)
+static constexpr float SpikeWarmupSeconds = 3.f;
+
+bool USpikeCaptureSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if VAZIO_GAMEPLAY_TRACE
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+#else
+    return false;
+#endif
+}
+
+TStatId USpikeCaptureSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USpikeCaptureSubsystem, STATGROUP_Tickables);
+}
+
+void USpikeCaptureSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const double Now = FPlatformTime::Seconds();
+    const bool bSkippedFrames = GFrameCounter > LastTickFrame + 1;
+    LastTickFrame = GFrameCounter;
+    if (LastFrameSeconds <= 0.0)
+    {
+        LastFrameSeconds = Now;
+        History.SetNumZeroed(HistorySize);
+        return;
+    }
+
+    // Sem tick nos frames anteriores = mundo pausado; o intervalo é tempo parado, não um pico
+    if (bSkippedFrames)
+    {
+        LastFrameSeconds = Now;
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    FFrameCounters& Counters = History[HistoryHead];
+    Counters.Frame = GFrameCounter;
+    Counters.FrameMs = static_cast<float>((Now - LastFrameSeconds) * 1000.0);
+    Counters.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+    const UEnemySimSubsystem* Sim = World->GetSubsystem<UEnemySimSubsystem>();
+    const UEnemyPoolSubsystem* Pool = World->GetSubsystem<UEnemyPoolSubsystem>();
+    const UEnemySpawnerSubsystem* Spawner = World->GetSubsystem<UEnemySpawnerSubsystem>();
+    Counters.Enemies = Sim ? Sim->GetNumSimulated() : 0;
+    Counters.PoolActive = Pool ? Pool->GetNumActive() : 0;
+    Counters.PendingSpawns = Spawner ? Spawner->GetNumPendingDeferredSpawns() : 0;
+    HistoryHead = (HistoryHead + 1) & (HistorySize - 1);
+    HistoryCount = FMath::Min(HistoryCount + 1, HistorySize);
+    LastFrameSeconds = Now;
+
+    if (GSpikeThresholdMs > 0.f && Counters.FrameMs >= GSpikeThresholdMs
+        && World->GetTimeSeconds() >= SpikeWarmupSeconds
+        && Now - LastCaptureSeconds >= GSpikeCooldownSeconds
+        && NumCaptures < GSpikeMaxCaptures)
+    {
+        Capture(Counters.FrameMs, TEXT("threshold"));
+    }
+}
+
+void USpikeCaptureSubsystem::Capture(float FrameMs, const TCHAR* Reason)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    LastCaptureSeconds = FPlatformTime::Seconds();
+    ++NumCaptures;
+
+    // No game thread só copiamos dados; o texto é montado na thread pool
+    const double Window = FMath::Max(0.5f, GSpikeWindowSeconds);
+    TArray<FGameplayTraceEvent> Events;
+    FGameplayTrace::Snapshot(Events, Window);
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+
+    TArray<FFrameCounters> Rows;
+    double Covered = 0.0;
+    for (int32 i = 1; i <= HistoryCount && Covered < Window * 1000.0; ++i)
+    {
+        const FFrameCounters& Row = History[(HistoryHead - i) & (HistorySize - 1)];
+        Rows.Add(Row);
+        Covered += Row.FrameMs;
+    }
+    Algo::Reverse(Rows);
+
+    FString Header = FString::Printf(TEXT("# Frame spike (%s): %.2f ms, limiar %.1f ms, frame %llu, %s\n"),
+        Reason, FrameMs, GSpikeThresholdMs, GFrameCounter, *FDateTime::Now().ToString());
+    Header += FString::Printf(TEXT("# Mapa %s, tempo de jogo %.2fs\n"), *World->GetMapName(), World->GetTimeSeconds());
+
+    if (const UEnemySpawnerSubsystem* Spawner = World->GetSubsystem<UEnemySpawnerSubsystem>())
+    {
+        const ABossEnemy* Boss = Spawner->GetActiveBoss();
+        Header += FString::Printf(TEXT("# Timeline t=%.2fs, fila de spawn %d (+%d eventos retidos), boss %s\n"),
+            Spawner->GetTimelineTime(), Spawner->GetNumPendingDeferredSpawns(), Spawner->GetNumDeferredEvents(),
+            Boss ? *FString::Printf(TEXT("%s fase %d"), *Boss->GetClass()->GetName(), Boss->GetCurrentPhaseIndex()) : TEXT("nenhum"));
+    }
+
+    // Contagens ao vivo: caras, mas só rodam no pico
+    TMap<FName, int32> EnemiesPerClass;
+    int32 Actors = 0, Orbs = 0, Projectiles = 0;
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        ++Actors;
+        if (It->IsA<AEnemyBase>())
+        {
+            if (!It->IsHidden())
+            {
+                ++EnemiesPerClass.FindOrAdd(It->GetClass()->GetFName());
+            }
+        }
+        else if (It->IsA<AXPOrb>())
+        {
+            ++Orbs;
+        }
+        else if (It->IsA<ARangedProjectile>())
+        {
+            ++Projectiles;
+        }
+    }
+    EnemiesPerClass.ValueSort(TGreater<int32>());
+    Header += FString::Printf(TEXT("# Atores %d, orbs %d, projéteis %d, inimigos:"), Actors, Orbs, Projectiles);
+    for (const TPair<FName, int32>& Pair : EnemiesPerClass)
+    {
+        Header += FString::Printf(TEXT(" %s=%d"), *Pair.Key.ToString(), Pair.Value);
+    }
+    Header += TEXT("\n");
+
+    TArray<FVazioStatTime> Times;
+    GetVazioStatTimes(Times);
+    if (Times.Num() > 0)
+    {
+        Times.Sort([](const FVazioStatTime& A, const FVazioStatTime& B) { return A.Milliseconds > B.Milliseconds; });
+        Header += TEXT("# stat Vazio (último frame processado):");
+        for (const FVazioStatTime& Time : Times)
+        {
+            Header += FString::Printf(TEXT(" %s=%.2fms"), *Time.Name.ToString(), Time.Milliseconds);
+        }
+        Header += TEXT("\n");
+    }
+    else
+    {
+        Header += TEXT("# stat Vazio inativo (use 'stat Vazio -nodisplay' para incluir custo por sistema)\n");
+    }
+
+    const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Spikes"),
+        FString::Printf(TEXT("Spike-%s-%llu.log"), *FDateTime::Now().ToString(), GFrameCounter));
+
+    UE_LOG(LogSpikeCapture, Warning, TEXT("Pico de %.1fms capturado -> %s"), FrameMs, *Path);
+
+    Async(EAsyncExecution::ThreadPool, [Header = MoveTemp(Header), Rows = MoveTemp(Rows), Events = MoveTemp(Events), NowCycles, Path]()
+    {
+        FString Text = Header;
+        Text += TEXT("\n# Contadores por frame: frame frame_ms game_ms enemies pool_active pending_spawns\n");
+        for (const FFrameCounters& Row : Rows)
+        {
+            Text += FString::Printf(TEXT("%llu %.2f %.2f %d %d %d\n"), Row.Frame, Row.FrameMs, Row.GameThreadMs,
+                                    Row.Enemies, Row.PoolActive, Row.PendingSpawns);
+        }
+        Text += TEXT("\n");
+        Text += FGameplayTrace::FormatEvents(Events, NowCycles);
+        FFileHelper::SaveStringToFile(Text, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    });
+}
+
+static FAutoConsoleCommandWithWorld CmdSpikeCapture(
+    TEXT("Vazio.Spike.Capture"),
+    TEXT("Vazio.Spike.Capture - grava agora a janela recente como se fosse um pico"),
+    FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+    {
+        if (USpikeCaptureSubsystem* Spikes = World ? World->GetSubsystem<USpikeCaptureSubsystem>() : nullptr)
+        {
+            Spikes->Capture(0.f, TEXT("manual"));
+        }
+    }),
+    ECVF_Default
+);
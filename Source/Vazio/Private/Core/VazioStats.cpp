@@ -0,0 +1,97 @@
+#include "Core/VazioStats.h"
+#if STATS
+#include "Stats/StatsData.h"
+#endif
+
+DEFINE_STAT(STAT_VazioSpawnEvents);
+DEFINE_STAT(STAT_VazioSpawnActor);
+DEFINE_STAT(STAT_VazioDeferredSpawns);
+DEFINE_STAT(STAT_VazioSpawnEventsPerFrame);
+DEFINE_STAT(STAT_VazioEnemiesSpawned);
+DEFINE_STAT(STAT_VazioDeferredQueue);
+
+DEFINE_STAT(STAT_VazioPoolAcquire);
+DEFINE_STAT(STAT_VazioPoolRelease);
+DEFINE_STAT(STAT_VazioPoolHits);
+DEFINE_STAT(STAT_VazioPoolMisses);
+DEFINE_STAT(STAT_VazioPoolActive);
+DEFINE_STAT(STAT_VazioPoolHighWater);
+
+DEFINE_STAT(STAT_VazioHordeSim);
+DEFINE_STAT(STAT_VazioDecisions);
+DEFINE_STAT(STAT_VazioCooldowns);
+DEFINE_STAT(STAT_VazioChase);
+DEFINE_STAT(STAT_VazioLiveEnemies);
+DEFINE_STAT(STAT_VazioDecisionsPerFrame);
+
+DEFINE_STAT(STAT_VazioTickNormal);
+DEFINE_STAT(STAT_VazioTickHeavy);
+DEFINE_STAT(STAT_VazioTickRanged);
+DEFINE_STAT(STAT_VazioTickDash);
+DEFINE_STAT(STAT_VazioTickAura);
+DEFINE_STAT(STAT_VazioTickSplitter);
+DEFINE_STAT(STAT_VazioTickGold);
+DEFINE_STAT(STAT_VazioTickBoss);
+
+DEFINE_STAT(STAT_VazioEnemyDamage);
+DEFINE_STAT(STAT_VazioStatusEffects);
+DEFINE_STAT(STAT_VazioAuras);
+DEFINE_STAT(STAT_VazioPlayerAttack);
+DEFINE_STAT(STAT_VazioDamageEvents);
+DEFINE_STAT(STAT_VazioDeaths);
+
+DEFINE_STAT(STAT_VazioDrops);
+DEFINE_STAT(STAT_VazioXPOrbTick);
+DEFINE_STAT(STAT_VazioXPOrbsSpawned);
+
+DEFINE_STAT(STAT_VazioBossEncounter);
+DEFINE_STAT(STAT_VazioBossSyncLoads);
+DEFINE_STAT(STAT_VazioBossBullets);
+DEFINE_STAT(STAT_VazioBossBulletsLive);
+DEFINE_STAT(STAT_VazioBossMinions);
+DEFINE_STAT(STAT_VazioBossMinionsDenied);
+
+DEFINE_STAT(STAT_VazioHUDUpdate);
+DEFINE_STAT(STAT_VazioHUDUpdates);
+DEFINE_STAT(STAT_VazioHUDCoalesced);
+
+DEFINE_STAT(STAT_VazioWorldThaw);
+
+void GetVazioStatTimes(TArray<FVazioStatTime>& OutTimes)
+{
+    OutTimes.Reset();
+#if STATS
+    const FGameThreadStatsData* Data = FLatestGameThreadStatsData::Get().Latest;
+    if (!Data)
+    {
+        return;
+    }
+
+    for (int32 GroupIndex = 0; GroupIndex < Data->GroupNames.Num(); ++GroupIndex)
+    {
+        if (!Data->GroupNames[GroupIndex].ToString().Contains(TEXT("STATGROUP_Vazio")) || !Data->ActiveStatGroups.IsValidIndex(GroupIndex))
+        {
+            continue;
+        }
+
+        for (const FComplexStatMessage& Item : Data->ActiveStatGroups[GroupIndex].FlatAggregate)
+        {
+            FVazioStatTime& Time = OutTimes.AddDefaulted_GetRef();
+            Time.Name = Item.GetShortName();
+            Time.Description = Item.GetDescription();
+            Time.Milliseconds = FPlatformTime::ToMilliseconds(Item.GetValue_Duration(EComplexStatField::IncAve));
+        }
+    }
+#endif
+}
+
+float GetVazioPercentile(TArray<float> Values, float P)
+{
+    if (Values.Num() == 0)
+    {
+        return 0.f;
+    }
+    Values.Sort();
+    const int32 Index = FMath::Clamp(FMath::CeilToInt(P * Values.Num()) - 1, 0, Values.Num() - 1);
+    return Values[Index];
+}
@@ -0,0 +1,145 @@
+#include "Core/WorldFreezeSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemyBase.h"
+#include "Enemy/EnemySimSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogWorldFreeze, Log, All);
+
+static int32 GFreezeStaggerResume = 1;
+static FAutoConsoleVariableRef CVarFreezeStaggerResume(
+    TEXT("Vazio.Freeze.StaggerResume"),
+    GFreezeStaggerResume,
+    TEXT("Ao sair da pausa, espalha o próximo tick dos inimigos com TickInterval pelo intervalo (1) ou deixa todos vencerem juntos (0)"),
+    ECVF_Default
+);
+
+bool UWorldFreezeSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UWorldFreezeSubsystem::Deinitialize()
+{
+    Reasons = EWorldFreezeReason::None;
+    Super::Deinitialize();
+}
+
+void UWorldFreezeSubsystem::Freeze(EWorldFreezeReason Reason)
+{
+    if (Reason == EWorldFreezeReason::None || EnumHasAllFlags(Reasons, Reason))
+    {
+        return;
+    }
+
+    const bool bWasFrozen = IsFrozen();
+    Reasons |= Reason;
+    if (!bWasFrozen)
+    {
+        EnterFreeze();
+    }
+}
+
+void UWorldFreezeSubsystem::Thaw(EWorldFreezeReason Reason)
+{
+    if (!EnumHasAnyFlags(Reasons, Reason))
+    {
+        return;
+    }
+
+    Reasons &= ~Reason;
+    if (!IsFrozen())
+    {
+        ExitFreeze();
+    }
+}
+
+void UWorldFreezeSubsystem::ThawAll()
+{
+    if (IsFrozen())
+    {
+        Reasons = EWorldFreezeReason::None;
+        ExitFreeze();
+    }
+}
+
+double UWorldFreezeSubsystem::GetTotalFrozenSeconds() const
+{
+    return TotalFrozenSeconds + (IsFrozen() ? FPlatformTime::Seconds() - FrozenAtSeconds : 0.0);
+}
+
+void UWorldFreezeSubsystem::EnterFreeze()
+{
+    UWorld* World = GetWorld();
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    AGameModeBase* GameMode = World ? World->GetAuthGameMode() : nullptr;
+    if (GameMode && PC)
+    {
+        GameMode->SetPause(PC);
+    }
+
+    FrozenAtSeconds = FPlatformTime::Seconds();
+    UE_LOG(LogWorldFreeze, Log, TEXT("World frozen (reasons=0x%02x)"), static_cast<uint8>(Reasons));
+}
+
+void UWorldFreezeSubsystem::ExitFreeze()
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioWorldThaw);
+
+    const double FrozenFor = FPlatformTime::Seconds() - FrozenAtSeconds;
+    TotalFrozenSeconds += FrozenFor;
+
+    // Ainda pausado: a nova fase vale a partir do primeiro frame rodando
+    if (GFreezeStaggerResume)
+    {
+        StaggerThrottledTicks();
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (AGameModeBase* GameMode = World->GetAuthGameMode())
+        {
+            GameMode->ClearPause();
+        }
+    }
+
+    UE_LOG(LogWorldFreeze, Log, TEXT("World resumed after %.1fs"), FrozenFor);
+}
+
+void UWorldFreezeSubsystem::StaggerThrottledTicks()
+{
+    UWorld* World = GetWorld();
+    const UEnemySimSubsystem* Sim = World ? World->GetSubsystem<UEnemySimSubsystem>() : nullptr;
+    if (!Sim)
+    {
+        return;
+    }
+
+    // Sequência de razão áurea: fases bem distribuídas em [0,1) sem depender de quantos são.
+    // PerformanceOptimization reescreve o TickInterval no próprio tick, então só o primeiro muda.
+    int32 NumStaggered = 0;
+    for (AEnemyBase* Enemy : Sim->GetEnemies())
+    {
+        if (!IsValid(Enemy))
+        {
+            continue;
+        }
+
+        FActorTickFunction& TickFunction = Enemy->PrimaryActorTick;
+        const float Interval = TickFunction.TickInterval;
+        if (Interval <= 0.f || !TickFunction.IsTickFunctionRegistered() || !TickFunction.IsTickFunctionEnabled())
+        {
+            continue;
+        }
+
+        const float Phase = FMath::Frac(static_cast<float>(NumStaggered + 1) * 0.618034f);
+        TickFunction.UpdateTickIntervalAndCoolDown(FMath::Max(Interval * Phase, KINDA_SMALL_NUMBER));
+        ++NumStaggered;
+    }
+
+    UE_LOG(LogWorldFreeze, Verbose, TEXT("Staggered %d throttled enemy ticks"), NumStaggered);
+}
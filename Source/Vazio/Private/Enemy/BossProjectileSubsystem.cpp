@@ -0,0 +1,388 @@
+#include "Enemy/BossProjectileSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemySpawnerSubsystem.h"
+#include "Enemy/Types/BossEnemy.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/DamageEvents.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+
+static TAutoConsoleVariable<int32> CVarBossBulletsMax(
+    TEXT("Enemy.BossBullets.Max"),
+    4096,
+    TEXT("Máximo de projéteis de boss vivos; rajadas além do teto são descartadas."),
+    ECVF_Default);
+
+void UBossProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Positions.Reserve(2048);
+    Velocities.Reserve(2048);
+    LifeRemaining.Reserve(2048);
+    Damages.Reserve(2048);
+    Radii.Reserve(2048);
+    Sources.Reserve(2048);
+    InstanceScratch.Reserve(2048);
+}
+
+void UBossProjectileSubsystem::Deinitialize()
+{
+    ClearAll();
+    RenderActor = nullptr;
+    Instances = nullptr;
+
+    Super::Deinitialize();
+}
+
+void UBossProjectileSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Mesh carregada no início da fase, não na primeira barragem do encontro
+    EnsureRenderer();
+}
+
+TStatId UBossProjectileSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBossProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void UBossProjectileSubsystem::EnsureRenderer()
+{
+    UWorld* World = GetWorld();
+    if (Instances || !World || !World->IsGameWorld())
+    {
+        return;
+    }
+
+    UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+    if (!Mesh)
+    {
+        UE_LOG(LogBoss, Warning, TEXT("BossProjectileSubsystem: sphere mesh not found, bullets will not render"));
+        return;
+    }
+
+    FActorSpawnParameters Params;
+    Params.ObjectFlags |= RF_Transient;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    RenderActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+    if (!RenderActor)
+    {
+        return;
+    }
+
+    Instances = NewObject<UInstancedStaticMeshComponent>(RenderActor, TEXT("BossBullets"));
+    Instances->SetMobility(EComponentMobility::Movable);
+    Instances->SetStaticMesh(Mesh);
+    Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Instances->SetGenerateOverlapEvents(false);
+    Instances->SetCastShadow(false);
+    RenderActor->SetRootComponent(Instances);
+    RenderActor->AddInstanceComponent(Instances);
+    Instances->RegisterComponent();
+}
+
+void UBossProjectileSubsystem::Emit(AActor* Source, const FBossBulletEmitter& Emitter)
+{
+    if (!Source || Emitter.Count <= 0)
+    {
+        return;
+    }
+
+    EnsureRenderer();
+
+    FPendingVolley Volley;
+    Volley.Source = Source;
+    Volley.Emitter = MakeShared<const FBossBulletEmitter>(Emitter);
+    Volley.AimDirection = Source->GetActorForwardVector();
+    if (Emitter.bAimAtPlayer || Emitter.Shape == EBossBulletShape::AimedBurst)
+    {
+        if (const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
+        {
+            Volley.AimDirection = Player->GetActorLocation() - Source->GetActorLocation();
+        }
+    }
+
+    FireVolley(Volley);
+
+    if (Emitter.Volleys > 1)
+    {
+        Volley.VolleyIndex = 1;
+        Volley.TimeUntilNext = FMath::Max(0.01f, Emitter.VolleyInterval);
+        PendingVolleys.Add(MoveTemp(Volley));
+    }
+}
+
+void UBossProjectileSubsystem::CancelEmitters(const AActor* Source)
+{
+    for (int32 i = PendingVolleys.Num() - 1; i >= 0; --i)
+    {
+        if (PendingVolleys[i].Source.Get() == Source)
+        {
+            PendingVolleys.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+    }
+}
+
+void UBossProjectileSubsystem::ClearAll()
+{
+    PendingVolleys.Reset();
+    Positions.Reset();
+    Velocities.Reset();
+    LifeRemaining.Reset();
+    Damages.Reset();
+    Radii.Reset();
+    Sources.Reset();
+    UpdateInstances();
+    SET_DWORD_STAT(STAT_VazioBossBulletsLive, 0);
+}
+
+void UBossProjectileSubsystem::FireVolley(FPendingVolley& Volley)
+{
+    AActor* Source = Volley.Source.Get();
+    if (!Source)
+    {
+        return;
+    }
+
+    const FBossBulletEmitter& Emitter = *Volley.Emitter;
+    const FVector Origin = Source->GetActorLocation();
+    const int32 Count = FMath::Max(1, Emitter.Count);
+    const float Speed = FMath::Max(0.f, Emitter.Speed + Emitter.SpeedPerVolley * Volley.VolleyIndex);
+
+    // Rajada mirada acompanha o jogador a cada disparo
+    if (Emitter.Shape == EBossBulletShape::AimedBurst && Volley.VolleyIndex > 0)
+    {
+        if (const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
+        {
+            Volley.AimDirection = Player->GetActorLocation() - Origin;
+        }
+    }
+
+    const float BaseYaw = Volley.AimDirection.GetSafeNormal2D().Rotation().Yaw + Emitter.AngleOffset;
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        float Yaw = BaseYaw;
+        switch (Emitter.Shape)
+        {
+        case EBossBulletShape::Ring:
+            Yaw += 360.f * i / Count;
+            break;
+        case EBossBulletShape::Spiral:
+            Yaw += 360.f * i / Count + Emitter.SpinPerVolley * Volley.VolleyIndex;
+            break;
+        case EBossBulletShape::Fan:
+            Yaw += Count > 1 ? Emitter.SpreadDegrees * (static_cast<float>(i) / (Count - 1) - 0.5f) : 0.f;
+            break;
+        case EBossBulletShape::AimedBurst:
+            Yaw += FMath::FRandRange(-0.5f, 0.5f) * Emitter.SpreadDegrees;
+            break;
+        }
+
+        const FVector Direction = FRotator(0.f, Yaw, 0.f).Vector();
+        AddProjectile(Origin, Direction * Speed, Emitter, Source);
+    }
+}
+
+void UBossProjectileSubsystem::AddProjectile(const FVector& Location, const FVector& Velocity, const FBossBulletEmitter& Emitter, AActor* Source)
+{
+    if (Positions.Num() >= CVarBossBulletsMax.GetValueOnGameThread())
+    {
+        UE_LOG(LogBoss, VeryVerbose, TEXT("Boss bullet cap reached (%d), dropping projectile"), Positions.Num());
+        return;
+    }
+
+    Positions.Add(Location);
+    Velocities.Add(Velocity);
+    LifeRemaining.Add(FMath::Max(0.1f, Emitter.LifeSeconds));
+    Damages.Add(Emitter.Damage);
+    Radii.Add(FMath::Max(1.f, Emitter.Radius));
+    Sources.Add(Source);
+}
+
+void UBossProjectileSubsystem::RemoveProjectile(int32 Index)
+{
+    Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    LifeRemaining.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Damages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Sources.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UBossProjectileSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioBossBullets);
+    Super::Tick(DeltaTime);
+
+    for (int32 i = PendingVolleys.Num() - 1; i >= 0; --i)
+    {
+        FPendingVolley& Volley = PendingVolleys[i];
+        const FBossBulletEmitter& Emitter = *Volley.Emitter;
+
+        Volley.TimeUntilNext -= DeltaTime;
+        while (Volley.TimeUntilNext <= 0.f && Volley.VolleyIndex < Emitter.Volleys && Volley.Source.IsValid())
+        {
+            FireVolley(Volley);
+            ++Volley.VolleyIndex;
+            Volley.TimeUntilNext += FMath::Max(0.01f, Emitter.VolleyInterval);
+        }
+
+        if (Volley.VolleyIndex >= Emitter.Volleys || !Volley.Source.IsValid())
+        {
+            PendingVolleys.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+    }
+
+    if (Positions.Num() > 0)
+    {
+        Simulate(DeltaTime);
+    }
+    UpdateInstances();
+
+    SET_DWORD_STAT(STAT_VazioBossBulletsLive, Positions.Num());
+}
+
+void UBossProjectileSubsystem::Simulate(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    struct FTarget
+    {
+        APawn* Pawn = nullptr;
+        FVector Location = FVector::ZeroVector;
+        float Radius = 0.f;
+        float Damage = 0.f;
+        AActor* Causer = nullptr;
+    };
+    TArray<FTarget, TInlineAllocator<4>> Targets;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (APawn* Pawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+        {
+            FTarget& Target = Targets.AddDefaulted_GetRef();
+            Target.Pawn = Pawn;
+            Target.Location = Pawn->GetActorLocation();
+            Target.Radius = Pawn->GetSimpleCollisionRadius();
+        }
+    }
+
+    // De trás para frente: RemoveAtSwap traz um projétil que já foi processado
+    for (int32 i = Positions.Num() - 1; i >= 0; --i)
+    {
+        LifeRemaining[i] -= DeltaTime;
+        if (LifeRemaining[i] <= 0.f)
+        {
+            RemoveProjectile(i);
+            continue;
+        }
+
+        Positions[i] += Velocities[i] * DeltaTime;
+
+        for (FTarget& Target : Targets)
+        {
+            const float Reach = Radii[i] + Target.Radius;
+            if (FVector::DistSquaredXY(Positions[i], Target.Location) <= Reach * Reach)
+            {
+                Target.Damage += Damages[i];
+                Target.Causer = Sources[i].Get();
+                RemoveProjectile(i);
+                break;
+            }
+        }
+    }
+
+    for (const FTarget& Target : Targets)
+    {
+        if (Target.Damage > 0.f)
+        {
+            FDamageEvent DamageEvent;
+            Target.Pawn->TakeDamage(Target.Damage, DamageEvent, nullptr, Target.Causer);
+        }
+    }
+}
+
+void UBossProjectileSubsystem::UpdateInstances()
+{
+    if (!Instances)
+    {
+        return;
+    }
+
+    const int32 Live = Positions.Num();
+    const int32 Current = Instances->GetInstanceCount();
+    if (Live == 0)
+    {
+        if (Current > 0)
+        {
+            Instances->ClearInstances();
+        }
+        return;
+    }
+
+    // Cresce até o pico da barragem e esconde o excedente com escala zero (sem remover instâncias)
+    if (Live > Current)
+    {
+        InstanceScratch.Reset();
+        InstanceScratch.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), Live - Current);
+        Instances->AddInstances(InstanceScratch, false, false);
+    }
+
+    const int32 NumInstances = FMath::Max(Live, Current);
+    InstanceScratch.SetNumUninitialized(NumInstances, EAllowShrinking::No);
+    for (int32 i = 0; i < Live; ++i)
+    {
+        // Esfera básica tem 100uu de diâmetro
+        InstanceScratch[i] = FTransform(FQuat::Identity, Positions[i], FVector(Radii[i] / 50.f));
+    }
+    for (int32 i = Live; i < NumInstances; ++i)
+    {
+        InstanceScratch[i] = FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+    }
+
+    Instances->BatchUpdateInstancesTransforms(0, InstanceScratch, false, true, true);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyBossBulletsTest(
+    TEXT("Enemy.BossBullets.Test"),
+    TEXT("Enemy.BossBullets.Test [Ring|Spiral|Fan|AimedBurst] [Count=100] [Volleys=20] - barragem de teste a partir do boss ativo"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        UBossProjectileSubsystem* Bullets = World ? World->GetSubsystem<UBossProjectileSubsystem>() : nullptr;
+        UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr;
+        ABossEnemy* Boss = Spawner ? Spawner->GetActiveBoss() : nullptr;
+        if (!Bullets || !Boss)
+        {
+            UE_LOG(LogBoss, Warning, TEXT("Enemy.BossBullets.Test: no active boss"));
+            return;
+        }
+
+        FBossBulletEmitter Emitter;
+        Emitter.Shape = EBossBulletShape::Spiral;
+        if (Args.Num() > 0)
+        {
+            const int64 Value = StaticEnum<EBossBulletShape>()->GetValueByNameString(Args[0]);
+            if (Value != INDEX_NONE)
+            {
+                Emitter.Shape = static_cast<EBossBulletShape>(Value);
+            }
+        }
+        Emitter.Count = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100;
+        Emitter.Volleys = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 20;
+        Emitter.VolleyInterval = 0.2f;
+        Emitter.bAimAtPlayer = true;
+        Emitter.Damage = 0.f;
+        Emitter.LifeSeconds = 6.f;
+        Bullets->Emit(Boss, Emitter);
+    }),
+    ECVF_Default
+);
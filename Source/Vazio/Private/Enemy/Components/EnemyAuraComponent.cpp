@@ -1,36 +1,39 @@
 #include "Enemy/Components/EnemyAuraComponent.h"
+#include "Enemy/EnemyAuraSubsystem.h"
 #include "Engine/World.h"
-#include "Kismet/GameplayStatics.h"
-#include "Components/SphereComponent.h"
-#include "GameFramework/Pawn.h"
-#include "Engine/OverlapResult.h"
 #include "Enemy/EnemyTypes.h"
 
 UEnemyAuraComponent::UEnemyAuraComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.TickInterval = 0.1f; // Tick 10 times per second for performance
+    // Sem tick: UEnemyAuraSubsystem processa todas as auras de uma vez
+    PrimaryComponentTick.bCanEverTick = false;
     
     Radius = 400.f;
     DPS = 5.f;
     bAuraActive = true;
-    DamageTickRate = 0.5f;
-    DamageAccumulator = 0.f;
 }
 
 void UEnemyAuraComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (bAuraActive)
+    {
+        if (UEnemyAuraSubsystem* Auras = GetWorld() ? GetWorld()->GetSubsystem<UEnemyAuraSubsystem>() : nullptr)
+        {
+            Auras->RegisterEmitter(this);
+        }
+    }
 }
 
-void UEnemyAuraComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UEnemyAuraComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    
-    if (bAuraActive)
+    if (UEnemyAuraSubsystem* Auras = GetWorld() ? GetWorld()->GetSubsystem<UEnemyAuraSubsystem>() : nullptr)
     {
-        DealAuraDamage(DeltaTime);
+        Auras->UnregisterEmitter(this);
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UEnemyAuraComponent::SetAuraProperties(float NewRadius, float NewDPS)
@@ -41,71 +44,22 @@ void UEnemyAuraComponent::SetAuraProperties(float NewRadius, float NewDPS)
     UE_LOG(LogEnemy, VeryVerbose, TEXT("Aura component configured: Radius=%.1f, DPS=%.1f"), Radius, DPS);
 }
 
-void UEnemyAuraComponent::DealAuraDamage(float DeltaTime)
+void UEnemyAuraComponent::SetAuraActive(bool bActive)
 {
-    DamageAccumulator += DeltaTime;
-    
-    if (DamageAccumulator >= DamageTickRate)
+    bAuraActive = bActive;
+
+    UEnemyAuraSubsystem* Auras = GetWorld() ? GetWorld()->GetSubsystem<UEnemyAuraSubsystem>() : nullptr;
+    if (!Auras || !HasBegunPlay())
     {
-        float DamageThisTick = DPS * DamageAccumulator;
-        DamageAccumulator = 0.f;
-        
-        TArray<AActor*> TargetsInRadius;
-        FindTargetsInRadius(TargetsInRadius);
-        
-        for (AActor* Target : TargetsInRadius)
-        {
-            if (APawn* TargetPawn = Cast<APawn>(Target))
-            {
-                // Check if it's a player pawn
-                if (TargetPawn->IsPlayerControlled())
-                {
-                    // Deal damage to player
-                    // This would depend on your damage system implementation
-                    UE_LOG(LogEnemy, VeryVerbose, TEXT("Aura dealing %.1f damage to %s"), DamageThisTick, *TargetPawn->GetName());
-                    
-                    // Example: if you have a health component system
-                    // if (UHealthComponent* HealthComp = TargetPawn->FindComponentByClass<UHealthComponent>())
-                    // {
-                    //     HealthComp->TakeDamage(DamageThisTick);
-                    // }
-                }
-            }
-        }
+        return; // BeginPlay registra se necessário
     }
-}
 
-void UEnemyAuraComponent::FindTargetsInRadius(TArray<AActor*>& OutTargets)
-{
-    if (!GetOwner())
+    if (bActive)
     {
-        return;
+        Auras->RegisterEmitter(this);
     }
-    
-    FVector OwnerLocation = GetOwner()->GetActorLocation();
-    
-    // Use overlap sphere to find targets
-    TArray<FOverlapResult> OverlapResults;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(GetOwner());
-    
-    bool bHasOverlaps = GetWorld()->OverlapMultiByChannel(
-        OverlapResults,
-        OwnerLocation,
-        FQuat::Identity,
-        ECC_Pawn,
-        FCollisionShape::MakeSphere(Radius),
-        QueryParams
-    );
-    
-    if (bHasOverlaps)
+    else
     {
-        for (const FOverlapResult& Result : OverlapResults)
-        {
-            if (Result.GetActor() && Result.GetActor()->IsA<APawn>())
-            {
-                OutTargets.Add(Result.GetActor());
-            }
-        }
+        Auras->UnregisterEmitter(this);
     }
 }
@@ -1,8 +1,10 @@
 #include "Enemy/Components/EnemyDropComponent.h"
+#include "Core/VazioStats.h"
 #include "Enemy/EnemyBase.h"
 #include "Enemy/Types/BossEnemy.h"
 #include "World/Common/Collectables/XPOrb.h"
 #include "Economy/GameEconomyService.h"
+#include "Core/GameplayTrace.h"
 #include "Engine/World.h"
 
 UEnemyDropComponent::UEnemyDropComponent()
@@ -27,6 +29,8 @@ void UEnemyDropComponent::DropOnDeath(const AEnemyBase* Enemy, const FEnemyArche
     
     // Calculate and spawn XP orbs
     int32 XPAmount = CalculateXPDrop(Arch, Mods, bIsParent);
+    UE_LOG(LogTemp, Log, TEXT("[XP-CALC] Enemy XP: Base=%d, HP=%.0f, Parent=%s, Final=%d"), 
+        Arch.BaseRewards.XPValue, Arch.BaseHP, bIsParent ? TEXT("YES") : TEXT("NO"), XPAmount);
     if (XPAmount > 0)
     {
         SpawnXPOrbs(XPAmount, DropLocation);
@@ -42,23 +46,18 @@ void UEnemyDropComponent::DropOnDeath(const AEnemyBase* Enemy, const FEnemyArche
 
 void UEnemyDropComponent::SpawnXPOrbs(int32 TotalXP, const FVector& Location)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioDrops);
+
     if (TotalXP <= 0 || !GetWorld())
     {
         return;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("[XP-DROP] Spawning %d XP orbs at location %s"), TotalXP, *Location.ToString());
+    VAZIO_TRACE(Drop, "XP-DROP", "XP X Y", GetOwner(), TotalXP, Location.X, Location.Y);
     
     // Determine how many orbs to spawn based on total XP
-    int32 NumOrbs = 1;
-    int32 XPPerOrb = TotalXP;
-    
-    // Split XP into multiple orbs if amount is large
-    if (TotalXP > 50)
-    {
-        NumOrbs = FMath::Min(5, TotalXP / 10); // Max 5 orbs, min 10 XP per orb
-        XPPerOrb = TotalXP / NumOrbs;
-    }
+    const int32 NumOrbs = GetXPOrbCount(TotalXP);
+    const int32 XPPerOrb = TotalXP / NumOrbs;
     
     // Spawn the XP orbs in a small circle around the drop location
     for (int32 i = 0; i < NumOrbs; i++)
@@ -76,13 +75,12 @@ void UEnemyDropComponent::SpawnXPOrbs(int32 TotalXP, const FVector& Location)
         FActorSpawnParameters SpawnParams;
         SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
         
-        UE_LOG(LogTemp, Warning, TEXT("[XP-DROP] Attempting to spawn XPOrb at %s"), *SpawnLocation.ToString());
-        
         AXPOrb* XPOrb = GetWorld()->SpawnActor<AXPOrb>(AXPOrb::StaticClass(), SpawnLocation, FRotator::ZeroRotator, SpawnParams);
         if (XPOrb && IsValid(XPOrb))
         {
+            INC_DWORD_STAT(STAT_VazioXPOrbsSpawned);
             XPOrb->XPAmount = XPPerOrb + (i < (TotalXP % NumOrbs) ? 1 : 0); // Distribute remainder evenly
-            UE_LOG(LogTemp, Warning, TEXT("[XP-DROP] Successfully spawned XPOrb with %d XP at %s"), XPOrb->XPAmount, *SpawnLocation.ToString());
+            VAZIO_TRACE(Drop, "XP-ORB", "XP", XPOrb, XPOrb->XPAmount);
         }
         else
         {
@@ -93,6 +91,8 @@ void UEnemyDropComponent::SpawnXPOrbs(int32 TotalXP, const FVector& Location)
 
 void UEnemyDropComponent::SpawnGold(int32 GoldAmount, const FVector& Location)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioDrops);
+
     // TODO: Implement gold spawning logic
     UE_LOG(LogTemp, Log, TEXT("Should spawn %d gold at location %s"), GoldAmount, *Location.ToString());
 }
@@ -122,12 +122,13 @@ int32 UEnemyDropComponent::CalculateXPDrop(const FEnemyArchetype& Arch, const FE
     BaseXP = FMath::RoundToInt(BaseXP * Mods.RewardMultiplier);
     
     // Ensure minimum viable XP drop
-    BaseXP = FMath::Max(BaseXP, 5);
-    
-    UE_LOG(LogTemp, Log, TEXT("[XP-CALC] Enemy XP: Base=%d, HP=%.0f, Parent=%s, Final=%d"), 
-        Arch.BaseRewards.XPValue, Arch.BaseHP, bIsParent ? TEXT("YES") : TEXT("NO"), BaseXP);
-    
-    return BaseXP;
+    return FMath::Max(BaseXP, 5);
+}
+
+int32 UEnemyDropComponent::GetXPOrbCount(int32 TotalXP)
+{
+    // Split XP into multiple orbs if amount is large: max 5 orbs, min 10 XP per orb
+    return TotalXP > 50 ? FMath::Min(5, TotalXP / 10) : 1;
 }
 
 int32 UEnemyDropComponent::CalculateGoldDrop(const FEnemyArchetype& Arch, const FEnemyInstanceModifiers& Mods, bool bIsParent)
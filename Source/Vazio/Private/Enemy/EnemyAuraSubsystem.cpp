@@ -0,0 +1,235 @@
+#include "Enemy/EnemyAuraSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/Components/EnemyAuraComponent.h"
+#include "Enemy/EnemyTypes.h"
+#include "Engine/World.h"
+#include "Engine/DamageEvents.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+
+static TAutoConsoleVariable<float> CVarAuraDamageInterval(
+    TEXT("Enemy.AuraDamageInterval"),
+    0.5f,
+    TEXT("Intervalo (s) entre aplicações de dano de aura. O dano acumulado é DPS * intervalo."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAuraCellSize(
+    TEXT("Enemy.AuraCellSize"),
+    512.f,
+    TEXT("Tamanho da célula (uu) do grid de emissores de aura."),
+    ECVF_Default);
+
+void UEnemyAuraSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Emitters.Reserve(128);
+    EmitterPositions.Reserve(128);
+    EmitterCells.Reserve(128);
+    EmitterBuckets.Reserve(128);
+    SortedEmitters.Reserve(128);
+
+    UE_LOG(LogEnemy, Log, TEXT("EnemyAuraSubsystem initialized"));
+}
+
+void UEnemyAuraSubsystem::Deinitialize()
+{
+    for (UEnemyAuraComponent* Emitter : Emitters)
+    {
+        if (Emitter)
+        {
+            Emitter->EmitterIndex = INDEX_NONE;
+        }
+    }
+    Emitters.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UEnemyAuraSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyAuraSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyAuraSubsystem::RegisterEmitter(UEnemyAuraComponent* Emitter)
+{
+    if (!Emitter || Emitter->EmitterIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    Emitter->EmitterIndex = Emitters.Add(Emitter);
+}
+
+void UEnemyAuraSubsystem::UnregisterEmitter(UEnemyAuraComponent* Emitter)
+{
+    if (!Emitter || !Emitters.IsValidIndex(Emitter->EmitterIndex) || Emitters[Emitter->EmitterIndex] != Emitter)
+    {
+        return;
+    }
+
+    const int32 Index = Emitter->EmitterIndex;
+    Emitters.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Emitters.IsValidIndex(Index))
+    {
+        Emitters[Index]->EmitterIndex = Index;
+    }
+    Emitter->EmitterIndex = INDEX_NONE;
+}
+
+void UEnemyAuraSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioAuras);
+    Super::Tick(DeltaTime);
+
+    if (Emitters.Num() == 0)
+    {
+        Accumulator = 0.f;
+        return;
+    }
+
+    const float Interval = FMath::Max(0.05f, CVarAuraDamageInterval.GetValueOnGameThread());
+    Accumulator += DeltaTime;
+    if (Accumulator >= Interval)
+    {
+        // Mesmo comportamento do componente antigo: dano = DPS * tempo acumulado
+        const float Elapsed = Accumulator;
+        Accumulator = 0.f;
+        ResolveAuraDamage(Elapsed);
+    }
+}
+
+void UEnemyAuraSubsystem::BuildGrid()
+{
+    const int32 NumEmitters = Emitters.Num();
+    CellSize = FMath::Max(64.f, CVarAuraCellSize.GetValueOnGameThread());
+    const float InvCellSize = 1.f / CellSize;
+
+    EmitterPositions.SetNumUninitialized(NumEmitters, EAllowShrinking::No);
+    EmitterCells.SetNumUninitialized(NumEmitters, EAllowShrinking::No);
+    EmitterBuckets.SetNumUninitialized(NumEmitters, EAllowShrinking::No);
+    SortedEmitters.SetNumUninitialized(NumEmitters, EAllowShrinking::No);
+    FMemory::Memzero(BucketStart, sizeof(BucketStart));
+    MaxRadius = 0.f;
+
+    // Counting sort por bucket de célula
+    for (int32 i = 0; i < NumEmitters; ++i)
+    {
+        const UEnemyAuraComponent* Emitter = Emitters[i];
+        const AActor* Owner = Emitter ? Emitter->GetOwner() : nullptr;
+        if (!Owner || Emitter->DPS <= 0.f || Emitter->Radius <= 0.f)
+        {
+            EmitterBuckets[i] = INDEX_NONE;
+            continue;
+        }
+
+        const FVector Location = Owner->GetActorLocation();
+        const FIntPoint Cell(FMath::FloorToInt(Location.X * InvCellSize), FMath::FloorToInt(Location.Y * InvCellSize));
+        const int32 Bucket = HashCell(Cell.X, Cell.Y);
+
+        EmitterPositions[i] = Location;
+        EmitterCells[i] = Cell;
+        EmitterBuckets[i] = Bucket;
+        ++BucketStart[Bucket + 1];
+        MaxRadius = FMath::Max(MaxRadius, Emitter->Radius);
+    }
+
+    for (int32 b = 0; b < NumCellBuckets; ++b)
+    {
+        BucketStart[b + 1] += BucketStart[b];
+        BucketCursor[b] = BucketStart[b];
+    }
+
+    for (int32 i = 0; i < NumEmitters; ++i)
+    {
+        if (EmitterBuckets[i] != INDEX_NONE)
+        {
+            SortedEmitters[BucketCursor[EmitterBuckets[i]]++] = i;
+        }
+    }
+}
+
+void UEnemyAuraSubsystem::ResolveAuraDamage(float Interval)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    BuildGrid();
+    if (MaxRadius <= 0.f)
+    {
+        return;
+    }
+
+    const float InvCellSize = 1.f / CellSize;
+    const int32 NumValid = BucketStart[NumCellBuckets];
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        APlayerController* PC = It->Get();
+        APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+        if (!Pawn)
+        {
+            continue;
+        }
+
+        const FVector PlayerLocation = Pawn->GetActorLocation();
+        const float PawnRadius = Pawn->GetSimpleCollisionRadius();
+        const int32 CellRange = FMath::CeilToInt((MaxRadius + PawnRadius) * InvCellSize);
+        const FIntPoint PlayerCell(FMath::FloorToInt(PlayerLocation.X * InvCellSize), FMath::FloorToInt(PlayerLocation.Y * InvCellSize));
+
+        float TotalDamage = 0.f;
+        AActor* DamageCauser = nullptr;
+
+        auto AccumulateEmitter = [&](int32 i)
+        {
+            const UEnemyAuraComponent* Emitter = Emitters[i];
+            const float Reach = Emitter->Radius + PawnRadius;
+            if (FVector::DistSquared(EmitterPositions[i], PlayerLocation) <= Reach * Reach)
+            {
+                TotalDamage += Emitter->DPS * Interval;
+                DamageCauser = Emitter->GetOwner();
+            }
+        };
+
+        const int32 CellsToVisit = FMath::Square(2 * CellRange + 1);
+        if (CellsToVisit >= NumValid)
+        {
+            // Poucos emissores ou raio enorme: varredura linear sai mais barata que o grid
+            for (int32 k = 0; k < NumValid; ++k)
+            {
+                AccumulateEmitter(SortedEmitters[k]);
+            }
+        }
+        else
+        {
+            for (int32 dx = -CellRange; dx <= CellRange; ++dx)
+            {
+                for (int32 dy = -CellRange; dy <= CellRange; ++dy)
+                {
+                    const FIntPoint Cell(PlayerCell.X + dx, PlayerCell.Y + dy);
+                    const int32 Bucket = HashCell(Cell.X, Cell.Y);
+                    for (int32 k = BucketStart[Bucket]; k < BucketStart[Bucket + 1]; ++k)
+                    {
+                        const int32 i = SortedEmitters[k];
+                        // Buckets podem colidir entre células; confere a célula exata para não contar duas vezes
+                        if (EmitterCells[i] == Cell)
+                        {
+                            AccumulateEmitter(i);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (TotalDamage > 0.f)
+        {
+            UE_LOG(LogEnemy, VeryVerbose, TEXT("Aura dealing %.1f damage to %s"), TotalDamage, *Pawn->GetName());
+
+            FDamageEvent DamageEvent;
+            Pawn->TakeDamage(TotalDamage, DamageEvent, nullptr, DamageCauser);
+        }
+    }
+}
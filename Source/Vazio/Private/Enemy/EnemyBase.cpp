@@ -1,6 +1,13 @@
 #include "Enemy/EnemyBase.h"
+#include "Core/VazioStats.h"
 #include "Enemy/Components/EnemyDropComponent.h"
 #include "Enemy/Components/EnemyAuraComponent.h"
+#include "Enemy/EnemyPoolSubsystem.h"
+#include "Enemy/EnemySpawnerSubsystem.h"
+#include "Enemy/StatusEffectSubsystem.h"
+#include "Enemy/EnemySimSubsystem.h"
+#include "Enemy/EnemyDecisionSubsystem.h"
+#include "Core/GameplayTrace.h"
 #include "World/Common/Player/MyCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -13,6 +20,13 @@
 #include "EngineUtils.h" // For TActorIterator
 #include "Components/PointLightComponent.h"
 
+// Primeiro que resolver é usado; o preload do boss pede todos
+static const TCHAR* const EnemyMaterialPaths[] = {
+    TEXT("/Engine/EngineMaterials/WorldGridMaterial"),
+    TEXT("/Engine/EngineMaterials/DefaultMaterial"),
+    TEXT("/Engine/BasicShapes/BasicShapeMaterial")
+};
+
 AEnemyBase::AEnemyBase()
 {
     PrimaryActorTick.bCanEverTick = true;
@@ -80,9 +94,6 @@ void AEnemyBase::BeginPlay()
     PrimaryActorTick.bCanEverTick = true;
     SetActorTickEnabled(true);
     
-    UE_LOG(LogTemp, Warning, TEXT("[ENEMY] %s BeginPlay - Tick Enabled: %s"), 
-        *GetName(), IsActorTickEnabled() ? TEXT("YES") : TEXT("NO"));
-    
     SetupMovement();
     // Garantir que o componente de movimento está ativo e em modo Walking
     if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
@@ -97,6 +108,12 @@ void AEnemyBase::BeginPlay()
     
     // Setup damage on overlap - ONLY CapsuleComponent for precise collision
     GetCapsuleComponent()->OnComponentBeginOverlap.AddDynamic(this, &AEnemyBase::OnOverlapBegin);
+
+    // Horde simulation (chase + separation computed on worker threads)
+    if (UEnemySimSubsystem* Sim = GetWorld()->GetSubsystem<UEnemySimSubsystem>())
+    {
+        Sim->RegisterEnemy(this);
+    }
     
     // Force initial color application if not already done
     if (VisualMesh)
@@ -126,12 +143,12 @@ void AEnemyBase::BeginPlay()
             {
                 DebugLight->SetLightColor(EnemyColor.ToFColor(true));
             }
-            UE_LOG(LogTemp, Warning, TEXT("[BEGINPLAY] %s: Applied initial color %s"), *GetName(), *EnemyColor.ToString());
+            UE_LOG(LogEnemy, Verbose, TEXT("[BEGINPLAY] %s: Applied initial color %s"), *GetName(), *EnemyColor.ToString());
         }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("[BEGINPLAY] %s: HP=%.1f, Speed=%.1f, Damage=%.1f"), 
-        *GetName(), CurrentHP, GetCharacterMovement()->MaxWalkSpeed, CurrentArchetype.BaseDMG);
+    VAZIO_TRACE(Spawn, "BeginPlay", "HP Speed Damage", this,
+        CurrentHP, GetCharacterMovement()->MaxWalkSpeed, CurrentArchetype.BaseDMG);
 
     // Initialize movement logging baseline
     PreviousLocation = GetActorLocation();
@@ -139,6 +156,31 @@ void AEnemyBase::BeginPlay()
     LastTargetLocation = PreviousLocation; // will be updated next ChasePlayer
 }
 
+void AEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UEnemySimSubsystem* Sim = World->GetSubsystem<UEnemySimSubsystem>())
+        {
+            Sim->UnregisterEnemy(this);
+        }
+        if (UEnemyDecisionSubsystem* Decisions = World->GetSubsystem<UEnemyDecisionSubsystem>())
+        {
+            Decisions->UnregisterAgent(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AEnemyBase::RegisterForDecisions(FName DecisionType)
+{
+    if (UEnemyDecisionSubsystem* Decisions = GetWorld() ? GetWorld()->GetSubsystem<UEnemyDecisionSubsystem>() : nullptr)
+    {
+        Decisions->RegisterAgent(this, DecisionType);
+    }
+}
+
 void AEnemyBase::Tick(float DeltaTime)
 {
     // SAFETY: Always check validity first
@@ -151,7 +193,7 @@ void AEnemyBase::Tick(float DeltaTime)
 
     if (!bFirstTickLogged)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[TICK-ONCE] %s primeiro Tick executado"), *GetName());
+        VAZIO_TRACE_EVENT(Tick, "FirstTick", this);
         bFirstTickLogged = true;
     }
     
@@ -159,7 +201,7 @@ void AEnemyBase::Tick(float DeltaTime)
     bool bCanMove = true;
     
     // Check if we're in a valid state for movement
-    if (CurrentModifiers.bImmovable)
+    if (CurrentModifiers.bImmovable || IsStatusFrozen())
     {
         bCanMove = false;
     }
@@ -192,23 +234,14 @@ void AEnemyBase::Tick(float DeltaTime)
     
     // SAFE dash logic call
     HandleDashLogic(DeltaTime);
-    
-    // DEBUG: Very occasional logging to confirm tick is working
-    static TMap<AEnemyBase*, float> TickLogTimes;
-    if (World)
-    {
-        float CurrentTime = World->GetTimeSeconds();
-        float* LastTickLogPtr = TickLogTimes.Find(this);
-        
-        if (!LastTickLogPtr || (CurrentTime - *LastTickLogPtr > 5.0f))
-        {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("[TICK] %s ticking safely - HP=%.1f, CanMove=%s"), 
-                *GetName(), CurrentHP, bCanMove ? TEXT("YES") : TEXT("NO"));
-            TickLogTimes.Add(this, CurrentTime);
-        }
-    }
 }
 
+static TAutoConsoleVariable<int32> CVarEnemyMoveLog(
+    TEXT("Enemy.MovementLog"),
+    0,
+    TEXT("Ativa (1) ou desativa (0) o trace de movimento dos inimigos (categoria Move do trace de gameplay). Formato: MOVE Nome X= Y= Dist= Delta= Speed= MaxWalk=\n"),
+    ECVF_Default);
+
 // Console helper para reativar ticks em todos os inimigos (caso algum blueprint tenha desabilitado)
 static FAutoConsoleCommand CmdEnemyForceTick(
     TEXT("Enemy.ForceTick"),
@@ -237,6 +270,8 @@ static FAutoConsoleCommand CmdEnemyForceTick(
 
 void AEnemyBase::HandleDeath(bool bIsParentParam)
 {
+    INC_DWORD_STAT(STAT_VazioDeaths);
+
     UE_LOG(LogEnemy, Log, TEXT("%s died (parent=%d)"), *GetName(), bIsParentParam ? 1 : 0);
 
     // Handle drops through DropComponent
@@ -245,22 +280,60 @@ void AEnemyBase::HandleDeath(bool bIsParentParam)
         DropComponent->DropOnDeath(this, CurrentArchetype, CurrentModifiers, bIsParentParam);
     }
 
-    // Clear any active timers
-    if (DissolveTimerHandle.IsValid())
+    // Trigger death effects
+    OnStartDissolve();
+
+    // Return to pool or destroy (also clears any active timers)
+    ReleaseEnemy();
+}
+
+void AEnemyBase::ReleaseEnemy()
+{
+    ResetCooldowns();
+
+    UWorld* World = GetWorld();
+    if (UStatusEffectSubsystem* StatusEffects = World ? World->GetSubsystem<UStatusEffectSubsystem>() : nullptr)
+    {
+        StatusEffects->ClearEffects(this);
+    }
+    if (AuraComponent)
+    {
+        AuraComponent->SetAuraActive(false);
+    }
+    if (bIsSplitChild)
     {
-        GetWorld()->GetTimerManager().ClearTimer(DissolveTimerHandle);
+        bIsSplitChild = false;
+        if (UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr)
+        {
+            Spawner->NotifySplitChildReleased();
+        }
     }
-    if (DashCooldownHandle.IsValid())
+    if (bIsBossMinion)
     {
-        GetWorld()->GetTimerManager().ClearTimer(DashCooldownHandle);
+        bIsBossMinion = false;
+        if (UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr)
+        {
+            Spawner->NotifyBossMinionReleased(this);
+        }
     }
 
-    // Trigger death effects
-    OnStartDissolve();
+    UEnemyPoolSubsystem* Pool = World ? World->GetSubsystem<UEnemyPoolSubsystem>() : nullptr;
+    if (Pool && Pool->IsTracked(this))
+    {
+        Pool->ReturnToPool(this);
+    }
+    else
+    {
+        Destroy();
+    }
+}
 
-    // Return to pool or destroy
-    // TODO: Integrate with pool system
-    Destroy();
+void AEnemyBase::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+    for (const TCHAR* Path : EnemyMaterialPaths)
+    {
+        OutAssets.AddUnique(FSoftObjectPath(Path));
+    }
 }
 
 void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const FEnemyInstanceModifiers& Mods)
@@ -272,10 +345,7 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
     MaxHP = Arch.BaseHP;
     CurrentHP = MaxHP;
     
-    if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
-    {
-        MovementComp->MaxWalkSpeed = Arch.BaseSpeed;
-    }
+    SetBaseWalkSpeed(Arch.BaseSpeed);
 
     // Apply mesh scale based on BaseSize - NORMAL PLAYER-SIZE SCALE
     if (VisualMesh)
@@ -292,7 +362,7 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
             SetActorLocation(FVector(CurrentLocation.X, CurrentLocation.Y, 90.0f)); // Standard ground level
         }
         
-        UE_LOG(LogTemp, Warning, TEXT("[DEBUG] Enemy %s: Location=%s, Scale=%s"), 
+        UE_LOG(LogEnemy, Verbose, TEXT("[DEBUG] Enemy %s: Location=%s, Scale=%s"), 
             *GetName(), 
             *GetActorLocation().ToString(),
             *VisualMesh->GetComponentScale().ToString());
@@ -302,19 +372,18 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
         {
             UMaterialInterface* BaseMaterial = nullptr;
             
-            // Try multiple material sources with safe loading
-            TArray<FString> MaterialPaths = {
-                TEXT("/Engine/EngineMaterials/WorldGridMaterial"),
-                TEXT("/Engine/EngineMaterials/DefaultMaterial"),
-                TEXT("/Engine/BasicShapes/BasicShapeMaterial")
-            };
-            
-            for (const FString& Path : MaterialPaths)
+            // Try multiple material sources; already-resident (preloaded) ones skip the sync load
+            for (const TCHAR* Path : EnemyMaterialPaths)
             {
-                BaseMaterial = LoadObject<UMaterialInterface>(nullptr, *Path);
+                const FSoftObjectPath MaterialPath(Path);
+                BaseMaterial = Cast<UMaterialInterface>(MaterialPath.ResolveObject());
+                if (!BaseMaterial)
+                {
+                    BaseMaterial = Cast<UMaterialInterface>(MaterialPath.TryLoad());
+                }
                 if (BaseMaterial && IsValid(BaseMaterial))
                 {
-                    UE_LOG(LogTemp, Warning, TEXT("[MATERIAL] %s: Successfully loaded %s"), *GetName(), *Path);
+                    UE_LOG(LogEnemy, Verbose, TEXT("[MATERIAL] %s: Successfully loaded %s"), *GetName(), Path);
                     break;
                 }
             }
@@ -323,7 +392,7 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
             if (BaseMaterial && IsValid(BaseMaterial))
             {
                 VisualMesh->SetMaterial(0, BaseMaterial);
-                UE_LOG(LogTemp, Warning, TEXT("[MATERIAL] %s: Applied base material"), *GetName());
+                UE_LOG(LogEnemy, Verbose, TEXT("[MATERIAL] %s: Applied base material"), *GetName());
             }
             else
             {
@@ -368,7 +437,7 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
                 DynamicMaterial->SetScalarParameterValue(FName("Metallic"), 0.0f);
                 DynamicMaterial->SetScalarParameterValue(FName("Roughness"), 0.8f);
                 
-                UE_LOG(LogTemp, Warning, TEXT("[COLOR] %s: Applied color safely"), *GetName());
+                UE_LOG(LogEnemy, Verbose, TEXT("[COLOR] %s: Applied color safely"), *GetName());
             }
             else
             {
@@ -381,7 +450,7 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
         VisualMesh->SetVisibility(true);
         VisualMesh->SetHiddenInGame(false);
         
-        UE_LOG(LogTemp, Warning, TEXT("[DEBUG] Enemy %s: VisualMesh configured - Mesh=%s, Visible=%s"), 
+        UE_LOG(LogEnemy, Verbose, TEXT("[DEBUG] Enemy %s: VisualMesh configured - Mesh=%s, Visible=%s"), 
             *GetName(),
             VisualMesh->GetStaticMesh() ? *VisualMesh->GetStaticMesh()->GetName() : TEXT("NULL"),
             VisualMesh->IsVisible() ? TEXT("YES") : TEXT("NO"));
@@ -404,7 +473,7 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
         {
             FVector CurrentScale = VisualMesh->GetComponentScale();
             VisualMesh->SetWorldScale3D(CurrentScale * 1.5f);
-            UE_LOG(LogTemp, Warning, TEXT("[DEBUG] Enemy %s: BIG modifier applied - New scale=%s"), 
+            UE_LOG(LogEnemy, Verbose, TEXT("[DEBUG] Enemy %s: BIG modifier applied - New scale=%s"), 
                 *GetName(), *VisualMesh->GetComponentScale().ToString());
         }
 
@@ -414,19 +483,13 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
         CurrentArchetype.BaseDMG *= 2.f;
 
         // Speed x0.5
-        if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
-        {
-            MovementComp->MaxWalkSpeed *= 0.5f;
-        }
+        SetBaseWalkSpeed(BaseWalkSpeed * 0.5f);
     }
 
     // 4. Apply 'immovable' modifier
     if (Mods.bImmovable)
     {
-        if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
-        {
-            MovementComp->MaxWalkSpeed = 0.f;
-        }
+        SetBaseWalkSpeed(0.f);
     }
 
     // 5. Apply 'dissolveSeconds' timer
@@ -439,11 +502,11 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
     if (Arch.bHasAura && AuraComponent)
     {
         AuraComponent->SetAuraProperties(Arch.AuraRadius, Arch.AuraDPS);
-        AuraComponent->bAuraActive = true;
+        AuraComponent->SetAuraActive(true);
     }
     else if (AuraComponent)
     {
-        AuraComponent->bAuraActive = false;
+        AuraComponent->SetAuraActive(false);
     }
 
     // Apply visual effects
@@ -456,40 +519,84 @@ void AEnemyBase::ApplyArchetypeAndModifiers(const FEnemyArchetype& Arch, const F
 
 void AEnemyBase::StartDissolveTimer()
 {
-    if (CurrentModifiers.DissolveSeconds > 0.f && GetWorld())
+    UEnemyCooldownSubsystem* Cooldowns = GetCooldowns();
+    if (CurrentModifiers.DissolveSeconds > 0.f && Cooldowns)
     {
         UE_LOG(LogEnemy, Log, TEXT("%s starting dissolve timer: %.1fs"), *GetName(), CurrentModifiers.DissolveSeconds);
         
-        GetWorld()->GetTimerManager().SetTimer(
+        Cooldowns->Schedule(
             DissolveTimerHandle,
-            this,
-            &AEnemyBase::OnDissolveComplete,
             CurrentModifiers.DissolveSeconds,
-            false
+            FSimpleDelegate::CreateUObject(this, &AEnemyBase::OnDissolveComplete)
         );
     }
 }
 
-void AEnemyBase::OnDissolveComplete()
+void AEnemyBase::ResetCooldowns()
 {
-    UE_LOG(LogEnemy, Log, TEXT("%s dissolved (no drops)"), *GetName());
-    
-    // Clear timers
-    if (DissolveTimerHandle.IsValid())
+    if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
     {
-        GetWorld()->GetTimerManager().ClearTimer(DissolveTimerHandle);
+        Cooldowns->Cancel(DissolveTimerHandle);
+        Cooldowns->Cancel(DashCooldownHandle);
+        Cooldowns->Cancel(DamageFlashHandle);
     }
-    if (DashCooldownHandle.IsValid())
+    else
     {
-        GetWorld()->GetTimerManager().ClearTimer(DashCooldownHandle);
+        DissolveTimerHandle.Invalidate();
+        DashCooldownHandle.Invalidate();
+        DamageFlashHandle.Invalidate();
     }
+}
 
+void AEnemyBase::Empower(float BonusFraction, float MaxScale)
+{
+    // Base já com o multiplicador da instância; nunca reduz quem já passou do teto
+    const float BaseHP = FMath::Max(1.f, CurrentArchetype.BaseHP * CurrentModifiers.HealthMultiplier);
+    MaxHP = FMath::Max(MaxHP, FMath::Min(MaxHP + BaseHP * BonusFraction, BaseHP * FMath::Max(1.f, MaxScale)));
+    CurrentHP = MaxHP;
+}
+
+void AEnemyBase::SetStatusSpeedScale(float NewScale)
+{
+    NewScale = FMath::Clamp(NewScale, 0.f, 1.f);
+    UCharacterMovementComponent* MovementComp = GetCharacterMovement();
+    if (!MovementComp || NewScale == StatusSpeedScale)
+    {
+        return;
+    }
+
+    StatusSpeedScale = NewScale;
+    MovementComp->MaxWalkSpeed = BaseWalkSpeed * StatusSpeedScale;
+    if (IsStatusFrozen())
+    {
+        MovementComp->StopMovementImmediately();
+    }
+}
+
+void AEnemyBase::SetBaseWalkSpeed(float Speed)
+{
+    BaseWalkSpeed = FMath::Max(0.f, Speed);
+    if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
+    {
+        MovementComp->MaxWalkSpeed = BaseWalkSpeed * StatusSpeedScale;
+    }
+}
+
+UEnemyCooldownSubsystem* AEnemyBase::GetCooldowns() const
+{
+    UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UEnemyCooldownSubsystem>() : nullptr;
+}
+
+void AEnemyBase::OnDissolveComplete()
+{
+    UE_LOG(LogEnemy, Log, TEXT("%s dissolved (no drops)"), *GetName());
+    
     // Trigger dissolve effects
     OnStartDissolve();
 
-    // Return to pool or destroy without drops
-    // TODO: Integrate with pool system
-    Destroy();
+    // Return to pool or destroy without drops (also clears timers)
+    ReleaseEnemy();
 }
 
 void AEnemyBase::SetupMovement()
@@ -499,12 +606,14 @@ void AEnemyBase::SetupMovement()
     {
         MovementComp->bOrientRotationToMovement = true;
         MovementComp->RotationRate = FRotator(0.f, 720.f, 0.f); // Fast rotation toward target
-        MovementComp->MaxWalkSpeed = CurrentArchetype.BaseSpeed;
     }
+    SetBaseWalkSpeed(CurrentArchetype.BaseSpeed);
 }
 
 void AEnemyBase::ChasePlayer()
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioChase);
+
     // SAFETY FIRST - Multiple null checks to prevent crashes
     if (!IsValid(this))
     {
@@ -561,6 +670,9 @@ void AEnemyBase::ChasePlayer()
     }
     
     DirectionToPlayer = DirectionToPlayer.GetSafeNormal();
+
+    // Prefer the parallel horde sim result (chase + separation from the previous frame)
+    DirectionToPlayer = GetSimSteerDirection(DirectionToPlayer);
     
     // SIMPLE MOVEMENT - Force AddMovementInput even without Controller
     float InputScale = 1.0f;
@@ -599,56 +711,21 @@ void AEnemyBase::ChasePlayer()
         AddActorWorldOffset(Step, true, &SweepHit);
     }
 
-    // DEBUG: Reduced frequency logging to prevent spam and potential crashes
-    static TMap<AEnemyBase*, float> LastLogTimes;
-    float CurrentTime = World->GetTimeSeconds();
-    float* LastLogTimePtr = LastLogTimes.Find(this);
-    
-    if (!LastLogTimePtr || (CurrentTime - *LastLogTimePtr > 3.0f))
-    {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("[CHASE] %s chasing player - Distance: %.1f"), *GetName(), DistanceToPlayer);
-        LastLogTimes.Add(this, CurrentTime);
-    }
-
-    // MOVEMENT POSITION LOGGING (toggleable)
-    static TAutoConsoleVariable<int32> CVarEnemyMoveLog(
-        TEXT("Enemy.MovementLog"),
-        1,
-        TEXT("Ativa (1) ou desativa (0) logs detalhados de movimento dos inimigos. Formato: [MOVE] Nome Old=(x,y,z) New=(x,y,z) Target=(x,y,z) Dist= Delta= Speed= Nominal= MaxWalk= Time=\n"),
-        ECVF_Default);
-
+#if VAZIO_GAMEPLAY_TRACE
+    // MOVEMENT POSITION TRACE (toggleable, vai para o ring buffer de trace; ver Vazio.Trace.Dump)
     const bool bDoMoveLog = CVarEnemyMoveLog.GetValueOnGameThread() != 0;
     if (bDoMoveLog && bHasPreviousLocation)
     {
-        FVector NewLocation = GetActorLocation();
-        const FVector OldLocation = PreviousLocation;
-        const float FrameDelta = (NewLocation - OldLocation).Size2D();
+        const FVector NewLocation = GetActorLocation();
+        const float FrameDelta = (NewLocation - PreviousLocation).Size2D();
         const float DistToTargetNow = FVector::Dist2D(NewLocation, PlayerLocation);
-        float CurrentSpeedComp = 0.f;
-        if (UCharacterMovementComponent* Move = GetCharacterMovement())
-        {
-            CurrentSpeedComp = Move->Velocity.Size2D();
-        }
 
-        // Throttle high-frequency: only log if moved > 1 uu ou a cada 0.75s
-        static TMap<AEnemyBase*, float> LastMoveLogTime;
-        float* LastTimePtr = LastMoveLogTime.Find(this);
-        const bool bMovedEnough = FrameDelta > 1.0f;
-        const bool bTimeElapsed = (!LastTimePtr) || (CurrentTime - *LastTimePtr > 0.75f);
-        if (bMovedEnough || bTimeElapsed)
+        // Só registra se andou > 1 uu; o limite por categoria do trace cuida do resto
+        if (FrameDelta > 1.0f)
         {
-            LastMoveLogTime.Add(this, CurrentTime);
-            UE_LOG(LogTemp, Warning, TEXT("[MOVE] %s Old=(%.0f,%.0f,%.0f) New=(%.0f,%.0f,%.0f) Target=(%.0f,%.0f,%.0f) Dist=%.1f Delta=%.2f Speed=%.1f Nominal=%.1f MaxWalk=%.1f Time=%.2f"),
-                *GetName(),
-                OldLocation.X, OldLocation.Y, OldLocation.Z,
-                NewLocation.X, NewLocation.Y, NewLocation.Z,
-                PlayerLocation.X, PlayerLocation.Y, PlayerLocation.Z,
-                DistToTargetNow,
-                FrameDelta,
-                CurrentSpeedComp,
-                CurrentArchetype.BaseSpeed,
-                GetCharacterMovement() ? GetCharacterMovement()->MaxWalkSpeed : -1.f,
-                CurrentTime);
+            VAZIO_TRACE(Move, "MOVE", "X Y Dist Delta Speed MaxWalk", this,
+                NewLocation.X, NewLocation.Y, DistToTargetNow, FrameDelta,
+                MyMovement->Velocity.Size2D(), MyMovement->MaxWalkSpeed);
         }
         PreviousLocation = NewLocation;
     }
@@ -657,6 +734,23 @@ void AEnemyBase::ChasePlayer()
         PreviousLocation = GetActorLocation();
         bHasPreviousLocation = true;
     }
+#endif
+}
+
+FVector AEnemyBase::GetSimSteerDirection(const FVector& Fallback) const
+{
+    const UWorld* World = GetWorld();
+    if (const UEnemySimSubsystem* Sim = World ? World->GetSubsystem<UEnemySimSubsystem>() : nullptr)
+    {
+        if (const FEnemySimOutput* SimOutput = Sim->GetOutput(this))
+        {
+            if (!SimOutput->SteerDirection.IsNearlyZero())
+            {
+                return SimOutput->SteerDirection;
+            }
+        }
+    }
+    return Fallback;
 }
 
 void AEnemyBase::HandleDashLogic(float DeltaTime)
@@ -673,6 +767,9 @@ float AEnemyBase::TakeDamage(float DamageAmount, struct FDamageEvent const& Dama
 
 void AEnemyBase::TakeDamageSimple(float Damage)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioEnemyDamage);
+    INC_DWORD_STAT(STAT_VazioDamageEvents);
+
     CurrentHP = FMath::Max(0.f, CurrentHP - Damage);
     
     UE_LOG(LogEnemy, VeryVerbose, TEXT("%s took %.1f damage, HP: %.1f/%.1f"), 
@@ -686,24 +783,16 @@ void AEnemyBase::TakeDamageSimple(float Damage)
 
 void AEnemyBase::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-    // Log all overlaps for debugging with more detail
-    UE_LOG(LogTemp, Warning, TEXT("[ENEMY-OVERLAP] %s (%s) overlapped with %s (%s)"), 
-        *GetName(), 
-        OverlappedComp ? *OverlappedComp->GetName() : TEXT("NULL"), 
-        OtherActor ? *OtherActor->GetName() : TEXT("NULL"),
-        OtherComp ? *OtherComp->GetName() : TEXT("NULL"));
+    VAZIO_TRACE_EVENT(Overlap, "ENEMY-OVERLAP", OtherActor);
     
     // Damage player on overlap
     if (AMyCharacter* Player = Cast<AMyCharacter>(OtherActor))
     {
-        UE_LOG(LogTemp, Warning, TEXT("[DAMAGE-ATTEMPT] %s attempting to damage player %s"), *GetName(), *Player->GetName());
-        
         // Damage cooldown to prevent spam
         float CurrentTime = GetWorld()->GetTimeSeconds();
         if (CurrentTime - LastDamageTime < 1.0f) 
         {
-            UE_LOG(LogTemp, Warning, TEXT("[DAMAGE] %s damage on cooldown (%.2fs remaining)"), 
-                *GetName(), 1.0f - (CurrentTime - LastDamageTime));
+            VAZIO_TRACE(Damage, "DAMAGE-COOLDOWN", "Remaining", this, 1.0f - (CurrentTime - LastDamageTime));
             return;
         }
         LastDamageTime = CurrentTime;
@@ -717,13 +806,9 @@ void AEnemyBase::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* Oth
         DamageEvent.HitInfo = SweepResult;
         DamageEvent.ShotDirection = (Player->GetActorLocation() - GetActorLocation()).GetSafeNormal();
         
-        UE_LOG(LogTemp, Warning, TEXT("[DAMAGE-APPLY] %s calling TakeDamage(%.1f) on player %s"), 
-            *GetName(), DamageAmount, *Player->GetName());
+        [[maybe_unused]] const float ActualDamage = Player->TakeDamage(DamageAmount, DamageEvent, nullptr, this);
         
-        float ActualDamage = Player->TakeDamage(DamageAmount, DamageEvent, nullptr, this);
-        
-        UE_LOG(LogTemp, Warning, TEXT("[DAMAGE-RESULT] Player->TakeDamage returned %.1f (expected %.1f)"), 
-            ActualDamage, DamageAmount);
+        VAZIO_TRACE(Damage, "DAMAGE-PLAYER", "Expected Applied", this, DamageAmount, ActualDamage);
             
         // Visual feedback - make enemy flash or something
         if (VisualMesh)
@@ -736,25 +821,27 @@ void AEnemyBase::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* Oth
                 Mat->SetVectorParameterValue(FName("BaseColor"), FLinearColor::White);
                 
                 // Reset color after brief flash
-                FTimerHandle FlashTimer;
-                GetWorld()->GetTimerManager().SetTimer(FlashTimer, [this]() {
-                    if (VisualMesh)
-                    {
-                        UMaterialInstanceDynamic* ResetMat = VisualMesh->CreateAndSetMaterialInstanceDynamic(0);
-                        if (ResetMat)
+                if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
+                {
+                    Cooldowns->Schedule(DamageFlashHandle, 0.1f, FSimpleDelegate::CreateWeakLambda(this, [this]() {
+                        if (VisualMesh)
                         {
-                            // Reset to original color based on type
-                            FLinearColor OriginalColor = FLinearColor::Red;
-                            FString ClassName = GetClass()->GetName();
-                            
-                            if (ClassName.Contains(TEXT("Heavy"))) OriginalColor = FLinearColor::Blue;
-                            else if (ClassName.Contains(TEXT("Ranged"))) OriginalColor = FLinearColor::Yellow;
-                            else if (ClassName.Contains(TEXT("Dash"))) OriginalColor = FLinearColor::Green;
-                            
-                            ResetMat->SetVectorParameterValue(FName("BaseColor"), OriginalColor);
+                            UMaterialInstanceDynamic* ResetMat = VisualMesh->CreateAndSetMaterialInstanceDynamic(0);
+                            if (ResetMat)
+                            {
+                                // Reset to original color based on type
+                                FLinearColor OriginalColor = FLinearColor::Red;
+                                FString ClassName = GetClass()->GetName();
+                                
+                                if (ClassName.Contains(TEXT("Heavy"))) OriginalColor = FLinearColor::Blue;
+                                else if (ClassName.Contains(TEXT("Ranged"))) OriginalColor = FLinearColor::Yellow;
+                                else if (ClassName.Contains(TEXT("Dash"))) OriginalColor = FLinearColor::Green;
+                                
+                                ResetMat->SetVectorParameterValue(FName("BaseColor"), OriginalColor);
+                            }
                         }
-                    }
-                }, 0.1f, false);
+                    }));
+                }
             }
         }
     }
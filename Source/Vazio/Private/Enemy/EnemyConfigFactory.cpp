@@ -1,5 +1,9 @@
 #include "Enemy/EnemyConfig.h"
 #include "Enemy/EnemyTypes.h"
+#include "Dom/JsonObject.h"
+#include "JsonObjectConverter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 // Static function to create default enemy config for testing
 UEnemyConfig* UEnemyConfig::CreateDefaultConfig()
@@ -137,3 +141,46 @@ UEnemyConfig* UEnemyConfig::CreateDefaultConfig()
     
     return Config;
 }
+
+bool UEnemyConfig::ApplyOverridesFromJSON(const FString& JSONString, TArray<FString>* OutErrors)
+{
+    TSharedPtr<FJsonObject> RootObject;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JSONString);
+    const TSharedPtr<FJsonObject>* ArchetypesObject = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid() || !RootObject->TryGetObjectField(TEXT("archetypes"), ArchetypesObject))
+    {
+        if (OutErrors)
+        {
+            OutErrors->Add(TEXT("Invalid JSON or missing 'archetypes' object"));
+        }
+        return false;
+    }
+
+    bool bSuccess = true;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*ArchetypesObject)->Values)
+    {
+        const TSharedPtr<FJsonObject>* FieldsObject = nullptr;
+        if (!Pair.Value->TryGetObject(FieldsObject))
+        {
+            if (OutErrors)
+            {
+                OutErrors->Add(FString::Printf(TEXT("'%s' must be an object"), *Pair.Key));
+            }
+            bSuccess = false;
+            continue;
+        }
+
+        // JsonObjectToUStruct only touches the fields present in the JSON
+        FEnemyArchetype& Archetype = Archetypes.FindOrAdd(FName(*Pair.Key));
+        if (!FJsonObjectConverter::JsonObjectToUStruct(FieldsObject->ToSharedRef(), &Archetype))
+        {
+            if (OutErrors)
+            {
+                OutErrors->Add(FString::Printf(TEXT("'%s': could not convert fields to FEnemyArchetype"), *Pair.Key));
+            }
+            bSuccess = false;
+        }
+    }
+
+    return bSuccess;
+}
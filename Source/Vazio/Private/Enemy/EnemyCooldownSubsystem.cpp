@@ -0,0 +1,278 @@
+#include "Enemy/EnemyCooldownSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemyTypes.h"
+
+void UEnemyCooldownSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    for (int32& Head : BucketHeads)
+    {
+        Head = INDEX_NONE;
+    }
+
+    Entries.Reserve(256);
+    FreeList.Reserve(256);
+    ExpiredScratch.Reserve(64);
+
+    UE_LOG(LogEnemy, Log, TEXT("EnemyCooldownSubsystem initialized (resolution %.4fs, %d buckets)"), TickResolution, NumBuckets);
+}
+
+void UEnemyCooldownSubsystem::Deinitialize()
+{
+    Entries.Empty();
+    FreeList.Empty();
+    ExpiredScratch.Empty();
+    NumPending = 0;
+
+    Super::Deinitialize();
+}
+
+TStatId UEnemyCooldownSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyCooldownSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyCooldownSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioCooldowns);
+    Super::Tick(DeltaTime);
+
+    Accumulator += DeltaTime;
+    while (Accumulator >= TickResolution)
+    {
+        Accumulator -= TickResolution;
+        AdvanceOneTick();
+    }
+
+    FireExpired();
+}
+
+void UEnemyCooldownSubsystem::Schedule(FEnemyCooldownHandle& InOutHandle, float DelaySeconds, FSimpleDelegate Callback)
+{
+    Cancel(InOutHandle);
+
+    if (!Callback.IsBound())
+    {
+        return;
+    }
+
+    // Arredonda para cima: nunca dispara antes do pedido
+    const double TicksF = FMath::CeilToDouble((FMath::Max(0.f, DelaySeconds) + Accumulator) / TickResolution);
+    const uint64 Ticks = FMath::Clamp<uint64>(static_cast<uint64>(TicksF), 1, MaxTicks);
+
+    const int32 Index = AllocEntry();
+    FEntry& Entry = Entries[Index];
+    Entry.Callback = MoveTemp(Callback);
+    Entry.ExpireTick = CurrentTick + Ticks;
+    InsertEntry(Index);
+
+    InOutHandle.Slot = static_cast<uint32>(Index);
+    InOutHandle.Serial = Entry.Serial;
+}
+
+void UEnemyCooldownSubsystem::Cancel(FEnemyCooldownHandle& InOutHandle)
+{
+    if (FindEntry(InOutHandle))
+    {
+        const int32 Index = static_cast<int32>(InOutHandle.Slot);
+        if (Entries[Index].Bucket != INDEX_NONE)
+        {
+            UnlinkEntry(Index);
+        }
+        FreeEntry(Index);
+    }
+    InOutHandle.Invalidate();
+}
+
+bool UEnemyCooldownSubsystem::IsPending(const FEnemyCooldownHandle& Handle) const
+{
+    return FindEntry(Handle) != nullptr;
+}
+
+float UEnemyCooldownSubsystem::GetTimeRemaining(const FEnemyCooldownHandle& Handle) const
+{
+    const FEntry* Entry = FindEntry(Handle);
+    if (!Entry)
+    {
+        return 0.f;
+    }
+    const float Remaining = static_cast<float>(Entry->ExpireTick - CurrentTick) * TickResolution - Accumulator;
+    return FMath::Max(0.f, Remaining);
+}
+
+UEnemyCooldownSubsystem::FEntry* UEnemyCooldownSubsystem::FindEntry(const FEnemyCooldownHandle& Handle)
+{
+    if (!Handle.IsValid() || !Entries.IsValidIndex(static_cast<int32>(Handle.Slot)))
+    {
+        return nullptr;
+    }
+    FEntry& Entry = Entries[static_cast<int32>(Handle.Slot)];
+    return Entry.Serial == Handle.Serial ? &Entry : nullptr;
+}
+
+const UEnemyCooldownSubsystem::FEntry* UEnemyCooldownSubsystem::FindEntry(const FEnemyCooldownHandle& Handle) const
+{
+    return const_cast<UEnemyCooldownSubsystem*>(this)->FindEntry(Handle);
+}
+
+int32 UEnemyCooldownSubsystem::AllocEntry()
+{
+    const int32 Index = FreeList.Num() > 0 ? FreeList.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+    FEntry& Entry = Entries[Index];
+    Entry.Serial = NextSerial++;
+    if (NextSerial == 0)
+    {
+        NextSerial = 1; // 0 é reservado para handle inválido
+    }
+    Entry.Bucket = INDEX_NONE;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = INDEX_NONE;
+
+    ++NumPending;
+    return Index;
+}
+
+void UEnemyCooldownSubsystem::FreeEntry(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    Entry.Callback.Unbind();
+    Entry.Serial = 0;
+    Entry.Bucket = INDEX_NONE;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = INDEX_NONE;
+    FreeList.Add(Index);
+
+    --NumPending;
+}
+
+void UEnemyCooldownSubsystem::InsertEntry(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    const uint64 Expire = Entry.ExpireTick;
+    const uint64 Diff = Expire > CurrentTick ? Expire - CurrentTick : 0;
+
+    int32 Bucket;
+    if (Diff < (uint64(1) << Level0Bits))
+    {
+        Bucket = static_cast<int32>(Expire & (Level0Size - 1));
+    }
+    else if (Diff < (uint64(1) << (Level0Bits + LevelNBits)))
+    {
+        Bucket = Level0Size + static_cast<int32>((Expire >> Level0Bits) & (LevelNSize - 1));
+    }
+    else if (Diff < (uint64(1) << (Level0Bits + LevelNBits * 2)))
+    {
+        Bucket = Level0Size + LevelNSize + static_cast<int32>((Expire >> (Level0Bits + LevelNBits)) & (LevelNSize - 1));
+    }
+    else
+    {
+        Bucket = Level0Size + LevelNSize * 2 + static_cast<int32>((Expire >> (Level0Bits + LevelNBits * 2)) & (LevelNSize - 1));
+    }
+
+    // Push front na lista intrusiva do bucket
+    Entry.Bucket = Bucket;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = BucketHeads[Bucket];
+    if (Entry.Next != INDEX_NONE)
+    {
+        Entries[Entry.Next].Prev = Index;
+    }
+    BucketHeads[Bucket] = Index;
+}
+
+void UEnemyCooldownSubsystem::UnlinkEntry(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    if (Entry.Prev != INDEX_NONE)
+    {
+        Entries[Entry.Prev].Next = Entry.Next;
+    }
+    else
+    {
+        BucketHeads[Entry.Bucket] = Entry.Next;
+    }
+    if (Entry.Next != INDEX_NONE)
+    {
+        Entries[Entry.Next].Prev = Entry.Prev;
+    }
+    Entry.Bucket = INDEX_NONE;
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = INDEX_NONE;
+}
+
+void UEnemyCooldownSubsystem::CascadeBucket(int32 Bucket)
+{
+    int32 Index = BucketHeads[Bucket];
+    BucketHeads[Bucket] = INDEX_NONE;
+
+    while (Index != INDEX_NONE)
+    {
+        const int32 Next = Entries[Index].Next;
+        InsertEntry(Index);
+        Index = Next;
+    }
+}
+
+void UEnemyCooldownSubsystem::AdvanceOneTick()
+{
+    ++CurrentTick;
+
+    // Quando um nível dá a volta, redistribui o bucket correspondente do nível acima
+    if ((CurrentTick & (Level0Size - 1)) == 0)
+    {
+        const int32 Idx1 = static_cast<int32>((CurrentTick >> Level0Bits) & (LevelNSize - 1));
+        CascadeBucket(Level0Size + Idx1);
+        if (Idx1 == 0)
+        {
+            const int32 Idx2 = static_cast<int32>((CurrentTick >> (Level0Bits + LevelNBits)) & (LevelNSize - 1));
+            CascadeBucket(Level0Size + LevelNSize + Idx2);
+            if (Idx2 == 0)
+            {
+                const int32 Idx3 = static_cast<int32>((CurrentTick >> (Level0Bits + LevelNBits * 2)) & (LevelNSize - 1));
+                CascadeBucket(Level0Size + LevelNSize * 2 + Idx3);
+            }
+        }
+    }
+
+    const int32 Bucket = static_cast<int32>(CurrentTick & (Level0Size - 1));
+    int32 Index = BucketHeads[Bucket];
+    BucketHeads[Bucket] = INDEX_NONE;
+
+    while (Index != INDEX_NONE)
+    {
+        FEntry& Entry = Entries[Index];
+        const int32 Next = Entry.Next;
+        Entry.Bucket = INDEX_NONE;
+        Entry.Prev = INDEX_NONE;
+        Entry.Next = INDEX_NONE;
+
+        FEnemyCooldownHandle Handle;
+        Handle.Slot = static_cast<uint32>(Index);
+        Handle.Serial = Entry.Serial;
+        ExpiredScratch.Add(Handle);
+
+        Index = Next;
+    }
+}
+
+void UEnemyCooldownSubsystem::FireExpired()
+{
+    // Callbacks podem cancelar outras entradas do mesmo lote ou agendar novas;
+    // o serial garante que entradas canceladas/recicladas são ignoradas
+    for (int32 i = 0; i < ExpiredScratch.Num(); ++i)
+    {
+        const FEnemyCooldownHandle Handle = ExpiredScratch[i];
+        FEntry* Entry = FindEntry(Handle);
+        if (!Entry)
+        {
+            continue;
+        }
+
+        FSimpleDelegate Callback = MoveTemp(Entry->Callback);
+        FreeEntry(static_cast<int32>(Handle.Slot));
+        Callback.ExecuteIfBound();
+    }
+    ExpiredScratch.Reset();
+}
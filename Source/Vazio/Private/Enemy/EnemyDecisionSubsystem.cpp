@@ -0,0 +1,200 @@
+#include "Enemy/EnemyDecisionSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemyBase.h"
+#include "Enemy/EnemySimSubsystem.h"
+#include "Enemy/EnemyTypes.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+static TAutoConsoleVariable<int32> CVarDecisionBudget(
+    TEXT("Enemy.AI.DecisionBudget"),
+    48,
+    TEXT("Máximo de decisões de IA executadas por frame."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDecisionNearInterval(
+    TEXT("Enemy.AI.NearInterval"),
+    0.1f,
+    TEXT("Intervalo (s) entre decisões para inimigos a menos de Enemy.AI.NearDistance do jogador."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDecisionFarInterval(
+    TEXT("Enemy.AI.FarInterval"),
+    0.5f,
+    TEXT("Intervalo (s) entre decisões para inimigos além de Enemy.AI.FarDistance."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDecisionNearDistance(
+    TEXT("Enemy.AI.NearDistance"),
+    800.f,
+    TEXT("Distância (uu) até a qual o inimigo usa o intervalo curto."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDecisionFarDistance(
+    TEXT("Enemy.AI.FarDistance"),
+    2500.f,
+    TEXT("Distância (uu) a partir da qual o inimigo usa o intervalo longo."),
+    ECVF_Default);
+
+void UEnemyDecisionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Agents.Reserve(256);
+    UE_LOG(LogEnemy, Log, TEXT("EnemyDecisionSubsystem initialized"));
+}
+
+void UEnemyDecisionSubsystem::Deinitialize()
+{
+    for (FDecisionAgent& Agent : Agents)
+    {
+        if (AEnemyBase* Enemy = Agent.Enemy.Get())
+        {
+            Enemy->DecisionIndex = INDEX_NONE;
+        }
+    }
+    Agents.Empty();
+    TypeStats.Empty();
+    Super::Deinitialize();
+}
+
+TStatId UEnemyDecisionSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyDecisionSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyDecisionSubsystem::RegisterAgent(AEnemyBase* Enemy, FName DecisionType)
+{
+    if (!Enemy || Enemy->DecisionIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    FDecisionAgent Agent;
+    Agent.Enemy = Enemy;
+    Agent.DecisionType = DecisionType;
+    Agent.NextDecisionTime = 0.0; // decide já no primeiro frame
+    Enemy->DecisionIndex = Agents.Add(Agent);
+    TypeStats.FindOrAdd(DecisionType);
+}
+
+void UEnemyDecisionSubsystem::UnregisterAgent(AEnemyBase* Enemy)
+{
+    if (!Enemy || !Agents.IsValidIndex(Enemy->DecisionIndex) || Agents[Enemy->DecisionIndex].Enemy.Get() != Enemy)
+    {
+        return;
+    }
+
+    const int32 Index = Enemy->DecisionIndex;
+    Agents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Agents.IsValidIndex(Index))
+    {
+        if (AEnemyBase* Moved = Agents[Index].Enemy.Get())
+        {
+            Moved->DecisionIndex = Index;
+        }
+    }
+    Enemy->DecisionIndex = INDEX_NONE;
+}
+
+float UEnemyDecisionSubsystem::GetDecisionInterval(const AEnemyBase* Enemy, const FVector& PlayerLocation) const
+{
+    float Distance;
+    const UEnemySimSubsystem* Sim = GetWorld()->GetSubsystem<UEnemySimSubsystem>();
+    const FEnemySimOutput* SimOutput = Sim ? Sim->GetOutput(Enemy) : nullptr;
+    if (SimOutput)
+    {
+        Distance = SimOutput->DistanceToPlayer;
+    }
+    else
+    {
+        Distance = FVector::Dist2D(Enemy->GetActorLocation(), PlayerLocation);
+    }
+
+    const float NearDistance = CVarDecisionNearDistance.GetValueOnGameThread();
+    const float FarDistance = FMath::Max(NearDistance + 1.f, CVarDecisionFarDistance.GetValueOnGameThread());
+    const float Alpha = FMath::Clamp((Distance - NearDistance) / (FarDistance - NearDistance), 0.f, 1.f);
+    return FMath::Lerp(CVarDecisionNearInterval.GetValueOnGameThread(), CVarDecisionFarInterval.GetValueOnGameThread(), Alpha);
+}
+
+void UEnemyDecisionSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioDecisions);
+    Super::Tick(DeltaTime);
+
+    LastFrameDecisions = 0;
+    const int32 NumAgents = Agents.Num();
+    UWorld* World = GetWorld();
+    if (NumAgents == 0 || !World)
+    {
+        return;
+    }
+
+    const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+    const FVector PlayerLocation = PlayerPawn ? PlayerPawn->GetActorLocation() : FVector::ZeroVector;
+    const double Now = World->GetTimeSeconds();
+    const int32 Budget = FMath::Max(1, CVarDecisionBudget.GetValueOnGameThread());
+
+    // Round-robin: continua de onde parou no frame anterior e dá no máximo uma volta
+    Cursor = Cursor % NumAgents;
+    for (int32 Visited = 0; Visited < NumAgents && LastFrameDecisions < Budget; ++Visited)
+    {
+        const int32 Index = Cursor;
+        Cursor = (Cursor + 1) % NumAgents;
+
+        FDecisionAgent& Agent = Agents[Index];
+        AEnemyBase* Enemy = Agent.Enemy.Get();
+        if (!Enemy || Enemy->IsHidden() || !Enemy->IsActorTickEnabled() || Now < Agent.NextDecisionTime)
+        {
+            continue;
+        }
+
+        const FName DecisionType = Agent.DecisionType;
+        Agent.NextDecisionTime = Now + GetDecisionInterval(Enemy, PlayerLocation);
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        Enemy->MakeDecision(); // pode matar/desregistrar o agente; não usar Agent depois daqui
+        const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+        FDecisionTypeStats& Stats = TypeStats.FindOrAdd(DecisionType);
+        ++Stats.Decisions;
+        Stats.Cycles += Cycles;
+        Stats.MaxCycles = FMath::Max(Stats.MaxCycles, Cycles);
+        ++LastFrameDecisions;
+        INC_DWORD_STAT(STAT_VazioDecisionsPerFrame);
+
+        if (Agents.Num() != NumAgents)
+        {
+            break; // registro mudou durante a decisão; retoma no próximo frame
+        }
+    }
+}
+
+void UEnemyDecisionSubsystem::DumpStats(bool bReset)
+{
+    UE_LOG(LogEnemy, Log, TEXT("[AI Decisions] agents=%d last frame=%d"), Agents.Num(), LastFrameDecisions);
+    for (TPair<FName, FDecisionTypeStats>& Pair : TypeStats)
+    {
+        const FDecisionTypeStats& Stats = Pair.Value;
+        const double TotalMs = FPlatformTime::ToMilliseconds64(Stats.Cycles);
+        const double AvgUs = Stats.Decisions > 0 ? (TotalMs * 1000.0) / Stats.Decisions : 0.0;
+        UE_LOG(LogEnemy, Log, TEXT("  %-16s decisions=%lld avg=%.2fus max=%.2fus total=%.2fms"),
+               *Pair.Key.ToString(), Stats.Decisions, AvgUs, FPlatformTime::ToMilliseconds64(Stats.MaxCycles) * 1000.0, TotalMs);
+        if (bReset)
+        {
+            Pair.Value = FDecisionTypeStats();
+        }
+    }
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyDecisionStats(
+    TEXT("Enemy.AI.DecisionStats"),
+    TEXT("Enemy.AI.DecisionStats [reset] - custo médio das decisões de IA por tipo de inimigo"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UEnemyDecisionSubsystem* Decisions = World ? World->GetSubsystem<UEnemyDecisionSubsystem>() : nullptr)
+        {
+            Decisions->DumpStats(Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase));
+        }
+    }),
+    ECVF_Default
+);
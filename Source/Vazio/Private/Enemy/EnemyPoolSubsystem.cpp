@@ -1,4 +1,5 @@
 #include "Enemy/EnemyPoolSubsystem.h"
+#include "Core/VazioStats.h"
 #include "Enemy/EnemyBase.h"
 #include "Engine/World.h"
 #include "Enemy/EnemyTypes.h"
@@ -20,6 +21,8 @@ void UEnemyPoolSubsystem::Deinitialize()
 
 AEnemyBase* UEnemyPoolSubsystem::GetFromPool(FName EnemyType, TSubclassOf<AEnemyBase> EnemyClass)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioPoolAcquire);
+
     if (!EnemyClass)
     {
         UE_LOG(LogEnemySpawn, Error, TEXT("GetFromPool: Invalid enemy class for type %s"), *EnemyType.ToString());
@@ -42,6 +45,8 @@ AEnemyBase* UEnemyPoolSubsystem::GetFromPool(FName EnemyType, TSubclassOf<AEnemy
             
             // Track as active
             ActiveEnemies.Add(PooledEnemy, EnemyType);
+            INC_DWORD_STAT(STAT_VazioPoolHits);
+            UpdateActiveStats();
             
             UE_LOG(LogEnemySpawn, VeryVerbose, TEXT("Retrieved %s from pool (pool size now: %d)"), 
                    *EnemyType.ToString(), TypePool->Num());
@@ -63,6 +68,8 @@ AEnemyBase* UEnemyPoolSubsystem::GetFromPool(FName EnemyType, TSubclassOf<AEnemy
     if (NewEnemy)
     {
         ActiveEnemies.Add(NewEnemy, EnemyType);
+        INC_DWORD_STAT(STAT_VazioPoolMisses);
+        UpdateActiveStats();
         UE_LOG(LogEnemySpawn, VeryVerbose, TEXT("Created new %s (pool was empty)"), *EnemyType.ToString());
     }
     
@@ -71,6 +78,8 @@ AEnemyBase* UEnemyPoolSubsystem::GetFromPool(FName EnemyType, TSubclassOf<AEnemy
 
 void UEnemyPoolSubsystem::ReturnToPool(AEnemyBase* Enemy)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioPoolRelease);
+
     if (!IsValid(Enemy))
     {
         return;
@@ -87,6 +96,7 @@ void UEnemyPoolSubsystem::ReturnToPool(AEnemyBase* Enemy)
     // Remove from active tracking
     FName TypeName = *EnemyType;
     ActiveEnemies.Remove(Enemy);
+    UpdateActiveStats();
     
     // Check if pool has space
     TArray<AEnemyBase*>& TypePool = PooledEnemies.FindOrAdd(TypeName);
@@ -105,8 +115,8 @@ void UEnemyPoolSubsystem::ReturnToPool(AEnemyBase* Enemy)
     Enemy->SetActorLocation(FVector::ZeroVector);
     Enemy->SetActorRotation(FRotator::ZeroRotator);
     
-    // Clear any timers or states
-    // This would be enemy-specific cleanup
+    // Clear any timers or states (stale cooldown handles become no-ops after this)
+    Enemy->ResetCooldowns();
     
     // Add to pool
     TypePool.Add(Enemy);
@@ -115,6 +125,23 @@ void UEnemyPoolSubsystem::ReturnToPool(AEnemyBase* Enemy)
            *TypeName.ToString(), TypePool.Num());
 }
 
+void UEnemyPoolSubsystem::UpdateActiveStats()
+{
+    ActiveHighWater = FMath::Max(ActiveHighWater, ActiveEnemies.Num());
+    SET_DWORD_STAT(STAT_VazioPoolActive, ActiveEnemies.Num());
+    SET_DWORD_STAT(STAT_VazioPoolHighWater, ActiveHighWater);
+}
+
+int32 UEnemyPoolSubsystem::GetNumPooled() const
+{
+    int32 Total = 0;
+    for (const auto& PoolPair : PooledEnemies)
+    {
+        Total += PoolPair.Value.Num();
+    }
+    return Total;
+}
+
 void UEnemyPoolSubsystem::ClearPool()
 {
     // Destroy all pooled enemies
@@ -139,6 +166,7 @@ void UEnemyPoolSubsystem::ClearPool()
         }
     }
     ActiveEnemies.Empty();
+    UpdateActiveStats();
     
     UE_LOG(LogEnemySpawn, Log, TEXT("Cleared enemy pool"));
 }
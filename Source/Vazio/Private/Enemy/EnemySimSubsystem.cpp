@@ -0,0 +1,271 @@
+#include "Enemy/EnemySimSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemyBase.h"
+#include "Enemy/EnemyTypes.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+
+static TAutoConsoleVariable<int32> CVarEnemySimParallel(
+    TEXT("Enemy.Sim.Parallel"),
+    1,
+    TEXT("1 = simulação da horda em worker threads (ParallelFor), 0 = força single thread. O resultado é idêntico."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEnemySimChunkSize(
+    TEXT("Enemy.Sim.ChunkSize"),
+    64,
+    TEXT("Inimigos por bloco de trabalho do ParallelFor."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEnemySimSeparationRadius(
+    TEXT("Enemy.Sim.SeparationRadius"),
+    150.f,
+    TEXT("Raio (uu) de separação entre inimigos."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEnemySimSeparationWeight(
+    TEXT("Enemy.Sim.SeparationWeight"),
+    0.6f,
+    TEXT("Peso da separação em relação à perseguição."),
+    ECVF_Default);
+
+void UEnemySimSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    BucketStart.SetNumZeroed(NumCellBuckets + 1);
+    BucketCursor.SetNumZeroed(NumCellBuckets);
+
+    UE_LOG(LogEnemy, Log, TEXT("EnemySimSubsystem initialized"));
+}
+
+void UEnemySimSubsystem::Deinitialize()
+{
+    for (AEnemyBase* Enemy : Enemies)
+    {
+        if (Enemy)
+        {
+            Enemy->SimIndex = INDEX_NONE;
+        }
+    }
+    Enemies.Empty();
+    Outputs[0].Empty();
+    Outputs[1].Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UEnemySimSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySimSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemySimSubsystem::RegisterEnemy(AEnemyBase* Enemy)
+{
+    if (!Enemy || Enemy->SimIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    Enemy->SimIndex = Enemies.Add(Enemy);
+    Outputs[0].AddDefaulted();
+    Outputs[1].AddDefaulted();
+}
+
+void UEnemySimSubsystem::UnregisterEnemy(AEnemyBase* Enemy)
+{
+    if (!Enemy || !Enemies.IsValidIndex(Enemy->SimIndex) || Enemies[Enemy->SimIndex] != Enemy)
+    {
+        return;
+    }
+
+    const int32 Index = Enemy->SimIndex;
+    Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Outputs[0].RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Outputs[1].RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Enemies.IsValidIndex(Index))
+    {
+        Enemies[Index]->SimIndex = Index;
+    }
+    Enemy->SimIndex = INDEX_NONE;
+}
+
+const FEnemySimOutput* UEnemySimSubsystem::GetOutput(const AEnemyBase* Enemy) const
+{
+    if (!Enemy || !Outputs[FrontIndex].IsValidIndex(Enemy->SimIndex))
+    {
+        return nullptr;
+    }
+
+    const FEnemySimOutput& Output = Outputs[FrontIndex][Enemy->SimIndex];
+    return Output.bValid ? &Output : nullptr;
+}
+
+void UEnemySimSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioHordeSim);
+    Super::Tick(DeltaTime);
+
+    const int32 NumEnemies = Enemies.Num();
+    SET_DWORD_STAT(STAT_VazioLiveEnemies, NumEnemies);
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    if (NumEnemies == 0 || !PlayerPawn)
+    {
+        return;
+    }
+
+    FSimParams Params;
+    Params.PlayerLocation = PlayerPawn->GetActorLocation();
+    Params.SeparationRadius = FMath::Max(1.f, CVarEnemySimSeparationRadius.GetValueOnGameThread());
+    Params.SeparationWeight = CVarEnemySimSeparationWeight.GetValueOnGameThread();
+
+    // Game thread: snapshot + grid (ordem por índice, estável)
+    CellSize = Params.SeparationRadius;
+    GatherInputs();
+    BuildNeighbourGrid();
+
+    // Workers: cada bloco escreve só nos próprios slots do back buffer
+    TArray<FEnemySimOutput>& Back = Outputs[1 - FrontIndex];
+    const int32 ChunkSize = FMath::Max(8, CVarEnemySimChunkSize.GetValueOnGameThread());
+    const int32 NumChunks = FMath::DivideAndRoundUp(NumEnemies, ChunkSize);
+    const bool bParallel = CVarEnemySimParallel.GetValueOnGameThread() != 0 && NumChunks > 1;
+
+    ParallelFor(NumChunks, [this, &Params, &Back, ChunkSize, NumEnemies](int32 ChunkIndex)
+    {
+        const int32 Begin = ChunkIndex * ChunkSize;
+        const int32 End = FMath::Min(Begin + ChunkSize, NumEnemies);
+        SimulateRange(Begin, End, Params, Back);
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    // Atores leem o novo front no próximo tick
+    FrontIndex = 1 - FrontIndex;
+}
+
+void UEnemySimSubsystem::GatherInputs()
+{
+    const int32 NumEnemies = Enemies.Num();
+    const float InvCellSize = 1.f / CellSize;
+
+    Positions.SetNumUninitialized(NumEnemies, EAllowShrinking::No);
+    Cells.SetNumUninitialized(NumEnemies, EAllowShrinking::No);
+    Buckets.SetNumUninitialized(NumEnemies, EAllowShrinking::No);
+    ActiveFlags.SetNumUninitialized(NumEnemies, EAllowShrinking::No);
+
+    for (int32 i = 0; i < NumEnemies; ++i)
+    {
+        const AEnemyBase* Enemy = Enemies[i];
+        // Inimigos no pool ficam escondidos e sem tick: fora da simulação
+        const bool bActive = IsValid(Enemy) && !Enemy->IsHidden() && Enemy->IsActorTickEnabled();
+        ActiveFlags[i] = bActive ? 1 : 0;
+        if (!bActive)
+        {
+            Buckets[i] = INDEX_NONE;
+            continue;
+        }
+
+        const FVector Location = Enemy->GetActorLocation();
+        const FIntPoint Cell(FMath::FloorToInt(Location.X * InvCellSize), FMath::FloorToInt(Location.Y * InvCellSize));
+        Positions[i] = Location;
+        Cells[i] = Cell;
+        Buckets[i] = HashCell(Cell.X, Cell.Y);
+    }
+}
+
+void UEnemySimSubsystem::BuildNeighbourGrid()
+{
+    const int32 NumEnemies = Enemies.Num();
+    SortedIndices.SetNumUninitialized(NumEnemies, EAllowShrinking::No);
+    FMemory::Memzero(BucketStart.GetData(), BucketStart.Num() * sizeof(int32));
+
+    for (int32 i = 0; i < NumEnemies; ++i)
+    {
+        if (Buckets[i] != INDEX_NONE)
+        {
+            ++BucketStart[Buckets[i] + 1];
+        }
+    }
+
+    for (int32 b = 0; b < NumCellBuckets; ++b)
+    {
+        BucketStart[b + 1] += BucketStart[b];
+        BucketCursor[b] = BucketStart[b];
+    }
+
+    // Counting sort estável: dentro de cada bucket os índices ficam em ordem crescente
+    for (int32 i = 0; i < NumEnemies; ++i)
+    {
+        if (Buckets[i] != INDEX_NONE)
+        {
+            SortedIndices[BucketCursor[Buckets[i]]++] = i;
+        }
+    }
+}
+
+void UEnemySimSubsystem::SimulateRange(int32 Begin, int32 End, const FSimParams& Params, TArray<FEnemySimOutput>& Out) const
+{
+    const float RadiusSq = FMath::Square(Params.SeparationRadius);
+
+    for (int32 i = Begin; i < End; ++i)
+    {
+        FEnemySimOutput& Result = Out[i];
+        if (!ActiveFlags[i])
+        {
+            Result = FEnemySimOutput();
+            continue;
+        }
+
+        const FVector MyLocation = Positions[i];
+        FVector ToPlayer = Params.PlayerLocation - MyLocation;
+        ToPlayer.Z = 0.f;
+        const float DistanceToPlayer = ToPlayer.Size();
+        const FVector Chase = DistanceToPlayer > KINDA_SMALL_NUMBER ? ToPlayer / DistanceToPlayer : FVector::ZeroVector;
+
+        // Separação: vizinhos nas 3x3 células, sempre na mesma ordem
+        FVector Separation = FVector::ZeroVector;
+        const FIntPoint MyCell = Cells[i];
+        for (int32 dx = -1; dx <= 1; ++dx)
+        {
+            for (int32 dy = -1; dy <= 1; ++dy)
+            {
+                const FIntPoint Cell(MyCell.X + dx, MyCell.Y + dy);
+                const int32 Bucket = HashCell(Cell.X, Cell.Y);
+                for (int32 k = BucketStart[Bucket]; k < BucketStart[Bucket + 1]; ++k)
+                {
+                    const int32 j = SortedIndices[k];
+                    if (j == i || Cells[j] != Cell)
+                    {
+                        continue;
+                    }
+
+                    FVector Away = MyLocation - Positions[j];
+                    Away.Z = 0.f;
+                    const float DistSq = Away.SizeSquared();
+                    if (DistSq >= RadiusSq)
+                    {
+                        continue;
+                    }
+
+                    if (DistSq > KINDA_SMALL_NUMBER)
+                    {
+                        const float Dist = FMath::Sqrt(DistSq);
+                        Separation += (Away / Dist) * (1.f - Dist / Params.SeparationRadius);
+                    }
+                    else
+                    {
+                        // Sobrepostos: direção derivada dos índices (determinística)
+                        const float Angle = static_cast<float>(i * 7 + j * 13) * 0.61803398875f * 2.f * PI;
+                        Separation += FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f);
+                    }
+                }
+            }
+        }
+
+        FVector Steer = Chase + Separation * Params.SeparationWeight;
+        Steer.Z = 0.f;
+
+        Result.SteerDirection = Steer.GetSafeNormal();
+        Result.DistanceToPlayer = DistanceToPlayer;
+        Result.bValid = true;
+    }
+}
@@ -4,6 +4,9 @@
 #include "Enemy/EnemyConfig.h"
 #include "Engine/World.h"
 #include "Enemy/EnemyTypes.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 USpawnTimeline* UEnemySpawnHelper::CreateTimelineFromJSON(const FString& JSONString)
 {
@@ -20,6 +23,40 @@ USpawnTimeline* UEnemySpawnHelper::CreateTimelineFromJSON(const FString& JSONStr
     }
 }
 
+USpawnTimeline* UEnemySpawnHelper::LoadTimelineFile(const FString& Path)
+{
+    const FString FullPath = FPaths::IsRelative(Path) ? FPaths::Combine(FPaths::ProjectContentDir(), Path) : Path;
+    const FString BinaryPath = FPaths::ChangeExtension(FullPath, USpawnTimeline::BinaryExtension);
+    const FString JSONPath = FPaths::ChangeExtension(FullPath, TEXT(".json"));
+
+    IFileManager& FileManager = IFileManager::Get();
+    const FDateTime BinaryStamp = FileManager.GetTimeStamp(*BinaryPath);
+    const FDateTime JSONStamp = FileManager.GetTimeStamp(*JSONPath);
+
+    // JSON editado depois do último cook: o binário está velho
+    if (BinaryStamp != FDateTime::MinValue() && BinaryStamp >= JSONStamp)
+    {
+        TArray<uint8> Bytes;
+        USpawnTimeline* Timeline = NewObject<USpawnTimeline>();
+        if (FFileHelper::LoadFileToArray(Bytes, *BinaryPath) && Timeline->LoadFromBinary(Bytes))
+        {
+            UE_LOG(LogEnemySpawn, Log, TEXT("Loaded timeline %s (%d bytes, %d events, %d boss events)"),
+                   *BinaryPath, Bytes.Num(), Timeline->Events.Num(), Timeline->BossEvents.Num());
+            return Timeline;
+        }
+    }
+
+    FString JSON;
+    if (JSONStamp == FDateTime::MinValue() || !FFileHelper::LoadFileToString(JSON, *JSONPath))
+    {
+        UE_LOG(LogEnemySpawn, Error, TEXT("Timeline not found: %s"), *FullPath);
+        return nullptr;
+    }
+
+    UE_LOG(LogEnemySpawn, Warning, TEXT("Timeline %s parsed from JSON at runtime; run -run=CookSpawnTimelines to build the .vtl"), *JSONPath);
+    return CreateTimelineFromJSON(JSON);
+}
+
 FString UEnemySpawnHelper::GetExampleJSON()
 {
     return TEXT(R"({
@@ -66,7 +103,7 @@ FString UEnemySpawnHelper::GetExampleJSON()
 })");
 }
 
-void UEnemySpawnHelper::StartSpawnTimeline(UObject* WorldContext, USpawnTimeline* Timeline, int32 Seed)
+void UEnemySpawnHelper::StartSpawnTimeline(UObject* WorldContext, USpawnTimeline* Timeline, int32 Seed, float StartSeconds)
 {
     if (!WorldContext || !Timeline)
     {
@@ -96,7 +133,7 @@ void UEnemySpawnHelper::StartSpawnTimeline(UObject* WorldContext, USpawnTimeline
         UE_LOG(LogEnemySpawn, Log, TEXT("Created and set default enemy config"));
     }
     
-    SpawnerSubsystem->StartTimeline(Timeline, Seed);
+    SpawnerSubsystem->StartTimelineAt(Timeline, StartSeconds, Seed);
 }
 
 void UEnemySpawnHelper::QuickSpawnEnemies(UObject* WorldContext, const FString& JSONString, int32 Seed)
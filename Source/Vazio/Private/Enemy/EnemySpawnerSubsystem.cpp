@@ -1,24 +1,104 @@
-#include "Enemy/EnemySpawnerSubsystem.h"
+﻿#include "Enemy/EnemySpawnerSubsystem.h"
+#include "Core/VazioStats.h"
 #include "Enemy/EnemyConfig.h"
 #include "Enemy/SpawnTimeline.h"
+#include "Enemy/EnemySpawnHelper.h"
 #include "Enemy/EnemyBase.h"
+#include "Enemy/EnemyPoolSubsystem.h"
 #include "Enemy/Types/NormalEnemy.h"
 #include "Enemy/Types/HeavyEnemy.h"
 #include "Enemy/Types/RangedEnemy.h"
 #include "Enemy/Types/DashEnemy.h"
 #include "Enemy/Types/AuraEnemy.h"
 #include "Enemy/Types/SplitterSlime.h"
+#include "Testing/TimelineSimulator.h"
 #include "Enemy/Types/GoldEnemy.h"
 #include "Enemy/Types/BossEnemy.h"
 #include "Enemy/Types/VoidQueenBoss.h"
 #include "Enemy/Types/FallenWarlordBoss.h"
+#include "Core/GameplayTrace.h"
 #include "Enemy/Types/BurrowerBoss.h"
 #include "Enemy/Types/HybridDemonBoss.h"
 #include "Engine/World.h"
+#include "EngineUtils.h"
 #include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "NavigationSystem.h"
 #include "Sound/SoundBase.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+static TAutoConsoleVariable<int32> CVarDeferredSpawnBudget(
+    TEXT("Enemy.DeferredSpawnBudget"),
+    6,
+    TEXT("Máximo de spawns adiados (ex.: filhos de SplitterSlime) executados por frame."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMaxSplitChildren(
+    TEXT("Enemy.MaxSplitChildren"),
+    60,
+    TEXT("Teto global de filhos de split vivos + enfileirados. Splits acima disso são descartados."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBossMaxMinionsPerBoss(
+    TEXT("Enemy.Boss.MaxMinionsPerBoss"),
+    16,
+    TEXT("Teto de lacaios vivos invocados por um mesmo boss (-1 = sem teto)."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBossMaxMinions(
+    TEXT("Enemy.Boss.MaxMinions"),
+    32,
+    TEXT("Teto global de lacaios de boss vivos (-1 = sem teto)."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarBossMinionOverflowBuff(
+    TEXT("Enemy.Boss.MinionOverflowBuff"),
+    0.25f,
+    TEXT("Fração do HP base somada a um lacaio vivo para cada invocação negada pelo orçamento (0 = só descarta)."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHotReload(
+    TEXT("Enemy.HotReload"),
+    1,
+    TEXT("Recarrega timeline/overrides de config observados quando o arquivo muda (polling de timestamp)."),
+    ECVF_Default);
+
+static constexpr float HotReloadPollInterval = 0.5f;
+
+static FString ResolveContentPath(const FString& Path)
+{
+    return FPaths::IsRelative(Path) ? FPaths::Combine(FPaths::ProjectContentDir(), Path) : Path;
+}
+
+// O .vtl do cook e o JSON contam: qualquer um mais novo dispara o reload
+static FDateTime GetTimelineSourceStamp(const FString& Path)
+{
+    const FString FullPath = ResolveContentPath(Path);
+    IFileManager& FileManager = IFileManager::Get();
+    return FMath::Max(FileManager.GetTimeStamp(*FPaths::ChangeExtension(FullPath, TEXT(".json"))),
+                      FileManager.GetTimeStamp(*FPaths::ChangeExtension(FullPath, USpawnTimeline::BinaryExtension)));
+}
+
+// Pareia por conteúdo (todas as UPROPERTYs) uma entrada agendada com a primeira igual ainda livre na nova versão
+template <typename EntryType>
+static int32 FindUnmatchedEntry(const TArray<EntryType>& Entries, const TArray<bool>& Matched, const EntryType& Entry)
+{
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        if (!Matched[i] && EntryType::StaticStruct()->CompareScriptStruct(&Entries[i], &Entry, PPF_None))
+        {
+            return i;
+        }
+    }
+    return INDEX_NONE;
+}
 
 void UEnemySpawnerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -32,109 +112,621 @@ void UEnemySpawnerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     bRegularSpawnsPaused = false;
     DeferredEvents.Empty();
 
+    PendingSpawns.Reset();
+    LiveSplitChildren = 0;
+    QueuedSplitChildren = 0;
+    BossMinions.Reset();
+    DeniedBossMinions = 0;
+    PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UEnemySpawnerSubsystem::HandlePostActorTick);
+
+    // Ticker de core: continua verificando com o jogo pausado
+    HotReloadTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UEnemySpawnerSubsystem::HotReloadTick), HotReloadPollInterval);
+#if WITH_EDITOR
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UEnemySpawnerSubsystem::HandleObjectPropertyChanged);
+#endif
+    SyncLoadHandle = FCoreDelegates::OnSyncLoadPackage.AddUObject(this, &UEnemySpawnerSubsystem::HandleSyncLoadPackage);
+
     UE_LOG(LogEnemySpawn, Log, TEXT("EnemySpawnerSubsystem initialized"));
 }
 
 void UEnemySpawnerSubsystem::Deinitialize()
 {
-    if (UWorld* World = GetWorld())
+    ClearScheduledTimers();
+    DeferredEvents.Empty();
+
+    FTSTicker::GetCoreTicker().RemoveTicker(HotReloadTickerHandle);
+    HotReloadTickerHandle.Reset();
+#if WITH_EDITOR
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    ObjectPropertyChangedHandle.Reset();
+#endif
+    TimelineSourcePath.Reset();
+    ConfigOverridesPath.Reset();
+
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+    PostActorTickHandle.Reset();
+    PendingSpawns.Empty();
+    LiveSplitChildren = 0;
+    QueuedSplitChildren = 0;
+    BossMinions.Empty();
+
+    ClearBossDelegates();
+    ActiveBoss = nullptr;
+    bBossEncounterActive = false;
+    bRegularSpawnsPaused = false;
+
+    FCoreDelegates::OnSyncLoadPackage.Remove(SyncLoadHandle);
+    SyncLoadHandle.Reset();
+    bTrackSyncLoads = false;
+    ReleaseBossPreload();
+
+    Super::Deinitialize();
+}
+
+void UEnemySpawnerSubsystem::StartTimeline(const USpawnTimeline* Timeline, int32 Seed)
+{
+    StartTimelineAt(Timeline, 0.f, Seed, false);
+}
+
+void UEnemySpawnerSubsystem::StartTimelineAt(const USpawnTimeline* Timeline, float StartSeconds, int32 Seed, bool bPrepopulate)
+{
+    if (!Timeline)
+    {
+        UE_LOG(LogEnemySpawn, Error, TEXT("StartTimeline called with null timeline"));
+        return;
+    }
+
+    StartSeconds = FMath::Max(0.f, StartSeconds);
+
+    // Modelo de abate do simulador até StartSeconds; -DPS= etc. na linha de comando ajustam o modelo
+    FTimelineSimReport SimReport;
+    const bool bSimulate = bPrepopulate && StartSeconds > 0.f && CurrentEnemyConfig;
+    if (bSimulate)
+    {
+        FTimelineSimSettings SimSettings;
+        SimSettings.ParseFromCommandLine(FCommandLine::Get());
+        SimSettings.StopAtSeconds = StartSeconds;
+        FTimelineSimulator::Run(*Timeline, *CurrentEnemyConfig, SimSettings, SimReport);
+    }
+
+    // Outra timeline iniciada direto (asset/JSON embutido) não tem arquivo observado; seek na mesma mantém
+    if (Timeline != ActiveTimeline)
+    {
+        TimelineSourcePath.Reset();
+    }
+
+    ActiveTimeline = Timeline;
+    TimelineStartSeconds = (GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0) - StartSeconds;
+    bTimelinePaused = false;
+    if (GetWorld())
+    {
+        GetWorld()->GetTimerManager().ClearTimer(TimelineStepHandle);
+    }
+
+    if (Seed != 0)
+    {
+        SpawnRng.Initialize(Seed);
+        UE_LOG(LogEnemySpawn, Log, TEXT("Using deterministic seed %d for spawn timeline"), Seed);
+    }
+
+    ClearScheduledTimers();
+    DeferredEvents.Empty();
+
+    // Fila e minions do trecho anterior não pertencem ao novo ponto da timeline
+    PendingSpawns.Reset();
+    QueuedSplitChildren = 0;
+    BossMinions.Reset();
+    DeniedBossMinions = 0;
+    SET_DWORD_STAT(STAT_VazioDeferredQueue, 0);
+    SET_DWORD_STAT(STAT_VazioBossMinions, 0);
+    SET_DWORD_STAT(STAT_VazioBossMinionsDenied, 0);
+
+    ClearBossDelegates();
+    ActiveBoss = nullptr;
+    bBossEncounterActive = false;
+    bRegularSpawnsPaused = false;
+    ActiveBossEntry = FBossSpawnEntry();
+
+    // Num seek, o que vence até StartSeconds já "aconteceu" (e está na população do simulador)
+    for (const FSpawnEvent& Event : Timeline->Events)
     {
-        for (FTimerHandle& Handle : ScheduledTimers)
+        if (StartSeconds <= 0.f || Event.TimeSeconds > StartSeconds)
         {
-            if (Handle.IsValid())
+            ScheduleEvent(Event, StartSeconds);
+        }
+    }
+
+    for (const FBossSpawnEntry& BossEvent : Timeline->BossEvents)
+    {
+        if (StartSeconds <= 0.f || BossEvent.TimeSeconds > StartSeconds)
+        {
+            ScheduleBossEvent(BossEvent, StartSeconds);
+        }
+    }
+
+    if (bSimulate)
+    {
+        PrepopulateFromSimulation(SimReport);
+    }
+
+    UE_LOG(LogEnemySpawn, Log, TEXT("Started spawn timeline at %.1fs with %d events and %d boss events"),
+           StartSeconds, Timeline->Events.Num(), Timeline->BossEvents.Num());
+}
+
+void UEnemySpawnerSubsystem::PrepopulateFromSimulation(const FTimelineSimReport& Report)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioSpawnEvents);
+
+    // Boss primeiro: BeginBossEncounter liga a pausa de spawns e os delegates como num spawn normal
+    if (Report.bBossActive)
+    {
+        BeginBossEncounter(Report.ActiveBossEntry);
+        if (ABossEnemy* Boss = ActiveBoss.Get())
+        {
+            Boss->SetHealthFraction(Report.ActiveBossHealthFraction);
+            OnBossHealthChanged.Broadcast(Boss->GetHealthFraction(), Boss);
+        }
+    }
+    else if (Report.ResumeInSeconds > 0.f)
+    {
+        PauseRegularSpawns();
+        ResumeRegularSpawns(Report.ResumeInSeconds);
+    }
+    DeferredEvents.Append(Report.HeldEvents);
+
+    const ASplitterSlime* Splitter = GetDefault<ASplitterSlime>();
+    int32 Spawned = 0;
+    for (const FTimelineSimLiveEnemy& Live : Report.LiveEnemies)
+    {
+        FVector Location;
+        if (!FindSpawnPointLinear(Location))
+        {
+            continue;
+        }
+        const FTransform Transform(FRotator::ZeroRotator, Location);
+
+        AEnemyBase* Enemy = nullptr;
+        if (Live.bSplitChild)
+        {
+            // Mesmo caminho dos spawns adiados: pool + arquétipo derivado do pai
+            const FEnemyArchetype* ParentArchetype = CurrentEnemyConfig->GetArchetype(Live.Type);
+            Enemy = ParentArchetype ? AcquirePooledEnemy(Live.Type, Transform) : nullptr;
+            if (Enemy)
             {
-                World->GetTimerManager().ClearTimer(Handle);
+                Enemy->bIsParent = false;
+                Enemy->ApplyArchetypeAndModifiers(Splitter->MakeChildArchetype(*ParentArchetype), Live.Mods);
+                Enemy->bIsSplitChild = true;
+                ++LiveSplitChildren;
             }
         }
-
-        for (FTimerHandle& Handle : ScheduledBossTimers)
+        else
         {
-            if (Handle.IsValid())
+            Enemy = SpawnOne(Live.Type, Transform, Live.Mods);
+            if (Enemy && Live.bBossMinion)
             {
-                World->GetTimerManager().ClearTimer(Handle);
+                TrackBossMinion(Enemy, ActiveBoss.Get());
             }
         }
 
-        if (BossResumeHandle.IsValid())
+        if (Enemy)
         {
-            World->GetTimerManager().ClearTimer(BossResumeHandle);
+            Enemy->SetHealthFraction(Live.HealthFraction);
+            ++Spawned;
         }
     }
 
-    ScheduledTimers.Empty();
-    ScheduledBossTimers.Empty();
-    DeferredEvents.Empty();
+    UE_LOG(LogEnemySpawn, Log, TEXT("Seek prepopulated %d/%d enemies, boss %s, %d held events"),
+           Spawned, Report.LiveEnemies.Num(), Report.bBossActive ? *Report.ActiveBossEntry.BossType.ToString() : TEXT("none"),
+           Report.HeldEvents.Num());
+}
 
-    ClearBossDelegates();
-    ActiveBoss = nullptr;
-    bBossEncounterActive = false;
-    bRegularSpawnsPaused = false;
+void UEnemySpawnerSubsystem::SetScheduledTimersPaused(bool bPaused)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
 
-    Super::Deinitialize();
+    FTimerManager& TimerManager = World->GetTimerManager();
+    auto Apply = [&TimerManager, bPaused](FTimerHandle& Handle)
+    {
+        if (bPaused)
+        {
+            TimerManager.PauseTimer(Handle);
+        }
+        else
+        {
+            TimerManager.UnPauseTimer(Handle);
+        }
+    };
+
+    for (FScheduledSpawnEvent& Scheduled : ScheduledEvents)
+    {
+        Apply(Scheduled.Timer);
+    }
+    for (FScheduledBossEvent& Scheduled : ScheduledBosses)
+    {
+        Apply(Scheduled.WarningTimer);
+        Apply(Scheduled.SpawnTimer);
+    }
+    Apply(BossResumeHandle);
 }
 
-void UEnemySpawnerSubsystem::StartTimeline(const USpawnTimeline* Timeline, int32 Seed)
+void UEnemySpawnerSubsystem::PauseTimeline()
 {
-    if (!Timeline)
+    UWorld* World = GetWorld();
+    if (!World || !ActiveTimeline || bTimelinePaused)
     {
-        UE_LOG(LogEnemySpawn, Error, TEXT("StartTimeline called with null timeline"));
         return;
     }
 
-    ActiveTimeline = Timeline;
+    bTimelinePaused = true;
+    TimelinePausedAtSeconds = World->GetTimeSeconds();
+    World->GetTimerManager().ClearTimer(TimelineStepHandle);
+    SetScheduledTimersPaused(true);
+    UE_LOG(LogEnemySpawn, Log, TEXT("Timeline paused at %.1fs"), GetTimelineTime());
+}
 
-    if (Seed != 0)
+void UEnemySpawnerSubsystem::ResumeTimeline()
+{
+    UWorld* World = GetWorld();
+    if (!World || !bTimelinePaused)
     {
-        SpawnRng.Initialize(Seed);
-        UE_LOG(LogEnemySpawn, Log, TEXT("Using deterministic seed %d for spawn timeline"), Seed);
+        return;
+    }
+
+    // O tempo parado não conta como tempo de timeline
+    TimelineStartSeconds += World->GetTimeSeconds() - TimelinePausedAtSeconds;
+    bTimelinePaused = false;
+    World->GetTimerManager().ClearTimer(TimelineStepHandle);
+    SetScheduledTimersPaused(false);
+    UE_LOG(LogEnemySpawn, Log, TEXT("Timeline resumed at %.1fs"), GetTimelineTime());
+}
+
+void UEnemySpawnerSubsystem::StepTimeline(float Seconds)
+{
+    UWorld* World = GetWorld();
+    if (!World || !ActiveTimeline || Seconds <= 0.f)
+    {
+        return;
+    }
+
+    ResumeTimeline();
+    World->GetTimerManager().SetTimer(TimelineStepHandle, this, &UEnemySpawnerSubsystem::PauseTimeline, Seconds, false);
+}
+
+void UEnemySpawnerSubsystem::SetPlaybackSpeed(float Speed)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // AWorldSettings limita a [MinGlobalTimeDilation, MaxGlobalTimeDilation] (20x por padrão)
+    UGameplayStatics::SetGlobalTimeDilation(World, FMath::Max(0.01f, Speed));
+    UE_LOG(LogEnemySpawn, Log, TEXT("Playback speed %.2fx"), UGameplayStatics::GetGlobalTimeDilation(World));
+}
+
+float UEnemySpawnerSubsystem::GetTimelineTime() const
+{
+    const UWorld* World = GetWorld();
+    if (!ActiveTimeline || !World)
+    {
+        return -1.f;
     }
+    const double Now = bTimelinePaused ? TimelinePausedAtSeconds : World->GetTimeSeconds();
+    return static_cast<float>(Now - TimelineStartSeconds);
+}
 
+void UEnemySpawnerSubsystem::ClearScheduledTimers()
+{
     if (UWorld* World = GetWorld())
     {
-        for (FTimerHandle& Handle : ScheduledTimers)
+        FTimerManager& TimerManager = World->GetTimerManager();
+        for (FScheduledSpawnEvent& Scheduled : ScheduledEvents)
+        {
+            TimerManager.ClearTimer(Scheduled.Timer);
+        }
+
+        for (FScheduledBossEvent& Scheduled : ScheduledBosses)
+        {
+            TimerManager.ClearTimer(Scheduled.WarningTimer);
+            TimerManager.ClearTimer(Scheduled.SpawnTimer);
+        }
+
+        TimerManager.ClearTimer(BossResumeHandle);
+    }
+
+    ScheduledEvents.Empty();
+    ScheduledBosses.Empty();
+
+    // Aviso já disparado de um boss que não vai mais nascer
+    if (!bBossEncounterActive)
+    {
+        ReleaseBossPreload();
+    }
+}
+
+bool UEnemySpawnerSubsystem::StartTimelineFromFile(const FString& Path, int32 Seed, float StartSeconds, bool bPrepopulate)
+{
+    USpawnTimeline* Timeline = UEnemySpawnHelper::LoadTimelineFile(Path);
+    if (!Timeline)
+    {
+        return false;
+    }
+
+    StartTimelineAt(Timeline, StartSeconds, Seed, bPrepopulate);
+    TimelineSourcePath = Path;
+    TimelineSourceStamp = GetTimelineSourceStamp(Path);
+    UE_LOG(LogEnemySpawn, Log, TEXT("Watching timeline %s for changes"), *Path);
+    return true;
+}
+
+void UEnemySpawnerSubsystem::ReloadTimeline(const USpawnTimeline* NewTimeline)
+{
+    UWorld* World = GetWorld();
+    if (!NewTimeline || !World)
+    {
+        return;
+    }
+
+    if (!ActiveTimeline)
+    {
+        StartTimeline(NewTimeline);
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    const float Elapsed = GetTimelineTime();
+
+    // Agendados que já dispararam saem da lista; os pendentes são pareados com a nova versão
+    TArray<bool> EventMatched;
+    EventMatched.SetNumZeroed(NewTimeline->Events.Num());
+    int32 EventsKept = 0;
+    int32 EventsRemoved = 0;
+    for (int32 i = ScheduledEvents.Num() - 1; i >= 0; --i)
+    {
+        FScheduledSpawnEvent& Scheduled = ScheduledEvents[i];
+        if (TimerManager.TimerExists(Scheduled.Timer))
         {
-            if (Handle.IsValid())
+            const int32 Match = FindUnmatchedEntry(NewTimeline->Events, EventMatched, Scheduled.Event);
+            if (Match != INDEX_NONE)
             {
-                World->GetTimerManager().ClearTimer(Handle);
+                EventMatched[Match] = true;
+                ++EventsKept;
+                continue;
             }
+
+            TimerManager.ClearTimer(Scheduled.Timer);
+            ++EventsRemoved;
+        }
+        ScheduledEvents.RemoveAtSwap(i, 1, EAllowShrinking::No);
+    }
+
+    int32 EventsAdded = 0;
+    for (int32 i = 0; i < NewTimeline->Events.Num(); ++i)
+    {
+        if (!EventMatched[i] && NewTimeline->Events[i].TimeSeconds > Elapsed)
+        {
+            ScheduleEvent(NewTimeline->Events[i], Elapsed);
+            ++EventsAdded;
         }
+    }
 
-        for (FTimerHandle& Handle : ScheduledBossTimers)
+    TArray<bool> BossMatched;
+    BossMatched.SetNumZeroed(NewTimeline->BossEvents.Num());
+    int32 BossesKept = 0;
+    int32 BossesRemoved = 0;
+    for (int32 i = ScheduledBosses.Num() - 1; i >= 0; --i)
+    {
+        FScheduledBossEvent& Scheduled = ScheduledBosses[i];
+        if (TimerManager.TimerExists(Scheduled.SpawnTimer))
         {
-            if (Handle.IsValid())
+            const int32 Match = FindUnmatchedEntry(NewTimeline->BossEvents, BossMatched, Scheduled.Entry);
+            if (Match != INDEX_NONE)
             {
-                World->GetTimerManager().ClearTimer(Handle);
+                BossMatched[Match] = true;
+                ++BossesKept;
+                continue;
             }
+
+            TimerManager.ClearTimer(Scheduled.WarningTimer);
+            TimerManager.ClearTimer(Scheduled.SpawnTimer);
+            ++BossesRemoved;
         }
+        ScheduledBosses.RemoveAtSwap(i, 1, EAllowShrinking::No);
+    }
 
-        if (BossResumeHandle.IsValid())
+    int32 BossesAdded = 0;
+    for (int32 i = 0; i < NewTimeline->BossEvents.Num(); ++i)
+    {
+        if (!BossMatched[i] && NewTimeline->BossEvents[i].TimeSeconds > Elapsed)
         {
-            World->GetTimerManager().ClearTimer(BossResumeHandle);
+            ScheduleBossEvent(NewTimeline->BossEvents[i], Elapsed);
+            ++BossesAdded;
         }
     }
 
-    ScheduledTimers.Empty();
-    ScheduledBossTimers.Empty();
-    DeferredEvents.Empty();
+    ActiveTimeline = NewTimeline;
 
-    ClearBossDelegates();
-    ActiveBoss = nullptr;
-    bBossEncounterActive = false;
-    bRegularSpawnsPaused = false;
-    ActiveBossEntry = FBossSpawnEntry();
+    UE_LOG(LogEnemySpawn, Log, TEXT("Timeline reloaded at %.1fs: events kept=%d removed=%d added=%d, bosses kept=%d removed=%d added=%d"),
+           Elapsed, EventsKept, EventsRemoved, EventsAdded, BossesKept, BossesRemoved, BossesAdded);
+}
 
-    for (const FSpawnEvent& Event : Timeline->Events)
+void UEnemySpawnerSubsystem::ApplyEnemyConfigChange()
+{
+    if (!CurrentEnemyConfig)
     {
-        ScheduleEvent(Event);
+        return;
     }
 
-    for (const FBossSpawnEntry& BossEvent : Timeline->BossEvents)
+    TArray<FString> Changes;
+    for (const TPair<FName, FEnemyArchetype>& Pair : CurrentEnemyConfig->Archetypes)
+    {
+        const FEnemyArchetype* Previous = ArchetypeSnapshot.Find(Pair.Key);
+        if (!Previous)
+        {
+            Changes.Add(TEXT("+") + Pair.Key.ToString());
+        }
+        else if (!FEnemyArchetype::StaticStruct()->CompareScriptStruct(Previous, &Pair.Value, PPF_None))
+        {
+            Changes.Add(Pair.Key.ToString());
+        }
+    }
+
+    for (const TPair<FName, FEnemyArchetype>& Pair : ArchetypeSnapshot)
+    {
+        if (!CurrentEnemyConfig->Archetypes.Contains(Pair.Key))
+        {
+            Changes.Add(TEXT("-") + Pair.Key.ToString());
+        }
+    }
+
+    ArchetypeSnapshot = CurrentEnemyConfig->Archetypes;
+    if (Changes.Num() == 0)
+    {
+        return;
+    }
+
+    // Inimigos vivos e filhos de split já enfileirados mantêm o arquétipo com que nasceram
+    UE_LOG(LogEnemySpawn, Log, TEXT("EnemyConfig reloaded, changed archetypes: %s"), *FString::Join(Changes, TEXT(", ")));
+
+    TArray<FString> Errors;
+    if (ActiveTimeline && !ActiveTimeline->Validate(CurrentEnemyConfig, Errors))
+    {
+        for (const FString& Error : Errors)
+        {
+            UE_LOG(LogEnemySpawn, Warning, TEXT("Active timeline after config reload: %s"), *Error);
+        }
+    }
+}
+
+bool UEnemySpawnerSubsystem::WatchEnemyConfigOverrides(const FString& Path)
+{
+    if (!CurrentEnemyConfig)
+    {
+        UE_LOG(LogEnemySpawn, Error, TEXT("WatchEnemyConfigOverrides: no EnemyConfig set"));
+        return false;
+    }
+
+    // Asset compartilhado com o editor no PIE: os overrides vão numa cópia
+    if (CurrentEnemyConfig->IsAsset())
+    {
+        CurrentEnemyConfig = DuplicateObject<UEnemyConfig>(CurrentEnemyConfig, this);
+    }
+
+    ConfigOverridesBase = CurrentEnemyConfig->Archetypes;
+    ConfigOverridesPath = Path;
+    return ReloadConfigOverrides();
+}
+
+bool UEnemySpawnerSubsystem::ReloadTimelineFile()
+{
+    TimelineSourceStamp = GetTimelineSourceStamp(TimelineSourcePath);
+
+    USpawnTimeline* Timeline = UEnemySpawnHelper::LoadTimelineFile(TimelineSourcePath);
+    TArray<FString> Errors;
+    if (!Timeline || !Timeline->Validate(CurrentEnemyConfig, Errors))
+    {
+        for (const FString& Error : Errors)
+        {
+            UE_LOG(LogEnemySpawn, Error, TEXT("%s: %s"), *TimelineSourcePath, *Error);
+        }
+        UE_LOG(LogEnemySpawn, Warning, TEXT("Hot reload of %s rejected, keeping the running timeline"), *TimelineSourcePath);
+        return false;
+    }
+
+    ReloadTimeline(Timeline);
+    return true;
+}
+
+bool UEnemySpawnerSubsystem::ReloadConfigOverrides()
+{
+    const FString FullPath = ResolveContentPath(ConfigOverridesPath);
+    ConfigOverridesStamp = IFileManager::Get().GetTimeStamp(*FullPath);
+
+    FString JSON;
+    if (!CurrentEnemyConfig || !FFileHelper::LoadFileToString(JSON, *FullPath))
+    {
+        UE_LOG(LogEnemySpawn, Error, TEXT("Could not read enemy config overrides %s"), *FullPath);
+        return false;
+    }
+
+    // Sempre a partir da base: remover um campo do arquivo volta ao valor original
+    TMap<FName, FEnemyArchetype> Previous = CurrentEnemyConfig->Archetypes;
+    CurrentEnemyConfig->Archetypes = ConfigOverridesBase;
+
+    TArray<FString> Errors;
+    if (!CurrentEnemyConfig->ApplyOverridesFromJSON(JSON, &Errors))
+    {
+        CurrentEnemyConfig->Archetypes = MoveTemp(Previous);
+        for (const FString& Error : Errors)
+        {
+            UE_LOG(LogEnemySpawn, Error, TEXT("%s: %s"), *ConfigOverridesPath, *Error);
+        }
+        return false;
+    }
+
+    ApplyEnemyConfigChange();
+    return true;
+}
+
+void UEnemySpawnerSubsystem::ReloadWatchedSources()
+{
+    if (!TimelineSourcePath.IsEmpty())
+    {
+        ReloadTimelineFile();
+    }
+
+    if (!ConfigOverridesPath.IsEmpty())
+    {
+        ReloadConfigOverrides();
+    }
+}
+
+bool UEnemySpawnerSubsystem::HotReloadTick(float DeltaTime)
+{
+    if (CVarHotReload.GetValueOnGameThread() == 0)
+    {
+        return true;
+    }
+
+    // Config antes da timeline: a validação da timeline usa os arquétipos novos
+    if (!ConfigOverridesPath.IsEmpty() && IFileManager::Get().GetTimeStamp(*ResolveContentPath(ConfigOverridesPath)) > ConfigOverridesStamp)
+    {
+        ReloadConfigOverrides();
+    }
+
+    if (!TimelineSourcePath.IsEmpty() && GetTimelineSourceStamp(TimelineSourcePath) > TimelineSourceStamp)
+    {
+        ReloadTimelineFile();
+    }
+
+    return true;
+}
+
+#if WITH_EDITOR
+void UEnemySpawnerSubsystem::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    if (!Object)
     {
-        ScheduleBossEvent(BossEvent);
+        return;
     }
 
-    UE_LOG(LogEnemySpawn, Log, TEXT("Started spawn timeline with %d events and %d boss events"), Timeline->Events.Num(), Timeline->BossEvents.Num());
+    // Reimport/edição muda o asset no lugar; o diff compara com as cópias agendadas
+    if (Object == ActiveTimeline)
+    {
+        ReloadTimeline(ActiveTimeline);
+    }
+    else if (Object == CurrentEnemyConfig)
+    {
+        ApplyEnemyConfigChange();
+    }
 }
+#endif
 
 void UEnemySpawnerSubsystem::SpawnLinear(FName Type, int32 Count, const FEnemyInstanceModifiers& Mods)
 {
@@ -216,38 +808,205 @@ AEnemyBase* UEnemySpawnerSubsystem::SpawnOne(FName Type, const FTransform& Trans
     return NewEnemy;
 }
 
+bool UEnemySpawnerSubsystem::EnqueueDeferredSpawn(const FDeferredSpawnRequest& Request)
+{
+    if (Request.bSplitChild)
+    {
+        const int32 MaxSplitChildren = CVarMaxSplitChildren.GetValueOnGameThread();
+        if (MaxSplitChildren >= 0 && LiveSplitChildren + QueuedSplitChildren >= MaxSplitChildren)
+        {
+            UE_LOG(LogEnemySpawn, Verbose, TEXT("Split child dropped: cap %d reached (live=%d queued=%d)"),
+                   MaxSplitChildren, LiveSplitChildren, QueuedSplitChildren);
+            return false;
+        }
+        ++QueuedSplitChildren;
+    }
+
+    PendingSpawns.Add(Request);
+    SET_DWORD_STAT(STAT_VazioDeferredQueue, PendingSpawns.Num());
+    return true;
+}
+
+void UEnemySpawnerSubsystem::NotifySplitChildReleased()
+{
+    LiveSplitChildren = FMath::Max(0, LiveSplitChildren - 1);
+}
+
+int32 UEnemySpawnerSubsystem::SummonBossMinions(ABossEnemy* Boss, FName Type, int32 Count, float Radius, const FEnemyInstanceModifiers& Mods)
+{
+    if (!Boss || Type.IsNone() || Count <= 0)
+    {
+        return 0;
+    }
+
+    // Destruídos fora do ReleaseEnemy (fim de fase, editor) não avisam
+    BossMinions.RemoveAllSwap([](const FBossMinionEntry& Entry) { return !Entry.Minion.IsValid(); }, EAllowShrinking::No);
+
+    int32 Allowed = Count;
+    const int32 MaxPerBoss = CVarBossMaxMinionsPerBoss.GetValueOnGameThread();
+    if (MaxPerBoss >= 0)
+    {
+        Allowed = FMath::Min(Allowed, MaxPerBoss - GetNumBossMinionsFor(Boss));
+    }
+    const int32 MaxGlobal = CVarBossMaxMinions.GetValueOnGameThread();
+    if (MaxGlobal >= 0)
+    {
+        Allowed = FMath::Min(Allowed, MaxGlobal - BossMinions.Num());
+    }
+    Allowed = FMath::Max(0, Allowed);
+
+    const FVector Origin = Boss->GetActorLocation();
+    int32 Spawned = 0;
+    for (int32 Index = 0; Index < Allowed; ++Index)
+    {
+        const float Angle = (2.f * PI * Index) / Allowed;
+        const FVector SpawnLocation = Origin + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * Radius;
+        if (AEnemyBase* Minion = SpawnOne(Type, FTransform(Boss->GetActorRotation(), SpawnLocation), Mods))
+        {
+            TrackBossMinion(Minion, Boss);
+            ++Spawned;
+        }
+    }
+
+    const int32 Denied = Count - Allowed;
+    if (Denied > 0)
+    {
+        DeniedBossMinions += Denied;
+        INC_DWORD_STAT_BY(STAT_VazioBossMinionsDenied, Denied);
+
+        // Reforça os lacaios do próprio boss em rodízio; com o teto global tomado por outro boss pode não haver nenhum
+        const float Bonus = CVarBossMinionOverflowBuff.GetValueOnGameThread();
+        int32 Empowered = 0;
+        for (int32 Step = 0; Bonus > 0.f && Empowered < Denied && Step < BossMinions.Num() * Denied; ++Step)
+        {
+            const FBossMinionEntry& Entry = BossMinions[NextEmpowerIndex++ % BossMinions.Num()];
+            if (Entry.Boss.Get() == Boss)
+            {
+                Entry.Minion->Empower(Bonus, 3.f);
+                ++Empowered;
+            }
+        }
+
+        UE_LOG(LogBoss, Verbose, TEXT("Boss %s summon of %d %s over budget: %d spawned, %d denied, %d minions empowered (live %d)"),
+               *Boss->GetName(), Count, *Type.ToString(), Spawned, Denied, Empowered, BossMinions.Num());
+    }
+
+    return Spawned;
+}
+
+void UEnemySpawnerSubsystem::TrackBossMinion(AEnemyBase* Minion, ABossEnemy* Boss)
+{
+    Minion->bIsBossMinion = true;
+    BossMinions.Add({ Minion, Boss });
+    SET_DWORD_STAT(STAT_VazioBossMinions, BossMinions.Num());
+}
+
+void UEnemySpawnerSubsystem::NotifyBossMinionReleased(AEnemyBase* Minion)
+{
+    BossMinions.RemoveAllSwap([Minion](const FBossMinionEntry& Entry) { return Entry.Minion.Get() == Minion || !Entry.Minion.IsValid(); }, EAllowShrinking::No);
+    SET_DWORD_STAT(STAT_VazioBossMinions, BossMinions.Num());
+}
+
+int32 UEnemySpawnerSubsystem::GetNumBossMinionsFor(const ABossEnemy* Boss) const
+{
+    int32 Num = 0;
+    for (const FBossMinionEntry& Entry : BossMinions)
+    {
+        Num += (Entry.Boss.Get() == Boss && Entry.Minion.IsValid()) ? 1 : 0;
+    }
+    return Num;
+}
+
+void UEnemySpawnerSubsystem::HandlePostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetWorld() || PendingSpawns.Num() == 0)
+    {
+        return;
+    }
+
+    ProcessDeferredSpawns();
+}
+
+void UEnemySpawnerSubsystem::ProcessDeferredSpawns()
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioDeferredSpawns);
+
+    const int32 Budget = FMath::Max(1, CVarDeferredSpawnBudget.GetValueOnGameThread());
+    const int32 NumToProcess = FMath::Min(Budget, PendingSpawns.Num());
+
+    for (int32 i = 0; i < NumToProcess; ++i)
+    {
+        const FDeferredSpawnRequest& Request = PendingSpawns[i];
+        if (Request.bSplitChild)
+        {
+            --QueuedSplitChildren;
+        }
+
+        AEnemyBase* NewEnemy = AcquirePooledEnemy(Request.Type, Request.Transform);
+        if (!NewEnemy)
+        {
+            continue;
+        }
+
+        NewEnemy->bIsParent = false;
+        NewEnemy->ApplyArchetypeAndModifiers(Request.Archetype, Request.Mods);
+
+        if (Request.bSplitChild)
+        {
+            NewEnemy->bIsSplitChild = true;
+            ++LiveSplitChildren;
+        }
+    }
+
+    PendingSpawns.RemoveAt(0, NumToProcess, EAllowShrinking::No);
+    SET_DWORD_STAT(STAT_VazioDeferredQueue, PendingSpawns.Num());
+
+    UE_LOG(LogEnemySpawn, VeryVerbose, TEXT("Processed %d deferred spawns (%d pending, %d live split children)"),
+           NumToProcess, PendingSpawns.Num(), LiveSplitChildren);
+}
+
 void UEnemySpawnerSubsystem::SetEnemyConfig(UEnemyConfig* Config)
 {
     CurrentEnemyConfig = Config;
+    ArchetypeSnapshot = Config ? Config->Archetypes : TMap<FName, FEnemyArchetype>();
+    ConfigOverridesPath.Reset();
     UE_LOG(LogEnemySpawn, Log, TEXT("EnemyConfig set with %d archetypes"), Config ? Config->Archetypes.Num() : 0);
 }
 
-void UEnemySpawnerSubsystem::ScheduleEvent(const FSpawnEvent& Event)
+void UEnemySpawnerSubsystem::ScheduleEvent(const FSpawnEvent& Event, float ElapsedSeconds)
 {
     if (!GetWorld())
     {
         return;
     }
 
-    if (Event.TimeSeconds <= 0.0f)
+    const float Delay = Event.TimeSeconds - ElapsedSeconds;
+    if (Delay <= 0.0f)
     {
         ExecuteSpawnEvent(Event);
         return;
     }
 
-    FTimerHandle EventTimer;
     FTimerDelegate EventDelegate;
     EventDelegate.BindLambda([this, Event]()
     {
         ExecuteSpawnEvent(Event);
     });
 
-    GetWorld()->GetTimerManager().SetTimer(EventTimer, EventDelegate, Event.TimeSeconds, false);
-    ScheduledTimers.Add(EventTimer);
+    FScheduledSpawnEvent& Scheduled = ScheduledEvents.AddDefaulted_GetRef();
+    Scheduled.Event = Event;
+    GetWorld()->GetTimerManager().SetTimer(Scheduled.Timer, EventDelegate, Delay, false);
+    if (bTimelinePaused)
+    {
+        GetWorld()->GetTimerManager().PauseTimer(Scheduled.Timer);
+    }
 }
 
 void UEnemySpawnerSubsystem::ExecuteSpawnEvent(const FSpawnEvent& Event)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioSpawnEvents);
+    INC_DWORD_STAT(STAT_VazioSpawnEventsPerFrame);
+
     if ((bBossEncounterActive || bRegularSpawnsPaused) && !Event.bAllowDuringBossEncounter)
     {
         DeferredEvents.Add(Event);
@@ -266,7 +1025,7 @@ void UEnemySpawnerSubsystem::ExecuteSpawnEvent(const FSpawnEvent& Event)
     }
 }
 
-void UEnemySpawnerSubsystem::ScheduleBossEvent(const FBossSpawnEntry& BossEvent)
+void UEnemySpawnerSubsystem::ScheduleBossEvent(const FBossSpawnEntry& BossEvent, float ElapsedSeconds)
 {
     if (!GetWorld())
     {
@@ -279,21 +1038,43 @@ void UEnemySpawnerSubsystem::ScheduleBossEvent(const FBossSpawnEntry& BossEvent)
         return;
     }
 
+    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    FScheduledBossEvent& Scheduled = ScheduledBosses.AddDefaulted_GetRef();
+    Scheduled.Entry = BossEvent;
+
+    // SetTimer com tempo <= 0 não agenda nada: aviso/spawn já vencidos vão para o próximo tick
+    const float SpawnDelay = BossEvent.TimeSeconds - ElapsedSeconds;
     if (BossEvent.WarningLeadTime > 0.f && BossEvent.TimeSeconds > 0.f)
     {
-        const float WarningTime = FMath::Max(0.f, BossEvent.TimeSeconds - BossEvent.WarningLeadTime);
-        FTimerHandle WarningHandle;
+        const float WarningDelay = SpawnDelay - BossEvent.WarningLeadTime;
         FTimerDelegate WarningDelegate;
         WarningDelegate.BindUObject(this, &UEnemySpawnerSubsystem::TriggerBossWarning, BossEvent);
-        GetWorld()->GetTimerManager().SetTimer(WarningHandle, WarningDelegate, WarningTime, false);
-        ScheduledBossTimers.Add(WarningHandle);
+        if (WarningDelay > 0.f)
+        {
+            TimerManager.SetTimer(Scheduled.WarningTimer, WarningDelegate, WarningDelay, false);
+        }
+        else
+        {
+            Scheduled.WarningTimer = TimerManager.SetTimerForNextTick(WarningDelegate);
+        }
     }
 
-    FTimerHandle SpawnHandle;
     FTimerDelegate SpawnDelegate;
     SpawnDelegate.BindUObject(this, &UEnemySpawnerSubsystem::BeginBossEncounter, BossEvent);
-    GetWorld()->GetTimerManager().SetTimer(SpawnHandle, SpawnDelegate, BossEvent.TimeSeconds, false);
-    ScheduledBossTimers.Add(SpawnHandle);
+    if (SpawnDelay > 0.f)
+    {
+        TimerManager.SetTimer(Scheduled.SpawnTimer, SpawnDelegate, SpawnDelay, false);
+    }
+    else
+    {
+        Scheduled.SpawnTimer = TimerManager.SetTimerForNextTick(SpawnDelegate);
+    }
+
+    if (bTimelinePaused)
+    {
+        TimerManager.PauseTimer(Scheduled.WarningTimer);
+        TimerManager.PauseTimer(Scheduled.SpawnTimer);
+    }
 }
 
 void UEnemySpawnerSubsystem::TriggerBossWarning(FBossSpawnEntry BossEvent)
@@ -305,6 +1086,9 @@ void UEnemySpawnerSubsystem::TriggerBossWarning(FBossSpawnEntry BossEvent)
 
     UE_LOG(LogBoss, Log, TEXT("Boss warning: %s incoming in %.1fs"), *BossEvent.BossType.ToString(), BossEvent.WarningLeadTime);
 
+    // Janela do aviso: o spawn do boss e dos minions deve achar tudo já residente
+    PreloadBossAssets(BossEvent);
+
     OnBossWarning.Broadcast(BossEvent);
 
     if (BossEvent.WarningSound && GetWorld())
@@ -315,6 +1099,8 @@ void UEnemySpawnerSubsystem::TriggerBossWarning(FBossSpawnEntry BossEvent)
 
 void UEnemySpawnerSubsystem::BeginBossEncounter(FBossSpawnEntry BossEvent)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioBossEncounter);
+
     if (BossEvent.BossType.IsNone())
     {
         return;
@@ -326,18 +1112,37 @@ void UEnemySpawnerSubsystem::BeginBossEncounter(FBossSpawnEntry BossEvent)
         return;
     }
 
+    if (PreloadedBossType != BossEvent.BossType)
+    {
+        // Sem aviso (WarningLeadTime 0, teste, seek): o que não estiver residente carrega síncrono e conta no stat
+        UE_LOG(LogBoss, Verbose, TEXT("Boss %s starting without warning-window preload"), *BossEvent.BossType.ToString());
+        PreloadBossAssets(BossEvent);
+    }
+    else if (BossPreloadHandle.IsValid() && BossPreloadHandle->IsLoadingInProgress())
+    {
+        UE_LOG(LogBoss, Warning, TEXT("Boss %s preload still in progress at spawn; remaining assets will block"), *BossEvent.BossType.ToString());
+    }
+
+    EncounterSyncLoads = 0;
+    SET_DWORD_STAT(STAT_VazioBossSyncLoads, 0);
+    bTrackSyncLoads = true;
+    DeniedBossMinions = 0;
+    SET_DWORD_STAT(STAT_VazioBossMinionsDenied, 0);
+
     const FTransform BossTransform = BuildBossSpawnTransform(BossEvent);
     ABossEnemy* SpawnedBoss = Cast<ABossEnemy>(SpawnOne(BossEvent.BossType, BossTransform, BossEvent.BossModifiers));
 
     if (!SpawnedBoss)
     {
         UE_LOG(LogBoss, Error, TEXT("Failed to spawn boss %s"), *BossEvent.BossType.ToString());
+        bTrackSyncLoads = false;
+        ReleaseBossPreload();
         return;
     }
 
     // Log da posição do boss recém-criado
     const FVector BossLocation = SpawnedBoss->GetActorLocation();
-    UE_LOG(LogBoss, Warning, TEXT("[BossSpawn] Boss %s spawned at location: X=%.2f, Y=%.2f, Z=%.2f"), 
+    UE_LOG(LogBoss, Log, TEXT("[BossSpawn] Boss %s spawned at location: X=%.2f, Y=%.2f, Z=%.2f"), 
            *BossEvent.BossType.ToString(), BossLocation.X, BossLocation.Y, BossLocation.Z);
 
     UE_LOG(LogBoss, Log, TEXT("Boss %s has entered the battlefield"), *BossEvent.BossType.ToString());
@@ -375,12 +1180,92 @@ void UEnemySpawnerSubsystem::HandleActiveBossDefeated(ABossEnemy* Boss)
     ActiveBoss = nullptr;
     bBossEncounterActive = false;
 
+    if (bTrackSyncLoads)
+    {
+        bTrackSyncLoads = false;
+        UE_LOG(LogBoss, Log, TEXT("Boss encounter had %d synchronous package load(s)"), EncounterSyncLoads);
+    }
+    ReleaseBossPreload();
+
     const float ResumeDelay = ActiveBossEntry.bPauseRegularSpawns ? (ActiveBossEntry.ResumeDelay + BossResumeDelayBuffer) : 0.f;
     ActiveBossEntry = FBossSpawnEntry();
 
     ResumeRegularSpawns(ResumeDelay);
 }
 
+void UEnemySpawnerSubsystem::PreloadBossAssets(const FBossSpawnEntry& BossEvent)
+{
+    if (PreloadedBossType == BossEvent.BossType && BossPreloadHandle.IsValid())
+    {
+        return;
+    }
+    ReleaseBossPreload();
+
+    const TSubclassOf<AEnemyBase>* BossClass = EnemyClasses.Find(BossEvent.BossType);
+    if (!BossClass || !*BossClass || !UAssetManager::IsInitialized())
+    {
+        return;
+    }
+
+    // Boss + tipos invocados nas fases; classes Blueprint também entram como caminho
+    TArray<FName> Types = { BossEvent.BossType };
+    if (const ABossEnemy* BossCDO = Cast<ABossEnemy>((*BossClass)->GetDefaultObject()))
+    {
+        BossCDO->GetSummonTypes(Types);
+    }
+
+    TArray<FSoftObjectPath> Assets;
+    for (const FName Type : Types)
+    {
+        const TSubclassOf<AEnemyBase>* Class = EnemyClasses.Find(Type);
+        if (!Class || !*Class)
+        {
+            continue;
+        }
+        if (!(*Class)->HasAnyClassFlags(CLASS_Native))
+        {
+            Assets.AddUnique(FSoftObjectPath(*Class));
+        }
+        (*Class)->GetDefaultObject<AEnemyBase>()->GetPreloadAssets(Assets);
+    }
+    if (BossEvent.WarningSound)
+    {
+        Assets.AddUnique(FSoftObjectPath(BossEvent.WarningSound));
+    }
+
+    PreloadedBossType = BossEvent.BossType;
+    const double RequestSeconds = FPlatformTime::Seconds();
+    BossPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Assets,
+        FStreamableDelegate::CreateWeakLambda(this, [BossType = BossEvent.BossType, RequestSeconds, NumAssets = Assets.Num()]()
+        {
+            UE_LOG(LogBoss, Log, TEXT("Boss %s preload finished: %d asset(s) in %.1fms"),
+                   *BossType.ToString(), NumAssets, (FPlatformTime::Seconds() - RequestSeconds) * 1000.0);
+        }),
+        FStreamableManager::AsyncLoadHighPriority, true, false, TEXT("BossPreload"));
+}
+
+void UEnemySpawnerSubsystem::ReleaseBossPreload()
+{
+    if (BossPreloadHandle.IsValid())
+    {
+        BossPreloadHandle->ReleaseHandle();
+        BossPreloadHandle.Reset();
+    }
+    PreloadedBossType = NAME_None;
+}
+
+void UEnemySpawnerSubsystem::HandleSyncLoadPackage(const FString& PackageName)
+{
+    if (!bTrackSyncLoads || !IsInGameThread())
+    {
+        return;
+    }
+
+    ++EncounterSyncLoads;
+    INC_DWORD_STAT(STAT_VazioBossSyncLoads);
+    UE_LOG(LogBoss, Warning, TEXT("Synchronous load during boss encounter: %s"), *PackageName);
+}
+
 void UEnemySpawnerSubsystem::HandleActiveBossHealthChanged(float NormalizedHealth)
 {
     ABossEnemy* BossPtr = ActiveBoss.Get();
@@ -421,6 +1306,10 @@ void UEnemySpawnerSubsystem::ResumeRegularSpawns(float DelaySeconds)
     }
 
     GetWorld()->GetTimerManager().SetTimer(BossResumeHandle, this, &UEnemySpawnerSubsystem::OnBossResumeTimerElapsed, DelaySeconds, false);
+    if (bTimelinePaused)
+    {
+        GetWorld()->GetTimerManager().PauseTimer(BossResumeHandle);
+    }
 }
 
 void UEnemySpawnerSubsystem::OnBossResumeTimerElapsed()
@@ -467,7 +1356,7 @@ FTransform UEnemySpawnerSubsystem::BuildBossSpawnTransform(const FBossSpawnEntry
         SpawnRotation = (PlayerLocation - SpawnLocation).Rotation();
         
         // Log da posição calculada para spawn
-        UE_LOG(LogBoss, Warning, TEXT("[BossSpawnCalc] Calculated spawn position for boss: X=%.2f, Y=%.2f, Z=%.2f (Player at: X=%.2f, Y=%.2f, Z=%.2f, Distance: %.2f)"), 
+        UE_LOG(LogBoss, Verbose, TEXT("[BossSpawnCalc] Calculated spawn position for boss: X=%.2f, Y=%.2f, Z=%.2f (Player at: X=%.2f, Y=%.2f, Z=%.2f, Distance: %.2f)"), 
                SpawnLocation.X, SpawnLocation.Y, SpawnLocation.Z, 
                PlayerLocation.X, PlayerLocation.Y, PlayerLocation.Z, Distance);
     }
@@ -513,6 +1402,8 @@ bool UEnemySpawnerSubsystem::FindSpawnPointCircle(float Radius, int32 Index, int
 
 AEnemyBase* UEnemySpawnerSubsystem::CreateEnemyActor(FName Type, const FTransform& Transform)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioSpawnActor);
+
     TSubclassOf<AEnemyBase>* EnemyClass = EnemyClasses.Find(Type);
     if (!EnemyClass || !*EnemyClass)
     {
@@ -527,9 +1418,9 @@ AEnemyBase* UEnemySpawnerSubsystem::CreateEnemyActor(FName Type, const FTransfor
     
     if (SpawnedActor)
     {
-        const FVector ActualSpawnLocation = SpawnedActor->GetActorLocation();
-        UE_LOG(LogBoss, Warning, TEXT("[ActorSpawn] %s spawned successfully at actual location: X=%.2f, Y=%.2f, Z=%.2f"), 
-               *Type.ToString(), ActualSpawnLocation.X, ActualSpawnLocation.Y, ActualSpawnLocation.Z);
+        INC_DWORD_STAT(STAT_VazioEnemiesSpawned);
+        [[maybe_unused]] const FVector ActualSpawnLocation = SpawnedActor->GetActorLocation();
+        VAZIO_TRACE(Spawn, "ActorSpawn", "X Y Z", SpawnedActor, ActualSpawnLocation.X, ActualSpawnLocation.Y, ActualSpawnLocation.Z);
     }
     else
     {
@@ -539,6 +1430,23 @@ AEnemyBase* UEnemySpawnerSubsystem::CreateEnemyActor(FName Type, const FTransfor
     return SpawnedActor;
 }
 
+AEnemyBase* UEnemySpawnerSubsystem::AcquirePooledEnemy(FName Type, const FTransform& Transform)
+{
+    TSubclassOf<AEnemyBase>* EnemyClass = EnemyClasses.Find(Type);
+    UEnemyPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UEnemyPoolSubsystem>() : nullptr;
+    if (!EnemyClass || !*EnemyClass || !Pool)
+    {
+        return CreateEnemyActor(Type, Transform);
+    }
+
+    AEnemyBase* Enemy = Pool->GetFromPool(Type, *EnemyClass);
+    if (Enemy)
+    {
+        Enemy->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+    }
+    return Enemy;
+}
+
 void UEnemySpawnerSubsystem::ClearBossDelegates()
 {
     if (ABossEnemy* Boss = ActiveBoss.Get())
@@ -620,14 +1528,12 @@ void UEnemySpawnerSubsystem::SpawnAllBossesForTesting()
         return;
     }
 
-    for (FTimerHandle& Handle : ScheduledBossTimers)
+    for (FScheduledBossEvent& Scheduled : ScheduledBosses)
     {
-        if (Handle.IsValid())
-        {
-            World->GetTimerManager().ClearTimer(Handle);
-        }
+        World->GetTimerManager().ClearTimer(Scheduled.WarningTimer);
+        World->GetTimerManager().ClearTimer(Scheduled.SpawnTimer);
     }
-    ScheduledBossTimers.Empty();
+    ScheduledBosses.Empty();
 
     // Array com todos os bosses para testar
     TArray<FName> BossesToTest = {
@@ -656,3 +1562,159 @@ void UEnemySpawnerSubsystem::SpawnAllBossesForTesting()
 
     UE_LOG(LogBoss, Log, TEXT("Scheduled %d bosses for testing"), BossesToTest.Num());
 }
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyTimelineStart(
+    TEXT("Enemy.Timeline.Start"),
+    TEXT("Enemy.Timeline.Start <Timeline relativa a Content/> [Seed] - inicia a timeline e a recarrega quando o arquivo muda (Enemy.HotReload)"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr;
+        if (!Spawner || Args.Num() < 1)
+        {
+            return;
+        }
+
+        if (!Spawner->GetEnemyConfig())
+        {
+            Spawner->SetEnemyConfig(UEnemyConfig::CreateDefaultConfig());
+        }
+        Spawner->StartTimelineFromFile(Args[0], Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 0);
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyConfigOverrides(
+    TEXT("Enemy.Config.Overrides"),
+    TEXT("Enemy.Config.Overrides <JSON relativo a Content/> - aplica { \"archetypes\": { \"NormalEnemy\": { \"BaseHP\": 60 } } } sobre a config atual e recarrega quando o arquivo muda"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr;
+        if (Spawner && Args.Num() > 0)
+        {
+            Spawner->WatchEnemyConfigOverrides(Args[0]);
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyHotReload(
+    TEXT("Enemy.HotReload.Now"),
+    TEXT("Enemy.HotReload.Now - recarrega já a timeline e os overrides de config observados"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr)
+        {
+            Spawner->ReloadWatchedSources();
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyTimelineSeek(
+    TEXT("Enemy.Timeline.Seek"),
+    TEXT("Enemy.Timeline.Seek <Segundos> [Timeline relativa a Content/] [-NoPrepopulate] - (re)inicia a timeline no tempo dado, recriando a população prevista pelo simulador"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr;
+        if (!Spawner || Args.Num() < 1)
+        {
+            return;
+        }
+
+        const float Seconds = FCString::Atof(*Args[0]);
+        FString TimelinePath;
+        bool bPrepopulate = true;
+        for (int32 i = 1; i < Args.Num(); ++i)
+        {
+            if (Args[i].Equals(TEXT("-NoPrepopulate"), ESearchCase::IgnoreCase))
+            {
+                bPrepopulate = false;
+            }
+            else
+            {
+                TimelinePath = Args[i];
+            }
+        }
+
+        if (!Spawner->GetEnemyConfig())
+        {
+            Spawner->SetEnemyConfig(UEnemyConfig::CreateDefaultConfig());
+        }
+
+        // A população atual não pertence ao novo instante; devolve tudo ao pool antes de recriar
+        UEnemyPoolSubsystem* Pool = World->GetSubsystem<UEnemyPoolSubsystem>();
+        TArray<AEnemyBase*> LiveEnemies;
+        for (TActorIterator<AEnemyBase> It(World); It; ++It)
+        {
+            // Ocultos e fora do ActiveEnemies já estão parados no pool
+            if (!(Pool && !Pool->IsTracked(*It) && It->IsHidden()))
+            {
+                LiveEnemies.Add(*It);
+            }
+        }
+        for (AEnemyBase* Enemy : LiveEnemies)
+        {
+            Enemy->ReleaseEnemy();
+        }
+
+        if (!TimelinePath.IsEmpty())
+        {
+            Spawner->StartTimelineFromFile(TimelinePath, 0, Seconds, bPrepopulate);
+        }
+        else if (const USpawnTimeline* Active = Spawner->GetActiveTimeline())
+        {
+            Spawner->StartTimelineAt(Active, Seconds, 0, bPrepopulate);
+        }
+        else
+        {
+            UE_LOG(LogEnemySpawn, Warning, TEXT("Enemy.Timeline.Seek: no active timeline, pass a timeline path"));
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyTimelineSpeed(
+    TEXT("Enemy.Timeline.Speed"),
+    TEXT("Enemy.Timeline.Speed <N> - roda o jogo a N vezes a velocidade normal (time dilation global, máx. 20)"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr)
+        {
+            Spawner->SetPlaybackSpeed(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 1.f);
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyTimelinePause(
+    TEXT("Enemy.Timeline.Pause"),
+    TEXT("Enemy.Timeline.Pause - congela a timeline (a horda continua); de novo para retomar"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr)
+        {
+            if (Spawner->IsTimelinePaused())
+            {
+                Spawner->ResumeTimeline();
+            }
+            else
+            {
+                Spawner->PauseTimeline();
+            }
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyTimelineStep(
+    TEXT("Enemy.Timeline.Step"),
+    TEXT("Enemy.Timeline.Step [Segundos=1] - roda a timeline pausada por N segundos de jogo e pausa de novo"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr)
+        {
+            Spawner->StepTimeline(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 1.f);
+        }
+    }),
+    ECVF_Default
+);
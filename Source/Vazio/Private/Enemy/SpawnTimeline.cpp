@@ -1,10 +1,53 @@
 #include "Enemy/SpawnTimeline.h"
+#include "Enemy/EnemyConfig.h"
+#include "Enemy/Types/BossEnemy.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sound/SoundBase.h"
 #include "Engine/Engine.h"
+#if WITH_EDITORONLY_DATA
+#include "EditorFramework/AssetImportData.h"
+#endif
 
-bool USpawnTimeline::ParseFromJSON(const FString& JSONString)
+const TCHAR* USpawnTimeline::BinaryExtension = TEXT(".vtl");
+
+// Contagem por entrada acima disso quase sempre é erro de digitação no JSON
+static constexpr int32 TimelineMaxCountPerEntry = 500;
+
+static void AddTimelineError(TArray<FString>* OutErrors, const FString& Message)
+{
+    if (OutErrors)
+    {
+        OutErrors->Add(Message);
+    }
+}
+
+// Flags aceitas direto no objeto do spawn ou dentro de "modifiers"
+static void ApplyInlineModifierFlags(const TSharedPtr<FJsonObject>& Object, FEnemyInstanceModifiers& Mods)
+{
+    Object->TryGetBoolField(TEXT("big"), Mods.bBig);
+    Object->TryGetBoolField(TEXT("immovable"), Mods.bImmovable);
+    if (!Object->TryGetNumberField(TEXT("dissolveSeconds"), Mods.DissolveSeconds))
+    {
+        Object->TryGetNumberField(TEXT("dissolve"), Mods.DissolveSeconds);
+    }
+}
+
+#if WITH_EDITORONLY_DATA
+void USpawnTimeline::PostInitProperties()
+{
+    if (!HasAnyFlags(RF_ClassDefaultObject))
+    {
+        AssetImportData = NewObject<UAssetImportData>(this, TEXT("AssetImportData"));
+    }
+    Super::PostInitProperties();
+}
+#endif
+
+bool USpawnTimeline::ParseFromJSON(const FString& JSONString, TArray<FString>* OutErrors)
 {
     TSharedPtr<FJsonObject> RootObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JSONString);
@@ -12,49 +55,76 @@ bool USpawnTimeline::ParseFromJSON(const FString& JSONString)
     if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON for SpawnTimeline"));
+        AddTimelineError(OutErrors, FString::Printf(TEXT("JSON inválido: %s"), *Reader->GetErrorMessage()));
         return false;
     }
 
+    const int32 NumErrorsBefore = OutErrors ? OutErrors->Num() : 0;
+
     // Clear existing data
     Events.Empty();
     BossEvents.Empty();
 
+    if (!RootObject->HasField(TEXT("spawnEvents")) && !RootObject->HasField(TEXT("bosses")))
+    {
+        AddTimelineError(OutErrors, TEXT("Sem 'spawnEvents' nem 'bosses' na raiz"));
+    }
+
     // Parse regular spawn events from "spawnEvents" array
     const TArray<TSharedPtr<FJsonValue>>* SpawnEventsArray = nullptr;
     if (RootObject->TryGetArrayField(TEXT("spawnEvents"), SpawnEventsArray))
     {
-        for (const auto& EventValue : *SpawnEventsArray)
+        for (int32 EventIndex = 0; EventIndex < SpawnEventsArray->Num(); ++EventIndex)
         {
-            const TSharedPtr<FJsonObject>& EventObject = EventValue->AsObject();
-            if (EventObject.IsValid())
+            const TSharedPtr<FJsonObject>* EventObject = nullptr;
+            if (!(*SpawnEventsArray)[EventIndex]->TryGetObject(EventObject))
+            {
+                AddTimelineError(OutErrors, FString::Printf(TEXT("spawnEvents[%d]: deve ser um objeto"), EventIndex));
+                continue;
+            }
+
+            FSpawnEvent NewEvent;
+            if (!(*EventObject)->TryGetNumberField(TEXT("time"), NewEvent.TimeSeconds))
+            {
+                AddTimelineError(OutErrors, FString::Printf(TEXT("spawnEvents[%d]: sem 'time' numérico"), EventIndex));
+            }
+
+            // Parse the "spawns" object within each event
+            const TSharedPtr<FJsonObject>* SpawnsObject = nullptr;
+            if ((*EventObject)->TryGetObjectField(TEXT("spawns"), SpawnsObject))
             {
-                FSpawnEvent NewEvent;
-                NewEvent.TimeSeconds = EventObject->GetNumberField(TEXT("time"));
-                
-                // Parse the "spawns" object within each event
-                const TSharedPtr<FJsonObject>* SpawnsObject = nullptr;
-                if (EventObject->TryGetObjectField(TEXT("spawns"), SpawnsObject))
+                const int32 NumErrors = OutErrors ? OutErrors->Num() : 0;
+                ParseSpawnObjectIntoEvent(*SpawnsObject, NewEvent, OutErrors);
+                if (OutErrors)
                 {
-                    ParseSpawnObjectIntoEvent(*SpawnsObject, NewEvent);
-                    // Only add the event if it has spawns
-                    if (NewEvent.Linear.Num() > 0 || NewEvent.Circles.Num() > 0)
+                    for (int32 i = NumErrors; i < OutErrors->Num(); ++i)
                     {
-                        Events.Add(NewEvent);
-                        UE_LOG(LogEnemySpawn, Log, TEXT("Added spawn event at time %.2f with %d linear and %d circle spawns"), 
-                               NewEvent.TimeSeconds, NewEvent.Linear.Num(), NewEvent.Circles.Num());
+                        (*OutErrors)[i] = FString::Printf(TEXT("spawnEvents[%d] (t=%.1f): %s"), EventIndex, NewEvent.TimeSeconds, *(*OutErrors)[i]);
                     }
                 }
+
+                // Only add the event if it has spawns
+                if (NewEvent.Linear.Num() > 0 || NewEvent.Circles.Num() > 0)
+                {
+                    Events.Add(NewEvent);
+                    UE_LOG(LogEnemySpawn, Log, TEXT("Added spawn event at time %.2f with %d linear and %d circle spawns"),
+                           NewEvent.TimeSeconds, NewEvent.Linear.Num(), NewEvent.Circles.Num());
+                }
+            }
+            else
+            {
+                AddTimelineError(OutErrors, FString::Printf(TEXT("spawnEvents[%d]: 'spawns' deve ser um objeto { \"Tipo\": contagem, \"circle\": [...] }"), EventIndex));
             }
         }
     }
 
     // Parse boss events
-    ParseBossEvents(RootObject);
+    ParseBossEvents(RootObject, OutErrors);
 
-    UE_LOG(LogTemp, Log, TEXT("Successfully parsed SpawnTimeline with %d regular events and %d boss events"), 
+    UE_LOG(LogTemp, Log, TEXT("Successfully parsed SpawnTimeline with %d regular events and %d boss events"),
            Events.Num(), BossEvents.Num());
 
-    return true;
+    return !OutErrors || OutErrors->Num() == NumErrorsBefore;
 }
 
 void USpawnTimeline::NormalizeSpawnData(const TSharedPtr<FJsonObject>& SpawnObject, FSpawnEvent& OutEvent)
@@ -84,7 +154,7 @@ void USpawnTimeline::NormalizeSpawnData(const TSharedPtr<FJsonObject>& SpawnObje
     }
 }
 
-void USpawnTimeline::ParseBossEvents(const TSharedPtr<FJsonObject>& RootObject)
+void USpawnTimeline::ParseBossEvents(const TSharedPtr<FJsonObject>& RootObject, TArray<FString>* OutErrors)
 {
     const TArray<TSharedPtr<FJsonValue>>* BossArray = nullptr;
     if (!RootObject->TryGetArrayField(TEXT("bosses"), BossArray))
@@ -92,27 +162,50 @@ void USpawnTimeline::ParseBossEvents(const TSharedPtr<FJsonObject>& RootObject)
         return;
     }
 
-    for (const auto& BossValue : *BossArray)
+    for (int32 BossIndex = 0; BossIndex < BossArray->Num(); ++BossIndex)
     {
-        const TSharedPtr<FJsonObject>& BossObject = BossValue->AsObject();
-        if (!BossObject.IsValid())
+        const TSharedPtr<FJsonObject>* BossObjectPtr = nullptr;
+        if (!(*BossArray)[BossIndex]->TryGetObject(BossObjectPtr))
         {
+            AddTimelineError(OutErrors, FString::Printf(TEXT("bosses[%d]: deve ser um objeto"), BossIndex));
             continue;
         }
+        const TSharedPtr<FJsonObject>& BossObject = *BossObjectPtr;
 
         FBossSpawnEntry BossEntry;
-        BossEntry.TriggerTime = BossObject->GetNumberField(TEXT("time"));
-        
-        FString BossTypeName = BossObject->GetStringField(TEXT("bossType"));
+        if (!BossObject->TryGetNumberField(TEXT("time"), BossEntry.TriggerTime))
+        {
+            AddTimelineError(OutErrors, FString::Printf(TEXT("bosses[%d]: sem 'time' numérico"), BossIndex));
+        }
+
+        // O spawner agenda por TimeSeconds/WarningLeadTime; sem isso o boss do JSON nunca dispara
+        BossEntry.TimeSeconds = BossEntry.TriggerTime;
+
+        FString BossTypeName;
+        if (!BossObject->TryGetStringField(TEXT("bossType"), BossTypeName))
+        {
+            AddTimelineError(OutErrors, FString::Printf(TEXT("bosses[%d]: sem 'bossType'"), BossIndex));
+        }
         BossEntry.BossType = FName(*BossTypeName);
 
-        BossEntry.WarningDuration = BossObject->GetNumberField(TEXT("warningDuration"));
+        BossObject->TryGetNumberField(TEXT("warningDuration"), BossEntry.WarningDuration);
         if (BossEntry.WarningDuration <= 0.0f)
         {
             BossEntry.WarningDuration = 3.0f; // Default warning duration
         }
+        BossEntry.WarningLeadTime = BossEntry.WarningDuration;
 
-        BossEntry.bPauseRegularSpawns = BossObject->GetBoolField(TEXT("pauseRegularSpawns"));
+        bool bPauseRegularSpawns = false;
+        BossObject->TryGetBoolField(TEXT("pauseRegularSpawns"), bPauseRegularSpawns);
+        BossEntry.bPauseRegularSpawns = bPauseRegularSpawns;
+
+        BossObject->TryGetNumberField(TEXT("resumeDelay"), BossEntry.ResumeDelay);
+
+        FString Announcement;
+        if (BossObject->TryGetStringField(TEXT("announcement"), Announcement))
+        {
+            BossEntry.Announcement = FText::FromString(Announcement);
+        }
 
         // Parse boss modifiers (optional)
         const TSharedPtr<FJsonObject>* ModifiersObject = nullptr;
@@ -129,103 +222,410 @@ FEnemyInstanceModifiers USpawnTimeline::ParseModifiers(const TSharedPtr<FJsonObj
 {
     FEnemyInstanceModifiers Modifiers;
 
-    // Parse health multiplier
-    Modifiers.HealthMultiplier = ModObject->GetNumberField(TEXT("healthMultiplier"));
-    if (Modifiers.HealthMultiplier <= 0.0f)
+    // Multiplicadores ausentes ou <= 0 ficam em 1
+    auto ReadMultiplier = [&ModObject](const TCHAR* Field, float& OutValue)
+    {
+        if (!ModObject->TryGetNumberField(Field, OutValue) || OutValue <= 0.0f)
+        {
+            OutValue = 1.0f;
+        }
+    };
+
+    ReadMultiplier(TEXT("healthMultiplier"), Modifiers.HealthMultiplier);
+    ReadMultiplier(TEXT("damageMultiplier"), Modifiers.DamageMultiplier);
+    ReadMultiplier(TEXT("speedMultiplier"), Modifiers.SpeedMultiplier);
+    ReadMultiplier(TEXT("scaleMultiplier"), Modifiers.ScaleMultiplier);
+    ReadMultiplier(TEXT("rewardMultiplier"), Modifiers.RewardMultiplier);
+    ApplyInlineModifierFlags(ModObject, Modifiers);
+
+    return Modifiers;
+}
+
+void USpawnTimeline::ParseSpawnObjectIntoEvent(const TSharedPtr<FJsonObject>& SpawnsObject, FSpawnEvent& OutEvent, TArray<FString>* OutErrors)
+{
+    // Parse each enemy type in the spawns object and populate Linear/Circles arrays
+    for (const auto& Pair : SpawnsObject->Values)
+    {
+        const FString& EnemyTypeName = Pair.Key;
+        const TSharedPtr<FJsonValue>& EnemyValue = Pair.Value;
+
+        if (EnemyTypeName == TEXT("circle"))
+        {
+            // Handle circle spawns array
+            const TArray<TSharedPtr<FJsonValue>>* CircleArray = nullptr;
+            if (!EnemyValue->TryGetArray(CircleArray))
+            {
+                AddTimelineError(OutErrors, TEXT("'circle' deve ser um array"));
+                continue;
+            }
+
+            for (const auto& CircleValue : *CircleArray)
+            {
+                const TSharedPtr<FJsonObject>* CircleObject = nullptr;
+                FString CircleType;
+                if (!CircleValue->TryGetObject(CircleObject) || !(*CircleObject)->TryGetStringField(TEXT("type"), CircleType))
+                {
+                    AddTimelineError(OutErrors, TEXT("entrada de 'circle' precisa ser um objeto com 'type'"));
+                    continue;
+                }
+
+                FCircleSpawn CircleSpawn;
+                CircleSpawn.Type = FName(*CircleType);
+                int32 Count = 1;
+                (*CircleObject)->TryGetNumberField(TEXT("count"), Count);
+                CircleSpawn.Count = FMath::Max(1, Count);
+                (*CircleObject)->TryGetNumberField(TEXT("radius"), CircleSpawn.Radius);
+                if (CircleSpawn.Radius <= 0.0f)
+                {
+                    CircleSpawn.Radius = 500.0f;
+                }
+
+                const TSharedPtr<FJsonObject>* ModifiersObject = nullptr;
+                if ((*CircleObject)->TryGetObjectField(TEXT("modifiers"), ModifiersObject))
+                {
+                    CircleSpawn.Mods = ParseModifiers(*ModifiersObject);
+                }
+                ApplyInlineModifierFlags(*CircleObject, CircleSpawn.Mods);
+                OutEvent.Circles.Add(CircleSpawn);
+            }
+            continue;
+        }
+
+        ParseTypeCountValue(FName(*EnemyTypeName), EnemyValue, OutEvent, OutErrors);
+    }
+}
+
+bool USpawnTimeline::ParseTypeCountValue(FName Type, const TSharedPtr<FJsonValue>& Value, FSpawnEvent& OutEvent, TArray<FString>* OutErrors)
+{
+    // Linear spawns: "Tipo": 3 | "Tipo": { "count": 3, "big": true } | "Tipo": [ 3, { ... } ]
+    FTypeCount TypeCount;
+    TypeCount.Type = Type;
+
+    if (Value->Type == EJson::Number)
     {
-        Modifiers.HealthMultiplier = 1.0f;
+        TypeCount.Count = FMath::Max(1, (int32)Value->AsNumber());
     }
+    else if (Value->Type == EJson::Object)
+    {
+        const TSharedPtr<FJsonObject>& EnemyObject = Value->AsObject();
+        int32 Count = 1;
+        EnemyObject->TryGetNumberField(TEXT("count"), Count);
+        TypeCount.Count = FMath::Max(1, Count);
 
-    // Parse damage multiplier
-    Modifiers.DamageMultiplier = ModObject->GetNumberField(TEXT("damageMultiplier"));
-    if (Modifiers.DamageMultiplier <= 0.0f)
+        const TSharedPtr<FJsonObject>* ModifiersObject = nullptr;
+        if (EnemyObject->TryGetObjectField(TEXT("modifiers"), ModifiersObject))
+        {
+            TypeCount.Mods = ParseModifiers(*ModifiersObject);
+        }
+        ApplyInlineModifierFlags(EnemyObject, TypeCount.Mods);
+    }
+    else if (Value->Type == EJson::Array)
+    {
+        bool bAllValid = true;
+        for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+        {
+            if (Element->Type == EJson::Array)
+            {
+                AddTimelineError(OutErrors, FString::Printf(TEXT("'%s': arrays aninhados não são suportados"), *Type.ToString()));
+                bAllValid = false;
+                continue;
+            }
+            bAllValid &= ParseTypeCountValue(Type, Element, OutEvent, OutErrors);
+        }
+        return bAllValid;
+    }
+    else
     {
-        Modifiers.DamageMultiplier = 1.0f;
+        AddTimelineError(OutErrors, FString::Printf(TEXT("'%s': valor deve ser número, objeto ou array"), *Type.ToString()));
+        return false;
     }
 
-    // Parse speed multiplier
-    Modifiers.SpeedMultiplier = ModObject->GetNumberField(TEXT("speedMultiplier"));
-    if (Modifiers.SpeedMultiplier <= 0.0f)
+    // Add to Linear array (which ExecuteSpawnEvent expects)
+    OutEvent.Linear.Add(TypeCount);
+
+    UE_LOG(LogEnemySpawn, Verbose, TEXT("Added Linear spawn: %s x%d"), *TypeCount.Type.ToString(), TypeCount.Count);
+    return true;
+}
+
+bool USpawnTimeline::Validate(const UEnemyConfig* Config, TArray<FString>& OutErrors) const
+{
+    const int32 NumErrorsBefore = OutErrors.Num();
+
+    auto CheckType = [Config, &OutErrors](FName Type, const FString& Where)
+    {
+        if (Type.IsNone())
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: tipo vazio"), *Where));
+        }
+        else if (Config && !Config->GetArchetype(Type))
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: tipo '%s' sem arquétipo na EnemyConfig"), *Where, *Type.ToString()));
+        }
+    };
+
+    auto CheckCount = [&OutErrors](int32 Count, const FString& Where)
     {
-        Modifiers.SpeedMultiplier = 1.0f;
+        if (Count < 1 || Count > TimelineMaxCountPerEntry)
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: contagem %d fora de [1, %d]"), *Where, Count, TimelineMaxCountPerEntry));
+        }
+    };
+
+    auto CheckMods = [&OutErrors](const FEnemyInstanceModifiers& Mods, const FString& Where)
+    {
+        if (Mods.HealthMultiplier <= 0.f || Mods.DamageMultiplier <= 0.f || Mods.SpeedMultiplier <= 0.f
+            || Mods.ScaleMultiplier <= 0.f || Mods.RewardMultiplier <= 0.f || Mods.DissolveSeconds < 0.f)
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: modificadores com multiplicador <= 0 ou dissolve negativo"), *Where));
+        }
+    };
+
+    for (int32 EventIndex = 0; EventIndex < Events.Num(); ++EventIndex)
+    {
+        const FSpawnEvent& Event = Events[EventIndex];
+        const FString Where = FString::Printf(TEXT("evento %d (t=%.1f)"), EventIndex, Event.TimeSeconds);
+
+        if (!FMath::IsFinite(Event.TimeSeconds) || Event.TimeSeconds < 0.f)
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: tempo inválido"), *Where));
+        }
+        if (Event.Linear.Num() == 0 && Event.Circles.Num() == 0)
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: sem spawns"), *Where));
+        }
+
+        for (const FTypeCount& TypeCount : Event.Linear)
+        {
+            CheckType(TypeCount.Type, Where);
+            CheckCount(TypeCount.Count, Where);
+            CheckMods(TypeCount.Mods, Where);
+        }
+        for (const FCircleSpawn& Circle : Event.Circles)
+        {
+            CheckType(Circle.Type, Where);
+            CheckCount(Circle.Count, Where);
+            CheckMods(Circle.Mods, Where);
+            if (Circle.Radius <= 0.f)
+            {
+                OutErrors.Add(FString::Printf(TEXT("%s: raio de 'circle' <= 0"), *Where));
+            }
+        }
     }
 
-    // Parse scale multiplier
-    Modifiers.ScaleMultiplier = ModObject->GetNumberField(TEXT("scaleMultiplier"));
-    if (Modifiers.ScaleMultiplier <= 0.0f)
+    for (int32 BossIndex = 0; BossIndex < BossEvents.Num(); ++BossIndex)
     {
-        Modifiers.ScaleMultiplier = 1.0f;
+        const FBossSpawnEntry& Boss = BossEvents[BossIndex];
+        const FString Where = FString::Printf(TEXT("boss %d (%s)"), BossIndex, *Boss.BossType.ToString());
+
+        CheckType(Boss.BossType, Where);
+        CheckMods(Boss.BossModifiers, Where);
+
+        // Os tipos do spawner são os nomes das classes nativas
+        const UClass* BossClass = Boss.BossType.IsNone() ? nullptr : FindFirstObject<UClass>(*Boss.BossType.ToString(), EFindFirstObjectOptions::NativeFirst);
+        if (!BossClass || !BossClass->IsChildOf(ABossEnemy::StaticClass()))
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: não é uma classe de boss"), *Where));
+        }
+        if (!FMath::IsFinite(Boss.TimeSeconds) || Boss.TimeSeconds <= 0.f)
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: TimeSeconds <= 0, o spawner nunca o agenda"), *Where));
+        }
+        if (Boss.WarningLeadTime < 0.f || Boss.ResumeDelay < 0.f)
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: aviso ou retomada negativos"), *Where));
+        }
     }
 
-    // Parse reward multiplier
-    Modifiers.RewardMultiplier = ModObject->GetNumberField(TEXT("rewardMultiplier"));
-    if (Modifiers.RewardMultiplier <= 0.0f)
+    return OutErrors.Num() == NumErrorsBefore;
+}
+
+void USpawnTimeline::SaveToBinary(TArray<uint8>& OutBytes) const
+{
+    OutBytes.Reset();
+    FMemoryWriter Writer(OutBytes);
+
+    uint32 Magic = BinaryMagic;
+    uint32 Version = BinaryVersion;
+    Writer << Magic << Version;
+
+    // SerializeBinary é simétrico; ao salvar não altera nada
+    const_cast<USpawnTimeline*>(this)->SerializeBinary(Writer);
+}
+
+bool USpawnTimeline::LoadFromBinary(const TArray<uint8>& Bytes)
+{
+    FMemoryReader Reader(Bytes);
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    Reader << Magic << Version;
+    if (Reader.IsError() || Magic != BinaryMagic || Version != BinaryVersion)
     {
-        Modifiers.RewardMultiplier = 1.0f;
+        UE_LOG(LogEnemySpawn, Error, TEXT("Timeline binária inválida (magic %08x, versão %u, esperada %u): gere de novo a partir do JSON"),
+               Magic, Version, BinaryVersion);
+        return false;
     }
 
-    return Modifiers;
+    SerializeBinary(Reader);
+    if (Reader.IsError() || !Reader.AtEnd())
+    {
+        UE_LOG(LogEnemySpawn, Error, TEXT("Timeline binária truncada ou corrompida"));
+        Events.Empty();
+        BossEvents.Empty();
+        return false;
+    }
+    return true;
 }
 
-void USpawnTimeline::ParseSpawnObjectIntoEvent(const TSharedPtr<FJsonObject>& SpawnsObject, FSpawnEvent& OutEvent)
+void USpawnTimeline::SerializeBinary(FArchive& Ar)
 {
-    // Parse each enemy type in the spawns object and populate Linear/Circles arrays
-    for (const auto& Pair : SpawnsObject->Values)
+    // Tabela de nomes: cada tipo aparece uma vez; as entradas guardam índices de 16 bits
+    TArray<FString> NameStrings;
+    TMap<FName, uint16> NameIndices;
+    if (Ar.IsSaving())
     {
-        const FString& EnemyTypeName = Pair.Key;
-        const TSharedPtr<FJsonValue>& EnemyValue = Pair.Value;
-        
-        if (EnemyTypeName == TEXT("circle"))
+        auto AddName = [&NameStrings, &NameIndices](FName Name)
         {
-            // Handle circle spawns array
-            if (EnemyValue->Type == EJson::Array)
+            if (!NameIndices.Contains(Name))
             {
-                const TArray<TSharedPtr<FJsonValue>>& CircleArray = EnemyValue->AsArray();
-                for (const auto& CircleValue : CircleArray)
-                {
-                    if (const TSharedPtr<FJsonObject>& CircleObject = CircleValue->AsObject())
-                    {
-                        FCircleSpawn CircleSpawn;
-                        CircleSpawn.Type = FName(*CircleObject->GetStringField(TEXT("type")));
-                        CircleSpawn.Count = FMath::Max(1, (int32)CircleObject->GetNumberField(TEXT("count")));
-                        CircleSpawn.Radius = CircleObject->GetNumberField(TEXT("radius"));
-                        if (CircleSpawn.Radius <= 0.0f)
-                        {
-                            CircleSpawn.Radius = 500.0f;
-                        }
-                        OutEvent.Circles.Add(CircleSpawn);
-                    }
-                }
+                NameIndices.Add(Name, static_cast<uint16>(NameStrings.Num()));
+                NameStrings.Add(Name.ToString());
             }
-            continue;
+        };
+        for (const FSpawnEvent& Event : Events)
+        {
+            for (const FTypeCount& TypeCount : Event.Linear)
+            {
+                AddName(TypeCount.Type);
+            }
+            for (const FCircleSpawn& Circle : Event.Circles)
+            {
+                AddName(Circle.Type);
+            }
+        }
+        for (const FBossSpawnEntry& Boss : BossEvents)
+        {
+            AddName(Boss.BossType);
+        }
+        check(NameStrings.Num() <= MAX_uint16);
+    }
+    Ar << NameStrings;
+
+    TArray<FName> Names;
+    for (const FString& NameString : NameStrings)
+    {
+        Names.Add(FName(*NameString));
+    }
+
+    auto SerializeName = [&Ar, &Names, &NameIndices](FName& Name)
+    {
+        uint16 Index = Ar.IsSaving() ? NameIndices.FindChecked(Name) : 0;
+        Ar << Index;
+        if (Ar.IsLoading())
+        {
+            if (!Names.IsValidIndex(Index))
+            {
+                Ar.SetError();
+                return;
+            }
+            Name = Names[Index];
+        }
+    };
+
+    auto SerializeMods = [&Ar](FEnemyInstanceModifiers& Mods)
+    {
+        // bit 0 big, bit 1 immovable, bit 2 valores numéricos diferentes do padrão
+        uint8 Flags = 0;
+        if (Ar.IsSaving())
+        {
+            const FEnemyInstanceModifiers Default;
+            const bool bCustom = Mods.DissolveSeconds != Default.DissolveSeconds || Mods.HealthMultiplier != Default.HealthMultiplier
+                || Mods.DamageMultiplier != Default.DamageMultiplier || Mods.SpeedMultiplier != Default.SpeedMultiplier
+                || Mods.ScaleMultiplier != Default.ScaleMultiplier || Mods.RewardMultiplier != Default.RewardMultiplier;
+            Flags = (Mods.bBig ? 1 : 0) | (Mods.bImmovable ? 2 : 0) | (bCustom ? 4 : 0);
+        }
+        Ar << Flags;
+        Mods.bBig = (Flags & 1) != 0;
+        Mods.bImmovable = (Flags & 2) != 0;
+        if (Flags & 4)
+        {
+            Ar << Mods.DissolveSeconds << Mods.HealthMultiplier << Mods.DamageMultiplier
+               << Mods.SpeedMultiplier << Mods.ScaleMultiplier << Mods.RewardMultiplier;
         }
-        
-        // Handle linear spawns - create FTypeCount for Linear array
-        FTypeCount TypeCount;
-        TypeCount.Type = FName(*EnemyTypeName);
-        
-        if (EnemyValue->Type == EJson::Number)
-        {
-            // Simple count: "NormalEnemy": 3
-            TypeCount.Count = FMath::Max(1, (int32)EnemyValue->AsNumber());
-        }
-        else if (EnemyValue->Type == EJson::Object)
-        {
-            // Complex object: "NormalEnemy": { "count": 3, "big": false }
-            const TSharedPtr<FJsonObject>& EnemyObject = EnemyValue->AsObject();
-            TypeCount.Count = FMath::Max(1, (int32)EnemyObject->GetNumberField(TEXT("count")));
-            
-            // Parse modifiers if present
-            const TSharedPtr<FJsonObject>* ModifiersObject = nullptr;
-            if (EnemyObject->TryGetObjectField(TEXT("modifiers"), ModifiersObject))
+    };
+
+    // Tamanhos gravados como int32; no load qualquer valor absurdo marca erro em vez de alocar
+    auto SerializeNum = [&Ar](auto& Array)
+    {
+        int32 Num = Array.Num();
+        Ar << Num;
+        if (Ar.IsLoading())
+        {
+            if (Num < 0 || Num > Ar.TotalSize())
             {
-                TypeCount.Mods = ParseModifiers(*ModifiersObject);
+                Ar.SetError();
+                Num = 0;
             }
+            Array.SetNum(Num);
+        }
+    };
+
+    SerializeNum(Events);
+    for (FSpawnEvent& Event : Events)
+    {
+        if (Ar.IsError())
+        {
+            return;
+        }
+
+        uint8 bAllowDuringBoss = Event.bAllowDuringBossEncounter ? 1 : 0;
+        Ar << Event.TimeSeconds << bAllowDuringBoss;
+        Event.bAllowDuringBossEncounter = bAllowDuringBoss != 0;
+
+        SerializeNum(Event.Linear);
+        for (FTypeCount& TypeCount : Event.Linear)
+        {
+            SerializeName(TypeCount.Type);
+            Ar << TypeCount.Count;
+            SerializeMods(TypeCount.Mods);
+        }
+
+        SerializeNum(Event.Circles);
+        for (FCircleSpawn& Circle : Event.Circles)
+        {
+            SerializeName(Circle.Type);
+            Ar << Circle.Count << Circle.Radius;
+            SerializeMods(Circle.Mods);
+        }
+    }
+
+    SerializeNum(BossEvents);
+    for (FBossSpawnEntry& Boss : BossEvents)
+    {
+        if (Ar.IsError())
+        {
+            return;
         }
-        
-        // Add to Linear array (which ExecuteSpawnEvent expects)
-        OutEvent.Linear.Add(TypeCount);
-        
-        UE_LOG(LogEnemySpawn, Verbose, TEXT("Added Linear spawn: %s x%d"), *TypeCount.Type.ToString(), TypeCount.Count);
+
+        SerializeName(Boss.BossType);
+        Ar << Boss.TimeSeconds << Boss.TriggerTime << Boss.WarningLeadTime << Boss.WarningDuration
+           << Boss.ResumeDelay << Boss.EntranceDistance;
+
+        uint8 Flags = (Boss.bFinalEncounter ? 1 : 0) | (Boss.bPauseRegularSpawns ? 2 : 0) | (Boss.bSpawnOutOfView ? 4 : 0);
+        Ar << Flags;
+        Boss.bFinalEncounter = (Flags & 1) != 0;
+        Boss.bPauseRegularSpawns = (Flags & 2) != 0;
+        Boss.bSpawnOutOfView = (Flags & 4) != 0;
+
+        FString Announcement = Boss.Announcement.ToString();
+        FString SoundPath = Boss.WarningSound ? Boss.WarningSound->GetPathName() : FString();
+        Ar << Announcement << SoundPath;
+        if (Ar.IsLoading())
+        {
+            Boss.Announcement = FText::FromString(Announcement);
+            Boss.WarningSound = SoundPath.IsEmpty() ? nullptr : LoadObject<USoundBase>(nullptr, *SoundPath);
+        }
+
+        SerializeMods(Boss.BossModifiers);
     }
 }
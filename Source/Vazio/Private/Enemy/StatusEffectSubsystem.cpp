@@ -0,0 +1,271 @@
+#include "Enemy/StatusEffectSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemyBase.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+static TAutoConsoleVariable<float> CVarStatusEffectRate(
+    TEXT("Enemy.StatusEffectRate"),
+    10.f,
+    TEXT("Frequência fixa (Hz) com que DoTs e slows são processados."),
+    ECVF_Default);
+
+// Máximo de passos fixos por frame; evita espiral de catch-up depois de um hitch
+static constexpr int32 MaxStatusStepsPerFrame = 3;
+
+void UStatusEffectSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Targets.Reserve(256);
+    SlotByEnemy.Reserve(256);
+
+    UE_LOG(LogEnemy, Log, TEXT("StatusEffectSubsystem initialized"));
+}
+
+void UStatusEffectSubsystem::Deinitialize()
+{
+    Targets.Empty();
+    SlotByEnemy.Empty();
+    Super::Deinitialize();
+}
+
+TStatId UStatusEffectSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UStatusEffectSubsystem, STATGROUP_Tickables);
+}
+
+void UStatusEffectSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (Targets.Num() == 0)
+    {
+        Accumulator = 0.f;
+        return;
+    }
+
+    const float StepSeconds = 1.f / FMath::Max(1.f, CVarStatusEffectRate.GetValueOnGameThread());
+    Accumulator = FMath::Min(Accumulator + DeltaTime, StepSeconds * MaxStatusStepsPerFrame);
+
+    while (Accumulator >= StepSeconds)
+    {
+        Accumulator -= StepSeconds;
+        StepEffects(StepSeconds);
+    }
+}
+
+void UStatusEffectSubsystem::ApplyEffect(AEnemyBase* Target, EStatusEffectType Type, float Duration, float Magnitude)
+{
+    if (!IsValid(Target) || Duration <= 0.f || Type == EStatusEffectType::Count)
+    {
+        return;
+    }
+
+    int32 Slot;
+    if (const int32* Existing = SlotByEnemy.Find(Target))
+    {
+        Slot = *Existing;
+    }
+    else
+    {
+        Slot = Targets.AddDefaulted();
+        Targets[Slot].Enemy = Target;
+        Targets[Slot].Key = Target;
+        SlotByEnemy.Add(Target, Slot);
+    }
+
+    FStatusTarget& Entry = Targets[Slot];
+    const int32 TypeIndex = static_cast<int32>(Type);
+    const uint8 Bit = 1 << TypeIndex;
+
+    if (Entry.ActiveMask & Bit)
+    {
+        Entry.Remaining[TypeIndex] = FMath::Max(Entry.Remaining[TypeIndex], Duration);
+        Entry.Magnitude[TypeIndex] = FMath::Max(Entry.Magnitude[TypeIndex], Magnitude);
+    }
+    else
+    {
+        Entry.Remaining[TypeIndex] = Duration;
+        Entry.Magnitude[TypeIndex] = Magnitude;
+        Entry.ActiveMask |= Bit;
+    }
+
+    UE_LOG(LogEnemy, VeryVerbose, TEXT("%s gained status %d (%.1fs, %.2f)"), *Target->GetName(), TypeIndex, Duration, Magnitude);
+}
+
+void UStatusEffectSubsystem::ClearEffects(AEnemyBase* Target)
+{
+    const int32* Slot = SlotByEnemy.Find(Target);
+    if (!Slot)
+    {
+        return;
+    }
+
+    if (bProcessing)
+    {
+        // Chamado de dentro do passo (ex.: morte por DoT); compacta no fim do passo
+        FStatusTarget& Entry = Targets[*Slot];
+        Entry.ActiveMask = 0;
+        if (Entry.AppliedSpeedScale != 1.f && IsValid(Target))
+        {
+            Target->SetStatusSpeedScale(1.f);
+        }
+        Entry.AppliedSpeedScale = 1.f;
+        return;
+    }
+
+    RemoveTargetAt(*Slot);
+}
+
+bool UStatusEffectSubsystem::HasEffect(AEnemyBase* Target, EStatusEffectType Type) const
+{
+    const int32* Slot = SlotByEnemy.Find(Target);
+    if (!Slot || Type == EStatusEffectType::Count)
+    {
+        return false;
+    }
+    return (Targets[*Slot].ActiveMask & (1 << static_cast<int32>(Type))) != 0;
+}
+
+int32 UStatusEffectSubsystem::GetNumActiveEffects() const
+{
+    int32 Count = 0;
+    for (const FStatusTarget& Entry : Targets)
+    {
+        Count += FMath::CountBits(Entry.ActiveMask);
+    }
+    return Count;
+}
+
+void UStatusEffectSubsystem::StepEffects(float StepSeconds)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VazioStatusEffects);
+
+    bProcessing = true;
+
+    // Alvos adicionados durante o passo (ApplyEffect vindo de callbacks de dano) só entram no próximo
+    const int32 NumTargets = Targets.Num();
+    for (int32 i = 0; i < NumTargets; ++i)
+    {
+        FStatusTarget& Entry = Targets[i];
+        AEnemyBase* Enemy = Entry.Enemy.Get();
+        if (!Enemy || Entry.ActiveMask == 0)
+        {
+            continue;
+        }
+
+        float Damage = 0.f;
+        float SpeedScale = 1.f;
+
+        for (int32 TypeIndex = 0; TypeIndex < NumEffectTypes; ++TypeIndex)
+        {
+            const uint8 Bit = 1 << TypeIndex;
+            if (!(Entry.ActiveMask & Bit))
+            {
+                continue;
+            }
+
+            const float Dt = FMath::Min(StepSeconds, Entry.Remaining[TypeIndex]);
+            Entry.Remaining[TypeIndex] -= StepSeconds;
+
+            switch (static_cast<EStatusEffectType>(TypeIndex))
+            {
+            case EStatusEffectType::Burn:
+            case EStatusEffectType::Poison:
+                Damage += Entry.Magnitude[TypeIndex] * Dt;
+                break;
+            case EStatusEffectType::Slow:
+                SpeedScale = FMath::Min(SpeedScale, 1.f - FMath::Clamp(Entry.Magnitude[TypeIndex], 0.f, 1.f));
+                break;
+            case EStatusEffectType::Freeze:
+                SpeedScale = 0.f;
+                break;
+            default:
+                break;
+            }
+
+            if (Entry.Remaining[TypeIndex] <= 0.f)
+            {
+                Entry.ActiveMask &= ~Bit;
+            }
+        }
+
+        if (SpeedScale != Entry.AppliedSpeedScale)
+        {
+            Entry.AppliedSpeedScale = SpeedScale;
+            Enemy->SetStatusSpeedScale(SpeedScale);
+        }
+
+        // Dano por último: pode matar o inimigo e reentrar em ClearEffects / ApplyEffect
+        if (Damage > 0.f)
+        {
+            Enemy->TakeDamageSimple(Damage);
+        }
+    }
+
+    bProcessing = false;
+
+    for (int32 i = Targets.Num() - 1; i >= 0; --i)
+    {
+        if (Targets[i].ActiveMask == 0 || !Targets[i].Enemy.IsValid())
+        {
+            RemoveTargetAt(i);
+        }
+    }
+}
+
+void UStatusEffectSubsystem::RemoveTargetAt(int32 Index)
+{
+    FStatusTarget& Entry = Targets[Index];
+    if (AEnemyBase* Enemy = Entry.Enemy.Get())
+    {
+        if (Entry.AppliedSpeedScale != 1.f)
+        {
+            Enemy->SetStatusSpeedScale(1.f);
+        }
+    }
+
+    SlotByEnemy.Remove(Entry.Key);
+    Targets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Targets.IsValidIndex(Index))
+    {
+        SlotByEnemy.Add(Targets[Index].Key, Index);
+    }
+}
+
+// Console helper: aplica um efeito em todos os inimigos vivos (Enemy.ApplyStatus Burn 5 10)
+static FAutoConsoleCommandWithWorldAndArgs CmdEnemyApplyStatus(
+    TEXT("Enemy.ApplyStatus"),
+    TEXT("Enemy.ApplyStatus <Burn|Poison|Slow|Freeze> <Duration> <Magnitude> - aplica o efeito em todos AEnemyBase vivos"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        UStatusEffectSubsystem* StatusEffects = World ? World->GetSubsystem<UStatusEffectSubsystem>() : nullptr;
+        if (!StatusEffects || Args.Num() < 2)
+        {
+            return;
+        }
+
+        const int64 TypeValue = StaticEnum<EStatusEffectType>()->GetValueByNameString(Args[0]);
+        if (TypeValue == INDEX_NONE)
+        {
+            UE_LOG(LogEnemy, Warning, TEXT("[Enemy.ApplyStatus] Tipo desconhecido: %s"), *Args[0]);
+            return;
+        }
+
+        const float Duration = FCString::Atof(*Args[1]);
+        const float Magnitude = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 0.f;
+
+        int32 Count = 0;
+        for (TActorIterator<AEnemyBase> It(World); It; ++It)
+        {
+            if (IsValid(*It) && !It->IsHidden())
+            {
+                StatusEffects->ApplyEffect(*It, static_cast<EStatusEffectType>(TypeValue), Duration, Magnitude);
+                ++Count;
+            }
+        }
+        UE_LOG(LogEnemy, Log, TEXT("[Enemy.ApplyStatus] %s aplicado em %d inimigos"), *Args[0], Count);
+    }),
+    ECVF_Default
+);
@@ -1,8 +1,11 @@
 ﻿#include "Enemy/Types/BossEnemy.h"
+#include "Core/VazioStats.h"
+#include "Enemy/BossProjectileSubsystem.h"
 #include "Enemy/EnemySpawnerSubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Core/GameplayTrace.h"
 
 FBossAttackPattern::FBossAttackPattern()
 {
@@ -41,10 +44,7 @@ ABossEnemy::ABossEnemy()
 
     CurrentPhaseIndex = INDEX_NONE;
     CurrentPatternIndex = 0;
-    AttackTimer = 0.f;
     SummonTimer = 0.f;
-    bTelegraphActive = false;
-    bHasCurrentPattern = false;
     CachedMaxHP = 0.f;
 
     bUseBaseChase = false;
@@ -59,13 +59,10 @@ void ABossEnemy::BeginPlay()
 
     CachedMaxHP = MaxHP > 0.f ? MaxHP : FMath::Max(CurrentHP, 1.f);
 
-    Phases.Sort([](const FBossPhaseDefinition& A, const FBossPhaseDefinition& B)
-    {
-        return A.HealthThreshold > B.HealthThreshold;
-    });
-
     CacheSpawner();
+    CompileAttackPatterns();
 
+    LastEvaluatedHP = CurrentHP;
     if (Phases.Num() > 0)
     {
         EnterPhase(0);
@@ -73,7 +70,7 @@ void ABossEnemy::BeginPlay()
 
     // Log da posição inicial do boss
     const FVector InitialLocation = GetActorLocation();
-    UE_LOG(LogBoss, Warning, TEXT("[BossPosition] %s BeginPlay at location: X=%.2f, Y=%.2f, Z=%.2f"), 
+    UE_LOG(LogBoss, Log, TEXT("[BossPosition] %s BeginPlay at location: X=%.2f, Y=%.2f, Z=%.2f"), 
            *GetName(), InitialLocation.X, InitialLocation.Y, InitialLocation.Z);
     LastLoggedPosition = InitialLocation;
     LastPositionLogTime = GetWorld()->GetTimeSeconds();
@@ -83,12 +80,22 @@ void ABossEnemy::BeginPlay()
 
 void ABossEnemy::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioTickBoss);
+
     Super::Tick(DeltaTime);
 
-    EvaluatePhase();
+    if (CurrentHP != LastEvaluatedHP)
+    {
+        EvaluatePhase();
+    }
     PerformMovementPattern(DeltaTime);
     HandleSummoning(DeltaTime);
-    TickAttackCycle(DeltaTime);
+
+    // Ciclo cancelado (boss reciclado do pool) com padrões na fase: religa
+    if (AttackState == EBossAttackState::Idle && CompiledPhases.IsValidIndex(CurrentPhaseIndex) && CompiledPhases[CurrentPhaseIndex].NumPatterns > 0)
+    {
+        ScheduleAttackState(EBossAttackState::Cooldown, CompiledPhases[CurrentPhaseIndex].AttackInterval);
+    }
 }
 
 void ABossEnemy::HandleDeath(bool bIsParentParam)
@@ -99,6 +106,17 @@ void ABossEnemy::HandleDeath(bool bIsParentParam)
     Super::HandleDeath(bIsParentParam);
 }
 
+void ABossEnemy::ResetCooldowns()
+{
+    Super::ResetCooldowns();
+    CancelAttackCycle();
+
+    if (UBossProjectileSubsystem* Bullets = GetWorld() ? GetWorld()->GetSubsystem<UBossProjectileSubsystem>() : nullptr)
+    {
+        Bullets->CancelEmitters(this);
+    }
+}
+
 float ABossEnemy::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
     const float AppliedDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
@@ -119,32 +137,68 @@ FBossPhaseDefinition ABossEnemy::GetCurrentPhase() const
     return Phase ? *Phase : FBossPhaseDefinition();
 }
 
+void ABossEnemy::CompileAttackPatterns()
+{
+    CompiledPatterns.Reset();
+    CompiledPhases.Reset(Phases.Num());
+
+    // Limiar decrescente; CompiledPhases[i] continua sendo Phases[i] (índice usado no HUD/delegates)
+    Phases.StableSort([](const FBossPhaseDefinition& A, const FBossPhaseDefinition& B)
+    {
+        return A.HealthThreshold > B.HealthThreshold;
+    });
+
+    int32 NumUnhandled = 0;
+    for (const FBossPhaseDefinition& Phase : Phases)
+    {
+        FCompiledBossPhase& CompiledPhase = CompiledPhases.AddDefaulted_GetRef();
+        CompiledPhase.Threshold = FMath::Clamp(Phase.HealthThreshold, 0.f, 1.f);
+        CompiledPhase.AttackInterval = Phase.AttackIntervalOverride > 0.f ? Phase.AttackIntervalOverride : DefaultAttackInterval;
+        CompiledPhase.FirstPattern = CompiledPatterns.Num();
+        CompiledPhase.NumPatterns = Phase.AttackPatterns.Num();
+
+        for (const FBossAttackPattern& Pattern : Phase.AttackPatterns)
+        {
+            FCompiledBossPattern& Compiled = CompiledPatterns.AddDefaulted_GetRef();
+            Compiled.Pattern = Pattern;
+            if (const int32* HandlerIndex = AttackHandlerIndices.Find(Pattern.PatternName))
+            {
+                Compiled.HandlerIndex = *HandlerIndex;
+            }
+            else
+            {
+                ++NumUnhandled;
+            }
+        }
+    }
+
+    UE_LOG(LogBoss, Verbose, TEXT("Boss %s compiled %d phases, %d patterns (%d data-only)"),
+           *GetName(), CompiledPhases.Num(), CompiledPatterns.Num(), NumUnhandled);
+}
+
 void ABossEnemy::EvaluatePhase()
 {
-    if (Phases.Num() == 0)
+    LastEvaluatedHP = CurrentHP;
+
+    if (CompiledPhases.Num() == 0)
     {
         return;
     }
 
     const float HealthFraction = GetHealthFraction();
 
-    int32 DesiredIndex = INDEX_NONE;
-    for (int32 Index = 0; Index < Phases.Num(); ++Index)
+    // Limiares ordenados (decrescente) e clampados no CompileAttackPatterns: a última fase
+    // cujo limiar ainda cobre a vida atual é a mais avançada
+    int32 DesiredIndex = CompiledPhases.Num() - 1;
+    for (int32 Index = CompiledPhases.Num() - 1; Index >= 0; --Index)
     {
-        const float Threshold = FMath::Clamp(Phases[Index].HealthThreshold, 0.f, 1.f);
-        if (HealthFraction <= Threshold)
+        if (HealthFraction <= CompiledPhases[Index].Threshold)
         {
             DesiredIndex = Index;
+            break;
         }
     }
 
-    if (DesiredIndex == INDEX_NONE)
-    {
-        DesiredIndex = Phases.Num() - 1;
-    }
-
-    DesiredIndex = FMath::Clamp(DesiredIndex, 0, Phases.Num() - 1);
-
     if (DesiredIndex != CurrentPhaseIndex)
     {
         EnterPhase(DesiredIndex);
@@ -160,17 +214,12 @@ void ABossEnemy::EnterPhase(int32 NewPhaseIndex)
 
     CurrentPhaseIndex = NewPhaseIndex;
     CurrentPatternIndex = 0;
-    bTelegraphActive = false;
-    bHasCurrentPattern = false;
+    CancelAttackCycle();
 
     const FBossPhaseDefinition& NewPhase = Phases[CurrentPhaseIndex];
     SummonTimer = NewPhase.SummonInterval > 0.f ? NewPhase.SummonInterval : 0.f;
 
-    if (UCharacterMovementComponent* Movement = GetCharacterMovement())
-    {
-        const float SpeedMultiplier = FMath::Max(0.1f, NewPhase.MovementSpeedMultiplier);
-        Movement->MaxWalkSpeed = CurrentArchetype.BaseSpeed * SpeedMultiplier;
-    }
+    SetBaseWalkSpeed(CurrentArchetype.BaseSpeed * FMath::Max(0.1f, NewPhase.MovementSpeedMultiplier));
 
     HandlePhaseStarted(NewPhase);
     OnBossPhaseChanged.Broadcast(CurrentPhaseIndex, NewPhase);
@@ -180,114 +229,140 @@ void ABossEnemy::EnterPhase(int32 NewPhaseIndex)
 
 void ABossEnemy::HandlePhaseStarted(const FBossPhaseDefinition& Phase)
 {
-    if (Phase.AttackIntervalOverride > 0.f)
+    ScheduleAttackState(EBossAttackState::Cooldown, Phase.AttackIntervalOverride > 0.f ? Phase.AttackIntervalOverride : DefaultAttackInterval);
+}
+
+void ABossEnemy::ScheduleAttackState(EBossAttackState NewState, float DelaySeconds)
+{
+    UEnemyCooldownSubsystem* Cooldowns = GetCooldowns();
+    if (!Cooldowns)
     {
-        AttackTimer = Phase.AttackIntervalOverride;
+        AttackState = EBossAttackState::Idle;
+        return;
+    }
+
+    AttackState = NewState;
+    Cooldowns->Schedule(AttackHandle, FMath::Max(0.f, DelaySeconds), FSimpleDelegate::CreateUObject(this, &ABossEnemy::OnAttackTimerElapsed));
+}
+
+void ABossEnemy::CancelAttackCycle()
+{
+    if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
+    {
+        Cooldowns->Cancel(AttackHandle);
     }
     else
     {
-        AttackTimer = DefaultAttackInterval;
+        AttackHandle.Invalidate();
     }
+
+    AttackState = EBossAttackState::Idle;
+    CurrentPatternId = INDEX_NONE;
 }
 
-void ABossEnemy::TickAttackCycle(float DeltaTime)
+void ABossEnemy::OnAttackTimerElapsed()
 {
-    if (!Phases.IsValidIndex(CurrentPhaseIndex))
+    const EBossAttackState ElapsedState = AttackState;
+    AttackState = EBossAttackState::Idle;
+
+    // Devolvido ao pool no meio do ciclo (ex.: morreu durante o handler): o Tick religa no reuso
+    if (!IsActorTickEnabled())
     {
+        CurrentPatternId = INDEX_NONE;
         return;
     }
 
-    const FBossPhaseDefinition& Phase = Phases[CurrentPhaseIndex];
-    if (Phase.AttackPatterns.Num() == 0)
+    if (ElapsedState == EBossAttackState::Telegraph)
     {
+        ExecuteAttackPattern(CurrentPatternId);
         return;
     }
 
-    AttackTimer -= DeltaTime;
-
-    if (bTelegraphActive)
+    if (!CompiledPhases.IsValidIndex(CurrentPhaseIndex))
     {
-        if (AttackTimer <= 0.f)
-        {
-            FinishTelegraph();
-        }
         return;
     }
 
-    if (AttackTimer > 0.f)
+    const FCompiledBossPhase& Phase = CompiledPhases[CurrentPhaseIndex];
+    if (Phase.NumPatterns == 0)
     {
         return;
     }
 
-    if (!Phase.AttackPatterns.IsValidIndex(CurrentPatternIndex))
+    if (CurrentPatternIndex >= Phase.NumPatterns)
     {
-        CurrentPatternIndex = bLoopPhasePatterns ? 0 : FMath::Clamp(CurrentPatternIndex, 0, Phase.AttackPatterns.Num() - 1);
+        CurrentPatternIndex = bLoopPhasePatterns ? 0 : Phase.NumPatterns - 1;
     }
 
-    CurrentPattern = Phase.AttackPatterns[CurrentPatternIndex];
-    bHasCurrentPattern = true;
-
-    if (Phase.AttackPatterns.Num() > 0)
-    {
-        if (bLoopPhasePatterns)
-        {
-            CurrentPatternIndex = (CurrentPatternIndex + 1) % Phase.AttackPatterns.Num();
-        }
-        else
-        {
-            CurrentPatternIndex = FMath::Min(CurrentPatternIndex + 1, Phase.AttackPatterns.Num() - 1);
-        }
-    }
+    const int32 PatternId = Phase.FirstPattern + CurrentPatternIndex;
+    CurrentPatternIndex = bLoopPhasePatterns
+        ? (CurrentPatternIndex + 1) % Phase.NumPatterns
+        : FMath::Min(CurrentPatternIndex + 1, Phase.NumPatterns - 1);
 
-    StartTelegraph(CurrentPattern);
+    StartTelegraph(PatternId);
 }
 
-void ABossEnemy::StartTelegraph(const FBossAttackPattern& Pattern)
+void ABossEnemy::StartTelegraph(int32 PatternId)
 {
+    const FBossAttackPattern& Pattern = CompiledPatterns[PatternId].Pattern;
     const float TelegraphDuration = FMath::Max(0.f, Pattern.TelegraphTime);
 
     if (TelegraphDuration > 0.f)
     {
-        bTelegraphActive = true;
-        AttackTimer = TelegraphDuration;
+        CurrentPatternId = PatternId;
+        ScheduleAttackState(EBossAttackState::Telegraph, TelegraphDuration);
         OnBossTelegraph.Broadcast(Pattern);
         UE_LOG(LogBoss, VeryVerbose, TEXT("Boss %s telegraphing pattern %s for %.2fs"), *GetName(), *Pattern.PatternName.ToString(), TelegraphDuration);
     }
     else
     {
-        ExecuteAttackPattern(Pattern);
+        ExecuteAttackPattern(PatternId);
     }
 }
 
-void ABossEnemy::FinishTelegraph()
+void ABossEnemy::ExecuteAttackPattern(int32 PatternId)
 {
-    bTelegraphActive = false;
+    CurrentPatternId = INDEX_NONE;
+    if (!CompiledPatterns.IsValidIndex(PatternId))
+    {
+        return;
+    }
+
+    const FCompiledBossPattern& Compiled = CompiledPatterns[PatternId];
+    const FBossAttackPattern& Pattern = Compiled.Pattern;
 
-    if (bHasCurrentPattern)
+    if (AttackHandlers.IsValidIndex(Compiled.HandlerIndex))
     {
-        ExecuteAttackPattern(CurrentPattern);
+        AttackHandlers[Compiled.HandlerIndex].ExecuteIfBound();
+    }
+    else
+    {
+        PerformAttackPattern(Pattern);
     }
-}
 
-void ABossEnemy::ExecuteAttackPattern(const FBossAttackPattern& Pattern)
-{
-    PerformAttackPattern(Pattern);
+    if (Pattern.Bullets.Num() > 0)
+    {
+        if (UBossProjectileSubsystem* Bullets = GetWorld()->GetSubsystem<UBossProjectileSubsystem>())
+        {
+            for (const FBossBulletEmitter& Emitter : Pattern.Bullets)
+            {
+                Bullets->Emit(this, Emitter);
+            }
+        }
+    }
     OnBossAttackExecuted.Broadcast(Pattern);
 
-    const FBossPhaseDefinition* Phase = GetCurrentPhasePtr();
-
     float NextInterval = DefaultAttackInterval;
     if (Pattern.Cooldown > 0.f)
     {
         NextInterval = Pattern.Cooldown;
     }
-    else if (Phase && Phase->AttackIntervalOverride > 0.f)
+    else if (CompiledPhases.IsValidIndex(CurrentPhaseIndex))
     {
-        NextInterval = Phase->AttackIntervalOverride;
+        NextInterval = CompiledPhases[CurrentPhaseIndex].AttackInterval;
     }
 
-    AttackTimer = FMath::Max(0.1f, NextInterval);
-    bHasCurrentPattern = false;
+    ScheduleAttackState(EBossAttackState::Cooldown, FMath::Max(0.1f, NextInterval));
 
     if (Pattern.bSummonsMinions)
     {
@@ -332,8 +407,7 @@ void ABossEnemy::PerformMovementPattern(float DeltaTime)
     
     if (DistanceFromLastLog > 200.f || TimeSinceLastLog > 5.f) // Log a cada 200 unidades de movimento ou a cada 5 segundos
     {
-        UE_LOG(LogBoss, Warning, TEXT("[BossMovement] %s moved to: X=%.2f, Y=%.2f, Z=%.2f (Distance from last: %.2f)"), 
-               *GetName(), NewLocation.X, NewLocation.Y, NewLocation.Z, DistanceFromLastLog);
+        VAZIO_TRACE(Boss, "BossMovement", "X Y Z Dist", this, NewLocation.X, NewLocation.Y, NewLocation.Z, DistanceFromLastLog);
         LastLoggedPosition = NewLocation;
         LastPositionLogTime = CurrentTime;
     }
@@ -384,19 +458,24 @@ void ABossEnemy::SpawnSummonedMinions(FName MinionType, int32 Count, float Radiu
         return;
     }
 
-    const FVector Origin = GetActorLocation();
-    const int32 ValidCount = FMath::Max(1, Count);
+    Spawner->SummonBossMinions(this, MinionType, Count, Radius, Mods);
+}
 
-    for (int32 Index = 0; Index < ValidCount; ++Index)
+void ABossEnemy::GetSummonTypes(TArray<FName>& OutTypes) const
+{
+    for (const FBossPhaseDefinition& Phase : Phases)
     {
-        const float Angle = (2.f * PI * Index) / ValidCount;
-        FVector Offset = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * Radius;
-        Offset.Z = 0.f;
-
-        const FVector SpawnLocation = Origin + Offset;
-        const FTransform SpawnTransform(GetActorRotation(), SpawnLocation);
-
-        Spawner->SpawnOne(MinionType, SpawnTransform, Mods);
+        if (Phase.bEnableSummoningLoop && !Phase.SummonType.IsNone())
+        {
+            OutTypes.AddUnique(Phase.SummonType);
+        }
+        for (const FBossAttackPattern& Pattern : Phase.AttackPatterns)
+        {
+            if (Pattern.bSummonsMinions && !Pattern.MinionType.IsNone())
+            {
+                OutTypes.AddUnique(Pattern.MinionType);
+            }
+        }
     }
 }
 
@@ -3,7 +3,6 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 
 ABurrowerBoss::ABurrowerBoss()
 {
@@ -62,40 +61,17 @@ ABurrowerBoss::ABurrowerBoss()
     PhaseTwo.SummonRadius = 550.f;
 
     Phases = { PhaseOne, PhaseTwo };
+
+    RegisterAttackHandler(TEXT("Burrow"), &ABurrowerBoss::StartBurrow);
+    RegisterAttackHandler(TEXT("Ambush"), &ABurrowerBoss::PerformAmbushStrike);
+    RegisterAttackHandler(TEXT("SpikeBurst"), &ABurrowerBoss::PerformSpikeBurst);
 }
 
 void ABurrowerBoss::HandlePhaseStarted(const FBossPhaseDefinition& Phase)
 {
     Super::HandlePhaseStarted(Phase);
 
-    if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-    {
-        MoveComp->MaxWalkSpeed = CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier;
-    }
-}
-
-void ABurrowerBoss::PerformAttackPattern(const FBossAttackPattern& Pattern)
-{
-    if (Pattern.PatternName == TEXT("Burrow"))
-    {
-        StartBurrow();
-    }
-    else if (Pattern.PatternName == TEXT("Ambush"))
-    {
-        PerformAmbushStrike();
-    }
-    else if (Pattern.PatternName == TEXT("SpikeBurst"))
-    {
-        PerformSpikeBurst();
-    }
-    else if (Pattern.PatternName == TEXT("SummonLarvae"))
-    {
-        UE_LOG(LogBoss, Log, TEXT("%s summons larvae"), *GetName());
-    }
-    else
-    {
-        Super::PerformAttackPattern(Pattern);
-    }
+    SetBaseWalkSpeed(CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier);
 }
 
 void ABurrowerBoss::PerformMovementPattern(float DeltaTime)
@@ -136,9 +112,9 @@ void ABurrowerBoss::StartBurrow()
         Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     }
 
-    if (UWorld* World = GetWorld())
+    if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
     {
-        World->GetTimerManager().SetTimer(BurrowTimerHandle, this, &ABurrowerBoss::FinishBurrow, BurrowDuration, false);
+        Cooldowns->Schedule(BurrowTimerHandle, BurrowDuration, FSimpleDelegate::CreateUObject(this, &ABurrowerBoss::FinishBurrow));
     }
 
     UE_LOG(LogBoss, Log, TEXT("%s burrowed underground"), *GetName());
@@ -146,9 +122,9 @@ void ABurrowerBoss::StartBurrow()
 
 void ABurrowerBoss::FinishBurrow()
 {
-    if (UWorld* World = GetWorld())
+    if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
     {
-        World->GetTimerManager().ClearTimer(BurrowTimerHandle);
+        Cooldowns->Cancel(BurrowTimerHandle);
     }
 
     if (!bIsBurrowed)
@@ -1,8 +1,8 @@
 #include "Enemy/Types/DashEnemy.h"
+#include "Core/VazioStats.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
 #include "Enemy/EnemyTypes.h"
 
 ADashEnemy::ADashEnemy()
@@ -19,18 +19,46 @@ ADashEnemy::ADashEnemy()
 void ADashEnemy::BeginPlay()
 {
     Super::BeginPlay();
+    RegisterForDecisions(TEXT("DashEnemy"));
 }
 
 void ADashEnemy::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioTickDash);
+
     Super::Tick(DeltaTime);
     
-    if (!CurrentModifiers.bImmovable)
+    if (!CurrentModifiers.bImmovable && !IsStatusFrozen())
     {
+        if (!IsDecisionScheduled())
+        {
+            MakeDecision();
+        }
         HandleDashBehavior(DeltaTime);
     }
 }
 
+void ADashEnemy::MakeDecision()
+{
+    if (bIsDashing || !bCanDash || !CurrentArchetype.bCanDash || CurrentModifiers.bImmovable || IsStatusFrozen())
+    {
+        return;
+    }
+
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    if (!PlayerPawn)
+    {
+        return;
+    }
+
+    // Check if we should dash
+    const float DistanceToPlayer = FVector::Dist(PlayerPawn->GetActorLocation(), GetActorLocation());
+    if (DistanceToPlayer >= MinDashDistance && DistanceToPlayer <= CurrentArchetype.DashDistance * 1.5f)
+    {
+        ExecuteDash();
+    }
+}
+
 void ADashEnemy::HandleDashBehavior(float DeltaTime)
 {
     APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
@@ -60,13 +88,18 @@ void ADashEnemy::HandleDashBehavior(float DeltaTime)
             bCanDash = false;
             
             // Start cooldown
-            GetWorld()->GetTimerManager().SetTimer(
-                DashCooldownTimerHandle,
-                this,
-                &ADashEnemy::OnDashCooldownComplete,
-                CurrentArchetype.DashCooldown,
-                false
-            );
+            if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
+            {
+                Cooldowns->Schedule(
+                    DashCooldownTimerHandle,
+                    CurrentArchetype.DashCooldown,
+                    FSimpleDelegate::CreateUObject(this, &ADashEnemy::OnDashCooldownComplete)
+                );
+            }
+            else
+            {
+                bCanDash = true;
+            }
             
             UE_LOG(LogEnemy, VeryVerbose, TEXT("%s completed dash, cooldown started"), *GetName());
         }
@@ -77,17 +110,11 @@ void ADashEnemy::HandleDashBehavior(float DeltaTime)
         if (DistanceToPlayer > 150.f)
         {
             // Move towards player normally
-            AddMovementInput(Direction, 1.0f);
+            AddMovementInput(GetSimSteerDirection(Direction), 1.0f);
         }
         
-        // Face the player
+        // Face the player (dash start is decided in MakeDecision)
         SetActorRotation(FRotationMatrix::MakeFromX(Direction).Rotator());
-        
-        // Check if we should dash
-        if (bCanDash && CurrentArchetype.bCanDash && DistanceToPlayer >= MinDashDistance && DistanceToPlayer <= CurrentArchetype.DashDistance * 1.5f)
-        {
-            ExecuteDash();
-        }
     }
 }
 
@@ -107,6 +134,19 @@ void ADashEnemy::ExecuteDash()
     UE_LOG(LogEnemy, Log, TEXT("%s executing dash towards player"), *GetName());
 }
 
+void ADashEnemy::ResetCooldowns()
+{
+    Super::ResetCooldowns();
+
+    if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
+    {
+        Cooldowns->Cancel(DashCooldownTimerHandle);
+    }
+    bIsDashing = false;
+    bCanDash = true;
+    DashTimeRemaining = 0.f;
+}
+
 void ADashEnemy::OnDashCooldownComplete()
 {
     bCanDash = true;
@@ -1,4 +1,4 @@
-#include "Enemy/Types/FallenWarlordBoss.h"
+﻿#include "Enemy/Types/FallenWarlordBoss.h"
 #include "Kismet/GameplayStatics.h"
 // TODO: FallenSwordWeapon was removed with Swarm system - implement boss weapon if needed
 #include "GameFramework/CharacterMovementComponent.h"
@@ -56,6 +56,10 @@ AFallenWarlordBoss::AFallenWarlordBoss()
     PhaseTwo.SummonRadius = 600.f;
 
     Phases = { PhaseOne, PhaseTwo };
+
+    RegisterAttackHandler(TEXT("BladeSweep"), &AFallenWarlordBoss::PerformGreatswordSweep);
+    RegisterAttackHandler(TEXT("FlameWave"), &AFallenWarlordBoss::PerformFlameWave);
+    RegisterAttackHandler(TEXT("EarthShatter"), &AFallenWarlordBoss::PerformEarthShatter);
 }
 
 void AFallenWarlordBoss::BeginPlay()
@@ -89,30 +93,7 @@ void AFallenWarlordBoss::HandlePhaseStarted(const FBossPhaseDefinition& Phase)
 
     MovementRadius = Phase.HealthThreshold > 0.6f ? 450.f : 350.f;
 
-    if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-    {
-        MoveComp->MaxWalkSpeed = CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier;
-    }
-}
-
-void AFallenWarlordBoss::PerformAttackPattern(const FBossAttackPattern& Pattern)
-{
-    if (Pattern.PatternName == TEXT("BladeSweep"))
-    {
-        PerformGreatswordSweep();
-    }
-    else if (Pattern.PatternName == TEXT("FlameWave"))
-    {
-        PerformFlameWave();
-    }
-    else if (Pattern.PatternName == TEXT("EarthShatter"))
-    {
-        PerformEarthShatter();
-    }
-    else
-    {
-        Super::PerformAttackPattern(Pattern);
-    }
+    SetBaseWalkSpeed(CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier);
 }
 
 void AFallenWarlordBoss::PerformMovementPattern(float DeltaTime)
@@ -1,4 +1,5 @@
 #include "Enemy/Types/GoldEnemy.h"
+#include "Core/VazioStats.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
@@ -11,10 +12,7 @@ AGoldEnemy::AGoldEnemy()
     StoppingDistance = 100.f;
     
     // Gold enemies are slower
-    if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
-    {
-        MovementComp->MaxWalkSpeed = PursuitSpeed;
-    }
+    SetBaseWalkSpeed(PursuitSpeed);
 }
 
 void AGoldEnemy::BeginPlay()
@@ -24,9 +22,11 @@ void AGoldEnemy::BeginPlay()
 
 void AGoldEnemy::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioTickGold);
+
     Super::Tick(DeltaTime);
     
-    if (!CurrentModifiers.bImmovable)
+    if (!CurrentModifiers.bImmovable && !IsStatusFrozen())
     {
         PursuePlayer(DeltaTime);
     }
@@ -48,7 +48,7 @@ void AGoldEnemy::PursuePlayer(float DeltaTime)
         FVector Direction = ToPlayer.GetSafeNormal();
         
         // Move towards player (slowly)
-        AddMovementInput(Direction, 1.0f);
+        AddMovementInput(GetSimSteerDirection(Direction), 1.0f);
         
         // Face the player
         SetActorRotation(FRotationMatrix::MakeFromX(Direction).Rotator());
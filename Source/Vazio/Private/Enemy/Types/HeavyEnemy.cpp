@@ -1,4 +1,5 @@
 #include "Enemy/Types/HeavyEnemy.h"
+#include "Core/VazioStats.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
@@ -11,10 +12,7 @@ AHeavyEnemy::AHeavyEnemy()
     StoppingDistance = 120.f;
     
     // Heavy enemies are tankier
-    if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
-    {
-        MovementComp->MaxWalkSpeed = HeavyPursuitSpeed;
-    }
+    SetBaseWalkSpeed(HeavyPursuitSpeed);
 }
 
 void AHeavyEnemy::BeginPlay()
@@ -24,9 +22,11 @@ void AHeavyEnemy::BeginPlay()
 
 void AHeavyEnemy::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioTickHeavy);
+
     Super::Tick(DeltaTime);
     
-    if (!CurrentModifiers.bImmovable)
+    if (!CurrentModifiers.bImmovable && !IsStatusFrozen())
     {
         PursuePlayer(DeltaTime);
     }
@@ -48,7 +48,7 @@ void AHeavyEnemy::PursuePlayer(float DeltaTime)
         FVector Direction = ToPlayer.GetSafeNormal();
         
         // Move towards player (slower than normal enemy)
-        AddMovementInput(Direction, 1.0f);
+        AddMovementInput(GetSimSteerDirection(Direction), 1.0f);
         
         // Face the player
         FRotator TargetRotation = FRotationMatrix::MakeFromX(Direction).Rotator();
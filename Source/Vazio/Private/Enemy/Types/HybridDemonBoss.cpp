@@ -38,6 +38,30 @@ AHybridDemonBoss::AHybridDemonBoss()
     OblivionVolley.PatternName = TEXT("OblivionProjectiles");
     OblivionVolley.TelegraphTime = 1.8f;
     OblivionVolley.Cooldown = 9.0f;
+    {
+        // Espiral densa + leque mirado no jogador
+        FBossBulletEmitter Spiral;
+        Spiral.Shape = EBossBulletShape::Spiral;
+        Spiral.Count = 24;
+        Spiral.Volleys = 8;
+        Spiral.VolleyInterval = 0.2f;
+        Spiral.SpinPerVolley = 7.5f;
+        Spiral.Speed = 650.f;
+        Spiral.Damage = InfernoDamage * 0.25f;
+        Spiral.Radius = 24.f;
+
+        FBossBulletEmitter Fan;
+        Fan.Shape = EBossBulletShape::Fan;
+        Fan.Count = 9;
+        Fan.Volleys = 3;
+        Fan.VolleyInterval = 0.4f;
+        Fan.SpreadDegrees = 50.f;
+        Fan.bAimAtPlayer = true;
+        Fan.Speed = 900.f;
+        Fan.Damage = InfernoDamage * 0.3f;
+
+        OblivionVolley.Bullets = { Spiral, Fan };
+    }
 
     FBossAttackPattern Cataclysm;
     Cataclysm.PatternName = TEXT("Cataclysm");
@@ -74,40 +98,17 @@ AHybridDemonBoss::AHybridDemonBoss()
     PhaseThree.SummonRadius = 850.f;
 
     Phases = { PhaseOne, PhaseTwo, PhaseThree };
+
+    RegisterAttackHandler(TEXT("InfernoRain"), &AHybridDemonBoss::PerformInfernoRain);
+    RegisterAttackHandler(TEXT("ShadowDash"), &AHybridDemonBoss::PerformShadowDash);
+    RegisterAttackHandler(TEXT("Cataclysm"), &AHybridDemonBoss::PerformCataclysm);
 }
 
 void AHybridDemonBoss::HandlePhaseStarted(const FBossPhaseDefinition& Phase)
 {
     Super::HandlePhaseStarted(Phase);
 
-    if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-    {
-        MoveComp->MaxWalkSpeed = CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier;
-    }
-}
-
-void AHybridDemonBoss::PerformAttackPattern(const FBossAttackPattern& Pattern)
-{
-    if (Pattern.PatternName == TEXT("InfernoRain"))
-    {
-        PerformInfernoRain();
-    }
-    else if (Pattern.PatternName == TEXT("ShadowDash"))
-    {
-        PerformShadowDash();
-    }
-    else if (Pattern.PatternName == TEXT("OblivionProjectiles"))
-    {
-        PerformOblivionProjectiles();
-    }
-    else if (Pattern.PatternName == TEXT("Cataclysm"))
-    {
-        PerformCataclysm();
-    }
-    else
-    {
-        Super::PerformAttackPattern(Pattern);
-    }
+    SetBaseWalkSpeed(CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier);
 }
 
 void AHybridDemonBoss::PerformMovementPattern(float DeltaTime)
@@ -146,25 +147,6 @@ void AHybridDemonBoss::PerformShadowDash()
     UE_LOG(LogBoss, Log, TEXT("%s executed Shadow Dash"), *GetName());
 }
 
-void AHybridDemonBoss::PerformOblivionProjectiles()
-{
-    if (!GetWorld())
-    {
-        return;
-    }
-
-    const FVector Origin = GetActorLocation();
-    for (int32 Index = 0; Index < 6; ++Index)
-    {
-        const float Angle = (2.f * PI * Index) / 6;
-        FVector Offset = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * 600.f;
-        FVector ImpactLocation = Origin + Offset;
-        UGameplayStatics::ApplyRadialDamage(GetWorld(), InfernoDamage * 0.75f, ImpactLocation, 280.f, nullptr, TArray<AActor*>(), this);
-    }
-
-    UE_LOG(LogBoss, Log, TEXT("%s released Oblivion projectiles"), *GetName());
-}
-
 void AHybridDemonBoss::PerformCataclysm()
 {
     FVector Origin = GetActorLocation();
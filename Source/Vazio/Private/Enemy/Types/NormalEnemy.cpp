@@ -1,4 +1,5 @@
 #include "Enemy/Types/NormalEnemy.h"
+#include "Core/VazioStats.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
@@ -18,9 +19,11 @@ void ANormalEnemy::BeginPlay()
 
 void ANormalEnemy::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioTickNormal);
+
     Super::Tick(DeltaTime);
     
-    if (!CurrentModifiers.bImmovable)
+    if (!CurrentModifiers.bImmovable && !IsStatusFrozen())
     {
         PursuePlayer(DeltaTime);
     }
@@ -42,7 +45,7 @@ void ANormalEnemy::PursuePlayer(float DeltaTime)
         FVector Direction = ToPlayer.GetSafeNormal();
         
         // Move towards player
-        AddMovementInput(Direction, 1.0f);
+        AddMovementInput(GetSimSteerDirection(Direction), 1.0f);
         
         // Face the player
         SetActorRotation(FRotationMatrix::MakeFromX(Direction).Rotator());
@@ -1,10 +1,11 @@
 #include "Enemy/Types/RangedEnemy.h"
+#include "Core/VazioStats.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
 #include "Enemy/EnemyTypes.h"
 #include "World/Common/Projectiles/RangedProjectile.h"
+#include "Core/GameplayTrace.h"
 
 ARangedEnemy::ARangedEnemy()
 {
@@ -12,7 +13,7 @@ ARangedEnemy::ARangedEnemy()
     AttackRange = 800.f;
     FireRate = 2.f;
     OptimalDistance = 600.f;
-    LastFireTime = 0.f;
+    bFireReady = true;
     bUseBaseChase = false; // we manage movement ourselves
     ProjectileClass = ARangedProjectile::StaticClass();
 }
@@ -20,20 +21,20 @@ ARangedEnemy::ARangedEnemy()
 void ARangedEnemy::BeginPlay()
 {
     Super::BeginPlay();
+    RegisterForDecisions(TEXT("RangedEnemy"));
     // Ensure we have some movement speed
-    if (UCharacterMovementComponent* Move = GetCharacterMovement())
+    if (GetBaseWalkSpeed() <= 1.f)
     {
-        if (Move->MaxWalkSpeed <= 1.f)
-        {
-            Move->MaxWalkSpeed = 300.f;
-        }
+        SetBaseWalkSpeed(300.f);
     }
 }
 
 void ARangedEnemy::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioTickRanged);
+
     Super::Tick(DeltaTime);
-    if (!CurrentModifiers.bImmovable)
+    if (!CurrentModifiers.bImmovable && !IsStatusFrozen())
     {
         // Ensure movement component is active
         if (UCharacterMovementComponent* Move = GetCharacterMovement())
@@ -44,52 +45,96 @@ void ARangedEnemy::Tick(float DeltaTime)
                 Move->SetMovementMode(MOVE_Walking);
             }
         }
+        if (!IsDecisionScheduled())
+        {
+            MakeDecision();
+        }
         HandleRangedCombat(DeltaTime);
     }
 }
 
-void ARangedEnemy::HandleRangedCombat(float DeltaTime)
+void ARangedEnemy::MakeDecision()
 {
     APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
     if (!PlayerPawn)
     {
+        DesiredMoveScale = 0.f;
         return;
     }
 
-    const FVector MyLoc = GetActorLocation();
-    const FVector PlayerLoc = PlayerPawn->GetActorLocation();
-    FVector ToPlayer = PlayerLoc - MyLoc;
+    FVector ToPlayer = PlayerPawn->GetActorLocation() - GetActorLocation();
     ToPlayer.Z = 0.f;
-    float DistanceToPlayer = ToPlayer.Size();
-    FVector Direction = ToPlayer.GetSafeNormal();
-
-    // Always face the player snapshot
-    if (!Direction.IsNearlyZero())
-    {
-        SetActorRotation(FRotationMatrix::MakeFromX(Direction).Rotator());
-    }
+    const float DistanceToPlayer = ToPlayer.Size();
 
     // Movement logic to keep distance
-    const float ApproachThresh = OptimalDistance * 0.9f; // move closer if beyond this
     const float RetreatThresh = OptimalDistance * 0.7f;  // retreat if closer than this
     const float FarThresh = OptimalDistance * 1.3f;      // slightly far
 
     if (DistanceToPlayer > AttackRange)
     {
         // Too far to attack: close in quickly
-        AddMovementInput(Direction, 1.0f, true);
+        DesiredMoveScale = 1.0f;
     }
     else if (DistanceToPlayer < RetreatThresh)
     {
         // Too close: back away faster
-        AddMovementInput(-Direction, 0.8f, true);
+        DesiredMoveScale = -0.8f;
     }
     else if (DistanceToPlayer > FarThresh)
     {
         // Slightly far: close in slowly
-        AddMovementInput(Direction, 0.4f, true);
+        DesiredMoveScale = 0.4f;
+    }
+    else
+    {
+        // Hold position in the pocket
+        DesiredMoveScale = 0.f;
+    }
+
+    VAZIO_TRACE(AI, "RANGED-DECIDE", "Dist Move", this, DistanceToPlayer, DesiredMoveScale);
+
+    // Fire logic: shoot straight toward player's position at fire time
+    if (bFireReady && DistanceToPlayer <= AttackRange)
+    {
+        FireProjectile();
+        bFireReady = false;
+        if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
+        {
+            Cooldowns->Schedule(FireTimerHandle, 1.f / FMath::Max(FireRate, KINDA_SMALL_NUMBER),
+                FSimpleDelegate::CreateUObject(this, &ARangedEnemy::OnFireCooldownComplete));
+        }
+        else
+        {
+            bFireReady = true;
+        }
+    }
+}
+
+void ARangedEnemy::HandleRangedCombat(float DeltaTime)
+{
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    if (!PlayerPawn)
+    {
+        return;
+    }
+
+    const FVector MyLoc = GetActorLocation();
+    const FVector PlayerLoc = PlayerPawn->GetActorLocation();
+    FVector ToPlayer = PlayerLoc - MyLoc;
+    ToPlayer.Z = 0.f;
+    FVector Direction = ToPlayer.GetSafeNormal();
+
+    // Always face the player snapshot
+    if (!Direction.IsNearlyZero())
+    {
+        SetActorRotation(FRotationMatrix::MakeFromX(Direction).Rotator());
+    }
+
+    // Distância decidida em MakeDecision; aqui só aplica o movimento cacheado
+    if (DesiredMoveScale != 0.f)
+    {
+        AddMovementInput(DesiredMoveScale > 0.f ? Direction : -Direction, FMath::Abs(DesiredMoveScale), true);
     }
-    // else: hold position in the pocket
 
     // Fallback nudge if stuck
     if (UCharacterMovementComponent* Move = GetCharacterMovement())
@@ -100,25 +145,23 @@ void ARangedEnemy::HandleRangedCombat(float DeltaTime)
             AddActorWorldOffset(Nudge, true);
         }
     }
+}
 
-    // Fire logic: shoot straight toward player's position at fire time
-    if (DistanceToPlayer <= AttackRange)
-    {
-        const float CurrentTime = GetWorld()->GetTimeSeconds();
-        if (CurrentTime - LastFireTime >= (1.f / FireRate))
-        {
-            FireProjectile();
-            LastFireTime = CurrentTime;
-        }
-    }
+void ARangedEnemy::OnFireCooldownComplete()
+{
+    bFireReady = true;
+}
+
+void ARangedEnemy::ResetCooldowns()
+{
+    Super::ResetCooldowns();
 
-    // Throttled debug log
-    static float LastDbgTime = 0.f; const float Now = GetWorld()->GetTimeSeconds();
-    if (Now - LastDbgTime > 1.0f)
+    if (UEnemyCooldownSubsystem* Cooldowns = GetCooldowns())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[RANGED] %s Dist=%.1f InRange=%s"), *GetName(), DistanceToPlayer, DistanceToPlayer<=AttackRange?TEXT("Y"):TEXT("N"));
-        LastDbgTime = Now;
+        Cooldowns->Cancel(FireTimerHandle);
     }
+    bFireReady = true;
+    DesiredMoveScale = 0.f;
 }
 
 void ARangedEnemy::FireProjectile()
@@ -155,7 +198,7 @@ void ARangedEnemy::FireProjectile()
                 RP->InitShoot(Dir, 1100.f);
                 RP->Damage = CurrentArchetype.BaseDMG > 0.f ? CurrentArchetype.BaseDMG : 15.f;
             }
-            UE_LOG(LogTemp, Warning, TEXT("[RANGED] %s fired projectile"), *GetName());
+            VAZIO_TRACE(Combat, "RANGED-FIRE", "DirX DirY", this, Dir.X, Dir.Y);
         }
     }
 }
@@ -1,4 +1,5 @@
 #include "Enemy/Types/SplitterSlime.h"
+#include "Core/VazioStats.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
@@ -19,18 +20,31 @@ ASplitterSlime::ASplitterSlime()
 void ASplitterSlime::BeginPlay()
 {
     Super::BeginPlay();
+    RegisterForDecisions(TEXT("SplitterSlime"));
 }
 
 void ASplitterSlime::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_VazioTickSplitter);
+
     Super::Tick(DeltaTime);
     
-    if (!CurrentModifiers.bImmovable)
+    if (!CurrentModifiers.bImmovable && !IsStatusFrozen())
     {
+        if (!IsDecisionScheduled())
+        {
+            MakeDecision();
+        }
         PursuePlayer(DeltaTime);
     }
 }
 
+void ASplitterSlime::MakeDecision()
+{
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    bWantsPursue = PlayerPawn && FVector::Dist(PlayerPawn->GetActorLocation(), GetActorLocation()) > StoppingDistance;
+}
+
 void ASplitterSlime::HandleDeath(bool bIsParentParam)
 {
     // If this is a parent slime, create children before dying
@@ -51,21 +65,30 @@ void ASplitterSlime::PursuePlayer(float DeltaTime)
         return;
     }
 
-    FVector ToPlayer = PlayerPawn->GetActorLocation() - GetActorLocation();
-    float DistanceToPlayer = ToPlayer.Size();
-
-    if (DistanceToPlayer > StoppingDistance)
+    // Decisão de perseguir vem de MakeDecision (fatiada); direção é atualizada todo frame
+    if (bWantsPursue)
     {
-        FVector Direction = ToPlayer.GetSafeNormal();
+        FVector Direction = (PlayerPawn->GetActorLocation() - GetActorLocation()).GetSafeNormal();
         
         // Move towards player
-        AddMovementInput(Direction, 1.0f);
+        AddMovementInput(GetSimSteerDirection(Direction), 1.0f);
         
         // Face the player
         SetActorRotation(FRotationMatrix::MakeFromX(Direction).Rotator());
     }
 }
 
+FEnemyArchetype ASplitterSlime::MakeChildArchetype(const FEnemyArchetype& ParentArchetype) const
+{
+    FEnemyArchetype ChildArchetype = ParentArchetype;
+    ChildArchetype.BaseHP *= ChildrenHPMultiplier;
+    ChildArchetype.BaseDMG *= ChildrenDMGMultiplier;
+
+    // Children don't split further and should have normal drop behavior
+    ChildArchetype.Death = EOnDeathBehavior::Normal;
+    return ChildArchetype;
+}
+
 void ASplitterSlime::CreateChildren()
 {
     UEnemySpawnerSubsystem* SpawnerSubsystem = GetWorld()->GetSubsystem<UEnemySpawnerSubsystem>();
@@ -77,14 +100,11 @@ void ASplitterSlime::CreateChildren()
 
     FVector ParentLocation = GetActorLocation();
     
-    // Create modified archetype for children
-    FEnemyArchetype ChildArchetype = CurrentArchetype;
-    ChildArchetype.BaseHP *= ChildrenHPMultiplier;
-    ChildArchetype.BaseDMG *= ChildrenDMGMultiplier;
-    
-    // Children don't split further and should have normal drop behavior
-    ChildArchetype.Death = EOnDeathBehavior::Normal;
+    const FEnemyArchetype ChildArchetype = MakeChildArchetype(CurrentArchetype);
     
+    // Spawns are deferred to the post-tick phase (through the pool, under the
+    // spawner's per-frame budget) instead of running inside the damage call stack
+    int32 NumQueued = 0;
     for (int32 i = 0; i < ChildrenCount; i++)
     {
         // Calculate spawn position around parent
@@ -92,23 +112,21 @@ void ASplitterSlime::CreateChildren()
         FVector Offset = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * ChildrenSpawnRadius;
         FVector ChildLocation = ParentLocation + Offset;
         
-        // Spawn child slime
-        FTransform ChildTransform;
-        ChildTransform.SetLocation(ChildLocation);
-        ChildTransform.SetRotation(GetActorQuat());
-        ChildTransform.SetScale3D(GetActorScale3D() * 0.8f); // Slightly smaller children
-        
-        FEnemyInstanceModifiers ChildMods = CurrentModifiers;
-        // Children inherit modifiers but are not parents
-        
-        if (ASplitterSlime* Child = Cast<ASplitterSlime>(SpawnerSubsystem->SpawnOne(TEXT("SplitterSlime"), ChildTransform, ChildMods)))
+        FDeferredSpawnRequest Request;
+        Request.Type = TEXT("SplitterSlime");
+        Request.Transform.SetLocation(ChildLocation);
+        Request.Transform.SetRotation(GetActorQuat());
+        Request.Transform.SetScale3D(GetActorScale3D() * 0.8f); // Slightly smaller children
+        Request.Mods = CurrentModifiers; // Children inherit modifiers but are not parents
+        Request.Archetype = ChildArchetype;
+        Request.bSplitChild = true;
+
+        if (!SpawnerSubsystem->EnqueueDeferredSpawn(Request))
         {
-            Child->bIsParent = false; // Children don't split
-            Child->ApplyArchetypeAndModifiers(ChildArchetype, ChildMods);
-            
-            UE_LOG(LogEnemy, Log, TEXT("SplitterSlime parent created child %d at %s"), i, *ChildLocation.ToCompactString());
+            break; // global split child cap reached
         }
+        ++NumQueued;
     }
     
-    UE_LOG(LogEnemy, Log, TEXT("SplitterSlime parent created %d children"), ChildrenCount);
+    UE_LOG(LogEnemy, Log, TEXT("SplitterSlime parent queued %d/%d children"), NumQueued, ChildrenCount);
 }
@@ -42,6 +42,10 @@ AVoidQueenBoss::AVoidQueenBoss()
     VoidNova.PatternName = TEXT("VoidNova");
     VoidNova.TelegraphTime = 2.0f;
     VoidNova.Cooldown = 9.f;
+    VoidNova.bSummonsMinions = true;
+    VoidNova.MinionType = TEXT("AuraEnemy");
+    VoidNova.MinionCount = 3;
+    VoidNova.MinionSpawnRadius = SlamRadius + 200.f;
 
     FBossPhaseDefinition PhaseOne;
     PhaseOne.HealthThreshold = 1.0f;
@@ -59,6 +63,11 @@ AVoidQueenBoss::AVoidQueenBoss()
     PhaseTwo.SummonRadius = 900.f;
 
     Phases = { PhaseOne, PhaseTwo };
+
+    RegisterAttackHandler(TEXT("TentacleSlam"), &AVoidQueenBoss::PerformTentacleSlam);
+    RegisterAttackHandler(TEXT("VoidDash"), &AVoidQueenBoss::PerformVoidDash);
+    RegisterAttackHandler(TEXT("BroodCall"), &AVoidQueenBoss::PerformBroodSummon);
+    RegisterAttackHandler(TEXT("VoidNova"), &AVoidQueenBoss::PerformVoidNova);
 }
 
 void AVoidQueenBoss::HandlePhaseStarted(const FBossPhaseDefinition& Phase)
@@ -67,35 +76,7 @@ void AVoidQueenBoss::HandlePhaseStarted(const FBossPhaseDefinition& Phase)
 
     MovementRadius = Phase.HealthThreshold > 0.6f ? 900.f : 650.f;
 
-    if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-    {
-        MoveComp->MaxWalkSpeed = CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier;
-    }
-}
-
-void AVoidQueenBoss::PerformAttackPattern(const FBossAttackPattern& Pattern)
-{
-    if (Pattern.PatternName == TEXT("TentacleSlam"))
-    {
-        PerformTentacleSlam();
-    }
-    else if (Pattern.PatternName == TEXT("VoidDash"))
-    {
-        PerformVoidDash();
-    }
-    else if (Pattern.PatternName == TEXT("BroodCall"))
-    {
-        PerformBroodSummon();
-    }
-    else if (Pattern.PatternName == TEXT("VoidNova"))
-    {
-        UGameplayStatics::ApplyRadialDamage(GetWorld(), SlamDamage * 1.5f, GetActorLocation(), SlamRadius * 1.25f, nullptr, TArray<AActor*>(), this);
-        SpawnSummonedMinions(TEXT("AuraEnemy"), 3, SlamRadius + 200.f, FEnemyInstanceModifiers());
-    }
-    else
-    {
-        Super::PerformAttackPattern(Pattern);
-    }
+    SetBaseWalkSpeed(CurrentArchetype.BaseSpeed * Phase.MovementSpeedMultiplier);
 }
 
 void AVoidQueenBoss::PerformMovementPattern(float DeltaTime)
@@ -116,6 +97,12 @@ void AVoidQueenBoss::PerformVoidDash()
     UE_LOG(LogBoss, Log, TEXT("%s performed Void Dash"), *GetName());
 }
 
+void AVoidQueenBoss::PerformVoidNova()
+{
+    UGameplayStatics::ApplyRadialDamage(GetWorld(), SlamDamage * 1.5f, GetActorLocation(), SlamRadius * 1.25f, nullptr, TArray<AActor*>(), this);
+    UE_LOG(LogBoss, Log, TEXT("%s unleashed Void Nova"), *GetName());
+}
+
 void AVoidQueenBoss::PerformBroodSummon()
 {
     UE_LOG(LogBoss, Log, TEXT("%s calls forth brood minions"), *GetName());
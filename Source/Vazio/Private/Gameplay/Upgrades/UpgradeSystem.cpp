@@ -9,6 +9,7 @@ void UUpgradeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     InitializeUpgrades();
+    PrepareOffer();
     UE_LOG(LogTemp, Log, TEXT("[UpgradeSubsystem] Initialized"));
 }
 
@@ -16,6 +17,8 @@ void UUpgradeSubsystem::Deinitialize()
 {
     UpgradeLevels.Empty();
     AvailableUpgrades.Empty();
+    PreparedOffer.Empty();
+    bOfferPrepared = false;
     Super::Deinitialize();
 }
 
@@ -133,40 +136,63 @@ void UUpgradeSubsystem::InitializeUpgrades()
 TArray<FUpgradeData> UUpgradeSubsystem::GenerateRandomUpgrades(int32 Count)
 {
     TArray<FUpgradeData> Result;
-    TArray<FUpgradeData> EligibleUpgrades;
+    GenerateRandomUpgradesInto(Count, Result);
+    return Result;
+}
+
+void UUpgradeSubsystem::GenerateRandomUpgradesInto(int32 Count, TArray<FUpgradeData>& OutUpgrades)
+{
+    OutUpgrades.Reset();
+    EligibleScratch.Reset();
 
     // Filter out maxed upgrades
-    for (const FUpgradeData& Upgrade : AvailableUpgrades)
+    for (int32 Index = 0; Index < AvailableUpgrades.Num(); ++Index)
     {
-        if (!IsUpgradeMaxed(Upgrade.Type))
+        if (!IsUpgradeMaxed(AvailableUpgrades[Index].Type))
         {
-            EligibleUpgrades.Add(Upgrade);
+            EligibleScratch.Add(Index);
         }
     }
 
-    if (EligibleUpgrades.Num() == 0)
+    if (EligibleScratch.Num() == 0)
     {
         UE_LOG(LogTemp, Warning, TEXT("[UpgradeSubsystem] No eligible upgrades available!"));
-        return Result;
+        return;
     }
 
     // Randomly select upgrades
-    Count = FMath::Min(Count, EligibleUpgrades.Num());
-    
+    Count = FMath::Min(Count, EligibleScratch.Num());
+
     for (int32 i = 0; i < Count; ++i)
     {
-        int32 RandomIndex = FMath::RandRange(0, EligibleUpgrades.Num() - 1);
-        FUpgradeData SelectedUpgrade = EligibleUpgrades[RandomIndex];
-        
+        const int32 RandomIndex = FMath::RandRange(0, EligibleScratch.Num() - 1);
+        FUpgradeData& SelectedUpgrade = OutUpgrades.Add_GetRef(AvailableUpgrades[EligibleScratch[RandomIndex]]);
+
         // Update current level for display
         SelectedUpgrade.CurrentLevel = GetUpgradeLevel(SelectedUpgrade.Type);
-        
-        Result.Add(SelectedUpgrade);
-        EligibleUpgrades.RemoveAt(RandomIndex); // Avoid duplicates
+
+        EligibleScratch.RemoveAtSwap(RandomIndex, 1, EAllowShrinking::No); // Avoid duplicates
     }
 
-    UE_LOG(LogTemp, Display, TEXT("[UpgradeSubsystem] Generated %d random upgrades"), Result.Num());
-    return Result;
+    UE_LOG(LogTemp, Verbose, TEXT("[UpgradeSubsystem] Generated %d random upgrades"), OutUpgrades.Num());
+}
+
+void UUpgradeSubsystem::PrepareOffer()
+{
+    GenerateRandomUpgradesInto(OfferSize, PreparedOffer);
+    bOfferPrepared = true;
+}
+
+void UUpgradeSubsystem::TakePreparedOffer(TArray<FUpgradeData>& OutUpgrades)
+{
+    // Sem oferta pronta (level-up antes de qualquer ApplyUpgrade após um reset): gera na hora
+    if (!bOfferPrepared)
+    {
+        PrepareOffer();
+    }
+
+    Swap(OutUpgrades, PreparedOffer);
+    bOfferPrepared = false;
 }
 
 void UUpgradeSubsystem::ApplyUpgrade(EUpgradeType Type, AMyCharacter* Player)
@@ -212,6 +238,9 @@ void UUpgradeSubsystem::ApplyUpgrade(EUpgradeType Type, AMyCharacter* Player)
             UE_LOG(LogTemp, Warning, TEXT("[UpgradeSubsystem] Unknown upgrade type: %d"), (int32)Type);
             break;
     }
+
+    // Níveis mudaram: a próxima oferta sai agora, enquanto o jogo ainda está pausado na escolha
+    PrepareOffer();
 }
 
 void UUpgradeSubsystem::ApplyWeaponUpgrade(EUpgradeType Type, AMyCharacter* Player)
@@ -344,6 +373,7 @@ bool UUpgradeSubsystem::IsUpgradeMaxed(EUpgradeType Type) const
 void UUpgradeSubsystem::ResetAllUpgrades()
 {
     UpgradeLevels.Empty();
+    PrepareOffer();
     UE_LOG(LogTemp, Display, TEXT("[UpgradeSubsystem] All upgrades reset"));
 }
 
@@ -6,9 +6,34 @@
 #include "Input/Events.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/InputSettings.h"
+#include "Testing/HordeBenchmarkSubsystem.h"
+#include "Core/VazioStats.h"
+#include "Enemy/EnemyPoolSubsystem.h"
+#include "World/Common/Player/MyCharacter.h"
+#include "World/Common/Player/PlayerHealthComponent.h"
+#include "World/Common/Projectiles/RangedProjectile.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogBossAutoTest, Log, All);
 
+// Benchmark de boss: duração mínima da janela de "Attack" após a execução de um padrão
+static constexpr float BossBenchMinAttackWindow = 0.25f;
+// Pausa entre um boss e o próximo (minions restantes são recolhidos)
+static constexpr float BossBenchGapSeconds = 3.f;
+
+static const FName BossStageTelegraph(TEXT("Telegraph"));
+static const FName BossStageAttack(TEXT("Attack"));
+static const FName BossStageSummon(TEXT("SummonLoop"));
+static const FName BossStageIdle(TEXT("Idle"));
+
 void UBossAutoTestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
@@ -60,8 +85,35 @@ void UBossAutoTestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     }
 }
 
+void UBossAutoTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (!IsBossBenchmarkCommandLine() || !InWorld.GetMapName().Contains(TEXT("Battle_Main")))
+    {
+        return;
+    }
+
+    float PhaseSeconds = 20.f;
+    FString RunName;
+    FParse::Value(FCommandLine::Get(), TEXT("BossPhaseSeconds="), PhaseSeconds);
+    FParse::Value(FCommandLine::Get(), TEXT("BenchName="), RunName);
+    bBenchExitWhenDone = true;
+
+    FTimerHandle StartHandle;
+    InWorld.GetTimerManager().SetTimer(StartHandle, FTimerDelegate::CreateWeakLambda(this, [this, PhaseSeconds, RunName]()
+    {
+        StartBossBenchmark(PhaseSeconds, RunName);
+    }), 1.0f, false);
+}
+
 void UBossAutoTestSubsystem::Deinitialize()
 {
+    if (bBenchRunning)
+    {
+        StopBossBenchmark();
+    }
+
     if (UWorld* World = GetWorld())
     {
         if (AutoTestTimer.IsValid())
@@ -234,4 +286,397 @@ void UBossAutoTestSubsystem::LogBossTest(const FString& Message)
         GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Cyan, 
             FString::Printf(TEXT("Boss Test: %s"), *Message));
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// BOSS BENCHMARK
+// ============================================================================
+
+bool UBossAutoTestSubsystem::IsBossBenchmarkCommandLine()
+{
+    return FParse::Param(FCommandLine::Get(), TEXT("BossBenchmark"));
+}
+
+void UBossAutoTestSubsystem::StartBossBenchmark(float PhaseSeconds, const FString& RunName)
+{
+    UWorld* World = GetWorld();
+    GetEnemySpawner();
+    if (!World || !EnemySpawner || bBenchRunning)
+    {
+        return;
+    }
+
+    if (EnemySpawner->IsBossEncounterActive())
+    {
+        UE_LOG(LogBossAutoTest, Warning, TEXT("Boss benchmark: encontro de boss já ativo, abortando"));
+        return;
+    }
+
+    BenchPhaseSeconds = FMath::Max(2.f, PhaseSeconds);
+    BenchName = RunName.IsEmpty() ? FString::Printf(TEXT("BossBench-%s"), *FDateTime::Now().ToString()) : RunName;
+    BenchQueue = { TEXT("BurrowerBoss"), TEXT("VoidQueenBoss"), TEXT("FallenWarlordBoss"), TEXT("HybridDemonBoss") };
+    BenchBossIndex = INDEX_NONE;
+    BenchBuckets.Reset();
+    BenchBucketIndex.Reset();
+    BenchAttackTimer = 0.f;
+    BenchLastFrame = FPlatformTime::Seconds();
+    bBenchRunning = true;
+
+    BenchPostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UBossAutoTestSubsystem::HandleBenchPostActorTick);
+    BenchSpawnHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UBossAutoTestSubsystem::HandleBenchActorSpawned));
+
+    UE_LOG(LogBossAutoTest, Log, TEXT("Boss benchmark '%s' iniciado: %d bosses, %.0fs por fase"), *BenchName, BenchQueue.Num(), BenchPhaseSeconds);
+    RunNextBenchBoss();
+}
+
+void UBossAutoTestSubsystem::StopBossBenchmark()
+{
+    if (!bBenchRunning)
+    {
+        return;
+    }
+
+    bBenchRunning = false;
+    FWorldDelegates::OnWorldPostActorTick.Remove(BenchPostTickHandle);
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(BenchSpawnHandle);
+        World->GetTimerManager().ClearTimer(BenchNextBossTimer);
+    }
+
+    if (ABossEnemy* Boss = BenchBoss.Get())
+    {
+        Boss->OnBossTelegraph.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchTelegraph);
+        Boss->OnBossAttackExecuted.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchAttack);
+        Boss->OnBossPhaseChanged.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchPhaseChanged);
+        Boss->OnBossDefeated.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchBossDefeated);
+    }
+    BenchBoss.Reset();
+
+    WriteBossBenchmarkReport();
+
+    if (bBenchExitWhenDone)
+    {
+        FPlatformMisc::RequestExit(false, TEXT("BossBenchmark"));
+    }
+}
+
+void UBossAutoTestSubsystem::RunNextBenchBoss()
+{
+    ++BenchBossIndex;
+    if (!BenchQueue.IsValidIndex(BenchBossIndex))
+    {
+        StopBossBenchmark();
+        return;
+    }
+
+    const FName BossType = BenchQueue[BenchBossIndex];
+    EnemySpawner->SpawnTestBoss(BossType);
+
+    ABossEnemy* Boss = EnemySpawner->GetActiveBoss();
+    if (!Boss)
+    {
+        UE_LOG(LogBossAutoTest, Error, TEXT("Boss benchmark: falha ao spawnar %s, pulando"), *BossType.ToString());
+        RunNextBenchBoss();
+        return;
+    }
+
+    BenchBoss = Boss;
+    Boss->OnBossTelegraph.AddDynamic(this, &UBossAutoTestSubsystem::HandleBenchTelegraph);
+    Boss->OnBossAttackExecuted.AddDynamic(this, &UBossAutoTestSubsystem::HandleBenchAttack);
+    Boss->OnBossPhaseChanged.AddDynamic(this, &UBossAutoTestSubsystem::HandleBenchPhaseChanged);
+    Boss->OnBossDefeated.AddDynamic(this, &UBossAutoTestSubsystem::HandleBenchBossDefeated);
+
+    BenchPhase = FMath::Max(0, Boss->GetCurrentPhaseIndex());
+    BenchBossStart = GetWorld()->GetTimeSeconds();
+    BenchPhaseStart = BenchBossStart;
+    EnterBenchStage(BossStageIdle, NAME_None);
+
+    UE_LOG(LogBossAutoTest, Log, TEXT("Boss benchmark: %s (%d fases)"), *BossType.ToString(), Boss->GetPhases().Num());
+}
+
+void UBossAutoTestSubsystem::FinishBenchBoss()
+{
+    if (ABossEnemy* Boss = BenchBoss.Get())
+    {
+        Boss->OnBossTelegraph.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchTelegraph);
+        Boss->OnBossAttackExecuted.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchAttack);
+        Boss->OnBossPhaseChanged.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchPhaseChanged);
+        Boss->OnBossDefeated.RemoveDynamic(this, &UBossAutoTestSubsystem::HandleBenchBossDefeated);
+    }
+    BenchBoss.Reset();
+
+    // Recolhe minions para o próximo boss começar do mesmo estado
+    UWorld* World = GetWorld();
+    UEnemyPoolSubsystem* Pool = World ? World->GetSubsystem<UEnemyPoolSubsystem>() : nullptr;
+    TArray<AEnemyBase*> Leftovers;
+    for (TActorIterator<AEnemyBase> It(World); It; ++It)
+    {
+        if (!It->IsHidden() && !It->IsA<ABossEnemy>())
+        {
+            Leftovers.Add(*It);
+        }
+    }
+    for (AEnemyBase* Enemy : Leftovers)
+    {
+        if (Pool && Pool->IsTracked(Enemy))
+        {
+            Pool->ReturnToPool(Enemy);
+        }
+        else
+        {
+            Enemy->Destroy();
+        }
+    }
+
+    if (World)
+    {
+        World->GetTimerManager().SetTimer(BenchNextBossTimer, FTimerDelegate::CreateUObject(this, &UBossAutoTestSubsystem::RunNextBenchBoss), BossBenchGapSeconds, false);
+    }
+}
+
+void UBossAutoTestSubsystem::AdvanceBenchBossPhase()
+{
+    ABossEnemy* Boss = BenchBoss.Get();
+    if (!Boss)
+    {
+        return;
+    }
+
+    // Dano exato para cruzar o limiar da próxima fase; na última, mata o boss
+    const TArray<FBossPhaseDefinition>& Phases = Boss->GetPhases();
+    const int32 NextPhase = Boss->GetCurrentPhaseIndex() + 1;
+    const float Fraction = Boss->GetHealthFraction();
+    float Damage = Boss->GetCurrentHP() + 1.f;
+    if (Phases.IsValidIndex(NextPhase) && Fraction > KINDA_SMALL_NUMBER)
+    {
+        const float TargetFraction = FMath::Max(0.f, Phases[NextPhase].HealthThreshold - 0.01f);
+        Damage = FMath::Max(1.f, Boss->GetCurrentHP() * (1.f - TargetFraction / Fraction));
+    }
+
+    BenchPhaseStart = GetWorld()->GetTimeSeconds();
+    Boss->TakeDamage(Damage, FDamageEvent(), nullptr, nullptr);
+}
+
+void UBossAutoTestSubsystem::EnterBenchStage(FName Stage, FName Pattern, float Duration)
+{
+    BenchStage = Stage;
+    BenchPattern = Pattern;
+    BenchStageEnd = GetWorld() ? GetWorld()->GetTimeSeconds() + Duration : 0.0;
+    ++GetBenchBucket(Stage).Occurrences;
+}
+
+UBossAutoTestSubsystem::FPatternBucket& UBossAutoTestSubsystem::GetBenchBucket(FName Stage)
+{
+    const FName Boss = BenchQueue.IsValidIndex(BenchBossIndex) ? BenchQueue[BenchBossIndex] : NAME_None;
+    const FName Pattern = (Stage == BossStageTelegraph || Stage == BossStageAttack) ? BenchPattern : NAME_None;
+    const FString Key = FString::Printf(TEXT("%s/%d/%s/%s"), *Boss.ToString(), BenchPhase, *Pattern.ToString(), *Stage.ToString());
+
+    if (const int32* Index = BenchBucketIndex.Find(Key))
+    {
+        return BenchBuckets[*Index];
+    }
+
+    FPatternBucket& Bucket = BenchBuckets.AddDefaulted_GetRef();
+    Bucket.Boss = Boss;
+    Bucket.Phase = BenchPhase;
+    Bucket.Pattern = Pattern;
+    Bucket.Stage = Stage;
+    BenchBucketIndex.Add(Key, BenchBuckets.Num() - 1);
+    return Bucket;
+}
+
+void UBossAutoTestSubsystem::HandleBenchTelegraph(const FBossAttackPattern& Pattern)
+{
+    BenchPattern = Pattern.PatternName;
+    EnterBenchStage(BossStageTelegraph, Pattern.PatternName, Pattern.TelegraphTime);
+}
+
+void UBossAutoTestSubsystem::HandleBenchAttack(const FBossAttackPattern& Pattern)
+{
+    BenchPattern = Pattern.PatternName;
+    EnterBenchStage(BossStageAttack, Pattern.PatternName, FMath::Max(BossBenchMinAttackWindow, Pattern.ExecutionTime));
+}
+
+void UBossAutoTestSubsystem::HandleBenchPhaseChanged(int32 PhaseIndex, const FBossPhaseDefinition& PhaseData)
+{
+    BenchPhase = PhaseIndex;
+    BenchPhaseStart = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+    EnterBenchStage(BossStageIdle, NAME_None);
+}
+
+void UBossAutoTestSubsystem::HandleBenchBossDefeated(ABossEnemy* Boss)
+{
+    if (Boss == BenchBoss.Get())
+    {
+        FinishBenchBoss();
+    }
+}
+
+void UBossAutoTestSubsystem::HandleBenchActorSpawned(AActor* Actor)
+{
+    if (!BenchBoss.IsValid() || !Actor)
+    {
+        return;
+    }
+
+    // Spawns fora de telegraph/ataque vêm do loop de invocação da fase
+    if (BenchStage == BossStageIdle && Actor->IsA<AEnemyBase>())
+    {
+        bBenchSummonThisFrame = true;
+    }
+
+    FPatternBucket& Bucket = GetBenchBucket(bBenchSummonThisFrame && BenchStage == BossStageIdle ? BossStageSummon : BenchStage);
+    if (Actor->IsA<AEnemyBase>())
+    {
+        ++Bucket.EnemiesSpawned;
+    }
+    else if (Actor->IsA<ARangedProjectile>())
+    {
+        ++Bucket.ProjectilesSpawned;
+    }
+    else
+    {
+        ++Bucket.OtherSpawned;
+    }
+}
+
+void UBossAutoTestSubsystem::HandleBenchPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetWorld() || !bBenchRunning)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    const float FrameMs = static_cast<float>((Now - BenchLastFrame) * 1000.0);
+    BenchLastFrame = Now;
+
+    ABossEnemy* Boss = BenchBoss.Get();
+    if (!Boss)
+    {
+        // Boss sumiu sem broadcast de OnBossDefeated: segue para o próximo
+        if (BenchQueue.IsValidIndex(BenchBossIndex) && !World->GetTimerManager().IsTimerActive(BenchNextBossTimer))
+        {
+            FinishBenchBoss();
+        }
+        bBenchSummonThisFrame = false;
+        return;
+    }
+
+    const double WorldTime = World->GetTimeSeconds();
+    if (BenchStage == BossStageAttack && WorldTime >= BenchStageEnd)
+    {
+        EnterBenchStage(BossStageIdle, NAME_None);
+    }
+
+    // O frame vai para o estágio em que o boss estava quando o custo aconteceu
+    FName FrameStage = BenchStage;
+    if (BenchStage == BossStageIdle && bBenchSummonThisFrame)
+    {
+        FrameStage = BossStageSummon;
+        ++GetBenchBucket(BossStageSummon).Occurrences;
+    }
+    GetBenchBucket(FrameStage).FrameMs.Add(FrameMs);
+    bBenchSummonThisFrame = false;
+
+    if (AMyCharacter* Character = Cast<AMyCharacter>(UGameplayStatics::GetPlayerPawn(World, 0)))
+    {
+        if (UPlayerHealthComponent* Health = Character->GetHealthComponent())
+        {
+            Health->SetInvulnerable(true);
+        }
+    }
+    UHordeBenchmarkSubsystem::DriveBot(World, WorldTime, DeltaSeconds, BenchAttackTimer);
+
+    // Não interrompe um telegraph/ataque em curso para não truncar a medição do padrão
+    if (BenchStage == BossStageIdle && WorldTime - BenchPhaseStart >= BenchPhaseSeconds)
+    {
+        AdvanceBenchBossPhase();
+    }
+}
+
+void UBossAutoTestSubsystem::WriteBossBenchmarkReport()
+{
+    FString CSV = TEXT("boss,phase,pattern,stage,occurrences,frames,avg_ms,p50_ms,p95_ms,p99_ms,max_ms,enemies_spawned,projectiles_spawned,other_spawned\n");
+    TArray<TSharedPtr<FJsonValue>> Rows;
+
+    for (const FPatternBucket& Bucket : BenchBuckets)
+    {
+        double Sum = 0.0;
+        float Max = 0.f;
+        for (float Ms : Bucket.FrameMs)
+        {
+            Sum += Ms;
+            Max = FMath::Max(Max, Ms);
+        }
+        const float Avg = Bucket.FrameMs.Num() > 0 ? static_cast<float>(Sum / Bucket.FrameMs.Num()) : 0.f;
+        const float P50 = GetVazioPercentile(Bucket.FrameMs, 0.50f);
+        const float P95 = GetVazioPercentile(Bucket.FrameMs, 0.95f);
+        const float P99 = GetVazioPercentile(Bucket.FrameMs, 0.99f);
+
+        CSV += FString::Printf(TEXT("%s,%d,%s,%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%d,%d\n"),
+            *Bucket.Boss.ToString(), Bucket.Phase, Bucket.Pattern.IsNone() ? TEXT("") : *Bucket.Pattern.ToString(), *Bucket.Stage.ToString(),
+            Bucket.Occurrences, Bucket.FrameMs.Num(), Avg, P50, P95, P99, Max,
+            Bucket.EnemiesSpawned, Bucket.ProjectilesSpawned, Bucket.OtherSpawned);
+
+        TSharedRef<FJsonObject> Row = MakeShared<FJsonObject>();
+        Row->SetStringField(TEXT("boss"), Bucket.Boss.ToString());
+        Row->SetNumberField(TEXT("phase"), Bucket.Phase);
+        Row->SetStringField(TEXT("pattern"), Bucket.Pattern.IsNone() ? FString() : Bucket.Pattern.ToString());
+        Row->SetStringField(TEXT("stage"), Bucket.Stage.ToString());
+        Row->SetNumberField(TEXT("occurrences"), Bucket.Occurrences);
+        Row->SetNumberField(TEXT("frames"), Bucket.FrameMs.Num());
+        Row->SetNumberField(TEXT("avg_ms"), Avg);
+        Row->SetNumberField(TEXT("p50_ms"), P50);
+        Row->SetNumberField(TEXT("p95_ms"), P95);
+        Row->SetNumberField(TEXT("p99_ms"), P99);
+        Row->SetNumberField(TEXT("max_ms"), Max);
+        Row->SetNumberField(TEXT("enemies_spawned"), Bucket.EnemiesSpawned);
+        Row->SetNumberField(TEXT("projectiles_spawned"), Bucket.ProjectilesSpawned);
+        Row->SetNumberField(TEXT("other_spawned"), Bucket.OtherSpawned);
+        Rows.Add(MakeShared<FJsonValueObject>(Row));
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("name"), BenchName);
+    Root->SetNumberField(TEXT("phase_seconds"), BenchPhaseSeconds);
+    Root->SetNumberField(TEXT("bosses_run"), FMath::Min(BenchBossIndex + 1, BenchQueue.Num()));
+    Root->SetArrayField(TEXT("buckets"), Rows);
+
+    FString JSON;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSON);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const FString Dir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"));
+    FFileHelper::SaveStringToFile(CSV, *FPaths::Combine(Dir, BenchName + TEXT(".csv")));
+    FFileHelper::SaveStringToFile(JSON, *FPaths::Combine(Dir, BenchName + TEXT(".json")));
+
+    UE_LOG(LogBossAutoTest, Log, TEXT("Boss benchmark '%s' concluído: %d buckets -> %s"), *BenchName, BenchBuckets.Num(), *Dir);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBossBenchmark(
+    TEXT("Vazio.Benchmark.Boss"),
+    TEXT("Vazio.Benchmark.Boss [PhaseSeconds=20] - roda cada boss por todas as fases e grava custo por padrão em Saved/Benchmarks"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UBossAutoTestSubsystem* BossTest = World ? World->GetSubsystem<UBossAutoTestSubsystem>() : nullptr)
+        {
+            BossTest->StartBossBenchmark(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 20.f);
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBossBenchmarkStop(
+    TEXT("Vazio.Benchmark.BossStop"),
+    TEXT("Vazio.Benchmark.BossStop - encerra o benchmark de boss e grava o que foi coletado"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UBossAutoTestSubsystem* BossTest = World ? World->GetSubsystem<UBossAutoTestSubsystem>() : nullptr)
+        {
+            BossTest->StopBossBenchmark();
+        }
+    }),
+    ECVF_Default
+);
@@ -0,0 +1,450 @@
+#include "Testing/HordeBenchmarkSubsystem.h"
+#include "Enemy/BossProjectileSubsystem.h"
+#include "Enemy/EnemyBase.h"
+#include "Enemy/EnemySpawnHelper.h"
+#include "Enemy/EnemySpawnerSubsystem.h"
+#include "Enemy/SpawnTimeline.h"
+#include "World/Common/Player/MyCharacter.h"
+#include "World/Common/Collectables/XPOrb.h"
+#include "World/Common/Projectiles/RangedProjectile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Core/VazioStats.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHordeBenchmark, Log, All);
+
+// Janela de agregação de cada linha do CSV
+static constexpr double BenchWindowSeconds = 0.25;
+
+// Bot: corre em círculo ao redor do ponto inicial e ataca em intervalo fixo
+static constexpr float BotOrbitRadius = 900.f;
+static constexpr float BotOrbitSpeed = 0.35f; // rad/s
+static constexpr float BotAttackInterval = 0.75f;
+
+static TSharedRef<FJsonObject> MakeDistributionJson(const TArray<float>& Values)
+{
+    TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+    double Sum = 0.0;
+    float Max = 0.f;
+    for (float V : Values)
+    {
+        Sum += V;
+        Max = FMath::Max(Max, V);
+    }
+    Obj->SetNumberField(TEXT("avg"), Values.Num() > 0 ? Sum / Values.Num() : 0.0);
+    Obj->SetNumberField(TEXT("p50"), GetVazioPercentile(Values, 0.50f));
+    Obj->SetNumberField(TEXT("p90"), GetVazioPercentile(Values, 0.90f));
+    Obj->SetNumberField(TEXT("p95"), GetVazioPercentile(Values, 0.95f));
+    Obj->SetNumberField(TEXT("p99"), GetVazioPercentile(Values, 0.99f));
+    Obj->SetNumberField(TEXT("max"), Max);
+    return Obj;
+}
+
+static float GetUsedMemoryMB()
+{
+    return static_cast<float>(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+}
+
+bool UHordeBenchmarkSubsystem::IsBenchmarkCommandLine()
+{
+    return FParse::Param(FCommandLine::Get(), TEXT("HordeBenchmark"));
+}
+
+bool UHordeBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UHordeBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (!IsBenchmarkCommandLine())
+    {
+        return;
+    }
+
+    float Seconds = 120.f;
+    int32 Seed = 1337;
+    FString TimelinePath;
+    FString RunName;
+    float StartAt = 0.f;
+    float Speed = 1.f;
+    FParse::Value(FCommandLine::Get(), TEXT("BenchSeconds="), Seconds);
+    FParse::Value(FCommandLine::Get(), TEXT("BenchSeed="), Seed);
+    FParse::Value(FCommandLine::Get(), TEXT("BenchTimeline="), TimelinePath);
+    FParse::Value(FCommandLine::Get(), TEXT("BenchName="), RunName);
+    FParse::Value(FCommandLine::Get(), TEXT("BenchStartAt="), StartAt);
+    FParse::Value(FCommandLine::Get(), TEXT("BenchSpeed="), Speed);
+
+    bExitWhenDone = true;
+
+    // Espera o GameMode configurar o spawner (BeginPlay dos atores roda depois deste callback)
+    FTimerHandle StartHandle;
+    InWorld.GetTimerManager().SetTimer(StartHandle, FTimerDelegate::CreateWeakLambda(this, [this, Seconds, Seed, TimelinePath, RunName, StartAt, Speed]()
+    {
+        StartBenchmark(Seconds, Seed, TimelinePath, RunName, StartAt, Speed);
+    }), 1.0f, false);
+}
+
+void UHordeBenchmarkSubsystem::Deinitialize()
+{
+    if (bRunning)
+    {
+        StopBenchmark();
+    }
+    Super::Deinitialize();
+}
+
+TStatId UHordeBenchmarkSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHordeBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void UHordeBenchmarkSubsystem::StartBenchmark(float DurationSeconds, int32 Seed, const FString& TimelinePath, const FString& RunName,
+                                              float StartAtSeconds, float Speed)
+{
+    UWorld* World = GetWorld();
+    if (!World || bRunning)
+    {
+        return;
+    }
+
+    Timeline = TimelinePath.IsEmpty()
+        ? UEnemySpawnHelper::CreateTimelineFromJSON(UEnemySpawnHelper::GetExampleJSON())
+        : UEnemySpawnHelper::LoadTimelineFile(TimelinePath);
+    TimelineName = TimelinePath.IsEmpty() ? TEXT("ExampleJSON") : FPaths::GetCleanFilename(TimelinePath);
+    if (!Timeline)
+    {
+        return;
+    }
+
+    Duration = FMath::Max(1.f, DurationSeconds);
+    BenchSeed = Seed != 0 ? Seed : 1337;
+    BenchStartAt = FMath::Max(0.f, StartAtSeconds);
+    BenchSpeed = Speed > 0.f ? Speed : 1.f;
+    Name = RunName.IsEmpty() ? FString::Printf(TEXT("HordeBench-%s"), *FDateTime::Now().ToString()) : RunName;
+
+    FrameMs.Reset();
+    GameThreadMs.Reset();
+    Windows.Reset();
+    StatColumns.Reset();
+    FrameMs.Reserve(FMath::CeilToInt(Duration * 120.f));
+    GameThreadMs.Reserve(FMath::CeilToInt(Duration * 120.f));
+
+    // Bot e spawns usam a mesma seed; o RNG global também, para drops/escolhas aleatórias
+    FMath::RandInit(BenchSeed);
+    FMath::SRandInit(BenchSeed);
+    UEnemySpawnHelper::StartSpawnTimeline(World, Timeline, BenchSeed, BenchStartAt);
+    if (UEnemySpawnerSubsystem* Spawner = World->GetSubsystem<UEnemySpawnerSubsystem>())
+    {
+        Spawner->SetPlaybackSpeed(BenchSpeed);
+    }
+
+    // Coleta o grupo Vazio sem desenhar nada na tela
+    if (GEngine)
+    {
+        GEngine->Exec(World, TEXT("stat Vazio -nodisplay"));
+    }
+
+    StartSeconds = FPlatformTime::Seconds();
+    LastFrameSeconds = StartSeconds;
+    WindowStart = 0.0;
+    WindowFrames = 0;
+    WindowFrameMsSum = 0.f;
+    WindowFrameMsMax = 0.f;
+    WindowGameMsSum = 0.f;
+    AttackTimer = 0.f;
+    bRunning = true;
+
+    UE_LOG(LogHordeBenchmark, Log, TEXT("Benchmark '%s' iniciado: %.0fs, seed %d, timeline %s a partir de %.0fs, %.2fx"),
+           *Name, Duration, BenchSeed, *TimelineName, BenchStartAt, BenchSpeed);
+}
+
+void UHordeBenchmarkSubsystem::StopBenchmark()
+{
+    if (!bRunning)
+    {
+        return;
+    }
+
+    bRunning = false;
+    if (BenchSpeed != 1.f)
+    {
+        if (UEnemySpawnerSubsystem* Spawner = GetWorld() ? GetWorld()->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr)
+        {
+            Spawner->SetPlaybackSpeed(1.f);
+        }
+    }
+    if (WindowFrames > 0)
+    {
+        CloseWindow();
+    }
+    WriteResults();
+
+    if (bExitWhenDone)
+    {
+        FPlatformMisc::RequestExit(false, TEXT("HordeBenchmark"));
+    }
+}
+
+void UHordeBenchmarkSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!bRunning)
+    {
+        return;
+    }
+
+    // Tempo real de parede, não o DeltaTime (que é fixo com -benchmark)
+    const double Now = FPlatformTime::Seconds();
+    const float FrameTimeMs = static_cast<float>((Now - LastFrameSeconds) * 1000.0);
+    LastFrameSeconds = Now;
+    const float GameMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+
+    FrameMs.Add(FrameTimeMs);
+    GameThreadMs.Add(GameMs);
+    ++WindowFrames;
+    WindowFrameMsSum += FrameTimeMs;
+    WindowFrameMsMax = FMath::Max(WindowFrameMsMax, FrameTimeMs);
+    WindowGameMsSum += GameMs;
+
+    // Alvo determinístico em função do tempo de jogo (não do tempo real)
+    DriveBot(GetWorld(), GetWorld()->GetTimeSeconds(), DeltaTime, AttackTimer);
+
+    const double Elapsed = Now - StartSeconds;
+    if (Elapsed - WindowStart >= BenchWindowSeconds)
+    {
+        CloseWindow();
+        WindowStart = Elapsed;
+    }
+
+    if (Elapsed >= Duration)
+    {
+        StopBenchmark();
+    }
+}
+
+void UHordeBenchmarkSubsystem::DriveBot(UWorld* World, float SimTime, float DeltaTime, float& InOutAttackTimer)
+{
+    APawn* Pawn = UGameplayStatics::GetPlayerPawn(World, 0);
+    if (!Pawn)
+    {
+        return;
+    }
+
+    AMyCharacter* Character = Cast<AMyCharacter>(Pawn);
+    if (Character && Character->IsLevelUpModalOpen())
+    {
+        const TArray<FUpgradeData>& Choices = Character->GetPendingUpgradeChoices();
+        if (Choices.Num() > 0)
+        {
+            Character->OnUpgradeChosen(Choices[0].Type);
+        }
+        else
+        {
+            Character->CloseLevelUpModal();
+        }
+    }
+
+    const float Angle = SimTime * BotOrbitSpeed;
+    const FVector Target(FMath::Cos(Angle) * BotOrbitRadius, FMath::Sin(Angle) * BotOrbitRadius, Pawn->GetActorLocation().Z);
+    const FVector Direction = (Target - Pawn->GetActorLocation()).GetSafeNormal2D();
+    if (!Direction.IsNearlyZero())
+    {
+        Pawn->AddMovementInput(Direction, 1.f);
+    }
+
+    InOutAttackTimer += DeltaTime;
+    if (InOutAttackTimer >= BotAttackInterval)
+    {
+        InOutAttackTimer -= BotAttackInterval;
+        if (Character)
+        {
+            Character->PerformAttack();
+        }
+    }
+}
+
+void UHordeBenchmarkSubsystem::CloseWindow()
+{
+    FWindowSample& Sample = Windows.AddDefaulted_GetRef();
+    Sample.Time = FPlatformTime::Seconds() - StartSeconds;
+    Sample.AvgFrameMs = WindowFrames > 0 ? WindowFrameMsSum / WindowFrames : 0.f;
+    Sample.MaxFrameMs = WindowFrameMsMax;
+    Sample.AvgGameThreadMs = WindowFrames > 0 ? WindowGameMsSum / WindowFrames : 0.f;
+    Sample.UsedMemoryMB = GetUsedMemoryMB();
+
+    UWorld* World = GetWorld();
+    for (TActorIterator<AEnemyBase> It(World); It; ++It)
+    {
+        if (!It->IsHidden())
+        {
+            ++Sample.Enemies;
+        }
+    }
+    for (TActorIterator<AXPOrb> It(World); It; ++It)
+    {
+        ++Sample.XPOrbs;
+    }
+    for (TActorIterator<ARangedProjectile> It(World); It; ++It)
+    {
+        ++Sample.Projectiles;
+    }
+    if (const UBossProjectileSubsystem* Bullets = World->GetSubsystem<UBossProjectileSubsystem>())
+    {
+        Sample.Projectiles += Bullets->GetNumLive();
+    }
+
+    SampleStats(Sample.StatMs);
+
+    WindowFrames = 0;
+    WindowFrameMsSum = 0.f;
+    WindowFrameMsMax = 0.f;
+    WindowGameMsSum = 0.f;
+}
+
+void UHordeBenchmarkSubsystem::SampleStats(TArray<float>& OutStatMs)
+{
+    TArray<FVazioStatTime> Times;
+    GetVazioStatTimes(Times);
+
+    for (const FVazioStatTime& Time : Times)
+    {
+        const FString StatName = Time.Name.ToString();
+        int32 Column = StatColumns.IndexOfByKey(StatName);
+        if (Column == INDEX_NONE)
+        {
+            Column = StatColumns.Add(StatName);
+        }
+        OutStatMs.SetNumZeroed(StatColumns.Num());
+        OutStatMs[Column] = Time.Milliseconds;
+    }
+}
+
+void UHordeBenchmarkSubsystem::WriteResults()
+{
+    const FString Dir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"));
+
+    // CSV: uma linha por janela
+    FString CSV = TEXT("time_s,avg_frame_ms,max_frame_ms,avg_game_thread_ms,enemies,xp_orbs,projectiles,used_mb");
+    for (const FString& Column : StatColumns)
+    {
+        CSV += TEXT(",") + Column;
+    }
+    CSV += TEXT("\n");
+
+    int32 PeakEnemies = 0, PeakOrbs = 0, PeakProjectiles = 0;
+    float PeakMemory = 0.f;
+    TArray<double> StatSums;
+    StatSums.SetNumZeroed(StatColumns.Num());
+
+    for (const FWindowSample& Sample : Windows)
+    {
+        CSV += FString::Printf(TEXT("%.3f,%.3f,%.3f,%.3f,%d,%d,%d,%.1f"), Sample.Time, Sample.AvgFrameMs, Sample.MaxFrameMs,
+                               Sample.AvgGameThreadMs, Sample.Enemies, Sample.XPOrbs, Sample.Projectiles, Sample.UsedMemoryMB);
+        for (int32 i = 0; i < StatColumns.Num(); ++i)
+        {
+            const float Value = Sample.StatMs.IsValidIndex(i) ? Sample.StatMs[i] : 0.f;
+            CSV += FString::Printf(TEXT(",%.4f"), Value);
+            StatSums[i] += Value;
+        }
+        CSV += TEXT("\n");
+
+        PeakEnemies = FMath::Max(PeakEnemies, Sample.Enemies);
+        PeakOrbs = FMath::Max(PeakOrbs, Sample.XPOrbs);
+        PeakProjectiles = FMath::Max(PeakProjectiles, Sample.Projectiles);
+        PeakMemory = FMath::Max(PeakMemory, Sample.UsedMemoryMB);
+    }
+
+    // JSON: resumo para comparar builds
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("name"), Name);
+    Root->SetStringField(TEXT("map"), GetWorld() ? GetWorld()->GetMapName() : FString());
+    Root->SetStringField(TEXT("timeline"), TimelineName);
+    Root->SetNumberField(TEXT("seed"), BenchSeed);
+    Root->SetNumberField(TEXT("start_at_s"), BenchStartAt);
+    Root->SetNumberField(TEXT("speed"), BenchSpeed);
+    Root->SetNumberField(TEXT("duration_s"), Duration);
+    Root->SetNumberField(TEXT("frames"), FrameMs.Num());
+    Root->SetStringField(TEXT("build_version"), FApp::GetBuildVersion());
+    Root->SetStringField(TEXT("build_config"), LexToString(FApp::GetBuildConfiguration()));
+    Root->SetBoolField(TEXT("fixed_timestep"), FApp::UseFixedTimeStep());
+    Root->SetObjectField(TEXT("frame_ms"), MakeDistributionJson(FrameMs));
+    Root->SetObjectField(TEXT("game_thread_ms"), MakeDistributionJson(GameThreadMs));
+
+    TSharedRef<FJsonObject> Peaks = MakeShared<FJsonObject>();
+    Peaks->SetNumberField(TEXT("enemies"), PeakEnemies);
+    Peaks->SetNumberField(TEXT("xp_orbs"), PeakOrbs);
+    Peaks->SetNumberField(TEXT("projectiles"), PeakProjectiles);
+    Peaks->SetNumberField(TEXT("used_mb"), PeakMemory);
+    Root->SetObjectField(TEXT("peaks"), Peaks);
+
+    if (Windows.Num() > 0)
+    {
+        Root->SetNumberField(TEXT("start_used_mb"), Windows[0].UsedMemoryMB);
+        Root->SetNumberField(TEXT("end_used_mb"), Windows.Last().UsedMemoryMB);
+    }
+
+    TSharedRef<FJsonObject> Stats = MakeShared<FJsonObject>();
+    for (int32 i = 0; i < StatColumns.Num(); ++i)
+    {
+        Stats->SetNumberField(StatColumns[i], Windows.Num() > 0 ? StatSums[i] / Windows.Num() : 0.0);
+    }
+    Root->SetObjectField(TEXT("stat_avg_ms"), Stats);
+
+    FString JSON;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSON);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const FString CSVPath = FPaths::Combine(Dir, Name + TEXT(".csv"));
+    const FString JSONPath = FPaths::Combine(Dir, Name + TEXT(".json"));
+    const bool bSaved = FFileHelper::SaveStringToFile(CSV, *CSVPath) && FFileHelper::SaveStringToFile(JSON, *JSONPath);
+
+    UE_LOG(LogHordeBenchmark, Log, TEXT("Benchmark '%s' %s: %d frames, p50 %.2fms, p99 %.2fms, pico %d inimigos -> %s"),
+           *Name, bSaved ? TEXT("concluído") : TEXT("FALHOU ao gravar"), FrameMs.Num(),
+           GetVazioPercentile(FrameMs, 0.5f), GetVazioPercentile(FrameMs, 0.99f), PeakEnemies, *JSONPath);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBenchmarkStart(
+    TEXT("Vazio.Benchmark.Start"),
+    TEXT("Vazio.Benchmark.Start [Segundos=120] [Seed=1337] [Timeline relativa a Content/] [StartAt=0] [Speed=1] - roda o benchmark da horda e grava em Saved/Benchmarks"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UHordeBenchmarkSubsystem* Bench = World ? World->GetSubsystem<UHordeBenchmarkSubsystem>() : nullptr)
+        {
+            const float Seconds = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 120.f;
+            const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1337;
+            const float StartAt = Args.Num() > 3 ? FCString::Atof(*Args[3]) : 0.f;
+            const float Speed = Args.Num() > 4 ? FCString::Atof(*Args[4]) : 1.f;
+            Bench->StartBenchmark(Seconds, Seed, Args.Num() > 2 ? Args[2] : FString(), FString(), StartAt, Speed);
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBenchmarkStop(
+    TEXT("Vazio.Benchmark.Stop"),
+    TEXT("Vazio.Benchmark.Stop - encerra o benchmark e grava o que foi coletado"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (UHordeBenchmarkSubsystem* Bench = World ? World->GetSubsystem<UHordeBenchmarkSubsystem>() : nullptr)
+        {
+            Bench->StopBenchmark();
+        }
+    }),
+    ECVF_Default
+);
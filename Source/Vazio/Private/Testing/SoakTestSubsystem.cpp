@@ -0,0 +1,552 @@
+#include "Testing/SoakTestSubsystem.h"
+#include "Testing/HordeBenchmarkSubsystem.h"
+#include "Enemy/EnemyBase.h"
+#include "Enemy/EnemyPoolSubsystem.h"
+#include "Enemy/EnemySpawnHelper.h"
+#include "Enemy/SpawnTimeline.h"
+#include "World/Common/Player/MyCharacter.h"
+#include "World/Common/Player/PlayerHealthComponent.h"
+#include "World/Common/Collectables/XPOrb.h"
+#include "World/Common/Projectiles/RangedProjectile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/FileManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSoak, Log, All);
+
+// Classes com menos instâncias que isso não entram no relatório (ruído)
+static constexpr int32 SoakMinClassCount = 8;
+// Amostras iniciais ignoradas na detecção de crescimento (pools/caches enchendo)
+static constexpr int32 SoakWarmupSamples = 2;
+// Fração mínima de passos não-decrescentes para considerar a série monotônica
+static constexpr float SoakMonotonicRatio = 0.8f;
+// Intervalo entre o fim da timeline e o reinício do loop
+static constexpr float SoakLoopGapSeconds = 5.f;
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+struct FSoakLLMTag
+{
+    const TCHAR* Name;
+    ELLMTag Tag;
+};
+
+static const FSoakLLMTag SoakLLMTags[] =
+{
+    { TEXT("TrackedTotal"), ELLMTag::TrackedTotal },
+    { TEXT("UObject"), ELLMTag::UObject },
+    { TEXT("Meshes"), ELLMTag::Meshes },
+    { TEXT("Materials"), ELLMTag::Materials },
+    { TEXT("Textures"), ELLMTag::Textures },
+    { TEXT("Physics"), ELLMTag::Physics },
+    { TEXT("Audio"), ELLMTag::Audio },
+    { TEXT("UI"), ELLMTag::UI },
+};
+#endif
+
+static float BytesToMB(uint64 Bytes)
+{
+    return static_cast<float>(Bytes / (1024.0 * 1024.0));
+}
+
+bool USoakTestSubsystem::IsSoakCommandLine()
+{
+    return FParse::Param(FCommandLine::Get(), TEXT("HordeSoak"));
+}
+
+bool USoakTestSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void USoakTestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &USoakTestSubsystem::HandlePreGC);
+    PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &USoakTestSubsystem::HandlePostGC);
+}
+
+void USoakTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (!IsSoakCommandLine())
+    {
+        return;
+    }
+
+    float Minutes = 30.f;
+    float IntervalSeconds = 30.f;
+    float Speed = 2.f;
+    FString TimelinePath;
+    FString RunName;
+    FParse::Value(FCommandLine::Get(), TEXT("SoakMinutes="), Minutes);
+    FParse::Value(FCommandLine::Get(), TEXT("SoakInterval="), IntervalSeconds);
+    FParse::Value(FCommandLine::Get(), TEXT("SoakSpeed="), Speed);
+    FParse::Value(FCommandLine::Get(), TEXT("SoakTimeline="), TimelinePath);
+    FParse::Value(FCommandLine::Get(), TEXT("SoakName="), RunName);
+
+    bExitWhenDone = true;
+
+    // Mesmo atraso do benchmark: o GameMode configura o spawner no BeginPlay dos atores
+    FTimerHandle StartHandle;
+    InWorld.GetTimerManager().SetTimer(StartHandle, FTimerDelegate::CreateWeakLambda(this, [this, Minutes, IntervalSeconds, Speed, TimelinePath, RunName]()
+    {
+        StartSoak(Minutes, IntervalSeconds, Speed, TimelinePath, RunName);
+    }), 1.0f, false);
+}
+
+void USoakTestSubsystem::Deinitialize()
+{
+    if (bRunning)
+    {
+        StopSoak();
+    }
+
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+
+    Super::Deinitialize();
+}
+
+TStatId USoakTestSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USoakTestSubsystem, STATGROUP_Tickables);
+}
+
+void USoakTestSubsystem::StartSoak(float Minutes, float IntervalSeconds, float Speed, const FString& TimelinePath, const FString& RunName)
+{
+    UWorld* World = GetWorld();
+    if (!World || bRunning)
+    {
+        return;
+    }
+
+    const USpawnTimeline* Source = TimelinePath.IsEmpty()
+        ? UEnemySpawnHelper::CreateTimelineFromJSON(UEnemySpawnHelper::GetExampleJSON())
+        : UEnemySpawnHelper::LoadTimelineFile(TimelinePath);
+    TimelineName = TimelinePath.IsEmpty() ? TEXT("ExampleJSON") : FPaths::GetCleanFilename(TimelinePath);
+    if (!Source)
+    {
+        return;
+    }
+
+    // Cópia comprimida no tempo. Bosses ficam de fora: pausam a horda até morrerem e o
+    // soak quer o loop de spawn/morte/pool rodando sem parar.
+    SpeedScale = FMath::Max(0.1f, Speed);
+    LoopTimeline = NewObject<USpawnTimeline>(this);
+    LoopLength = 0.f;
+    for (const FSpawnEvent& Event : Source->Events)
+    {
+        FSpawnEvent& Scaled = LoopTimeline->Events.Add_GetRef(Event);
+        Scaled.TimeSeconds = Event.TimeSeconds / SpeedScale;
+        LoopLength = FMath::Max(LoopLength, Scaled.TimeSeconds);
+    }
+    LoopLength = FMath::Max(10.f, LoopLength + SoakLoopGapSeconds);
+
+    DurationSeconds = Minutes > 0.f ? Minutes * 60.f : 0.f;
+    Interval = FMath::Max(5.f, IntervalSeconds);
+    Name = RunName.IsEmpty() ? FString::Printf(TEXT("Soak-%s"), *FDateTime::Now().ToString()) : RunName;
+    CSVPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Soak"), Name + TEXT(".csv"));
+
+    FString Header = TEXT("time_s,loop,used_physical_mb,used_virtual_mb,uobjects,actors,enemies,pool_active,pool_pooled,xp_orbs,projectiles,gc_count,gc_max_ms,gc_total_ms,avg_frame_ms");
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    for (const FSoakLLMTag& Tag : SoakLLMTags)
+    {
+        Header += FString::Printf(TEXT(",llm_%s_mb"), Tag.Name);
+    }
+#endif
+    Header += TEXT("\n");
+    FFileHelper::SaveStringToFile(Header, *CSVPath);
+
+    Samples.Reset();
+    LoopIndex = 0;
+    AttackTimer = 0.f;
+    FramesSinceSample = 0;
+    FrameSecondsSinceSample = 0.0;
+    GCCount = 0;
+    GCMaxSeconds = 0.0;
+    GCTotalSeconds = 0.0;
+    StartWallSeconds = FPlatformTime::Seconds();
+    bRunning = true;
+
+    RestartLoop();
+
+    // Amostra de referência logo após o primeiro GC
+    NextSampleWallSeconds = StartWallSeconds;
+
+    UE_LOG(LogSoak, Log, TEXT("Soak '%s' iniciado: %s, amostra a cada %.0fs, timeline %s em %.1fx (loop de %.0fs)"),
+           *Name, DurationSeconds > 0.f ? *FString::Printf(TEXT("%.0f min"), DurationSeconds / 60.f) : TEXT("sem limite"),
+           Interval, *TimelineName, SpeedScale, LoopLength);
+}
+
+void USoakTestSubsystem::StopSoak()
+{
+    if (!bRunning)
+    {
+        return;
+    }
+
+    bRunning = false;
+    bSamplePending = false;
+    TakeSample();
+    WriteReport();
+
+    if (bExitWhenDone)
+    {
+        FPlatformMisc::RequestExit(false, TEXT("HordeSoak"));
+    }
+}
+
+void USoakTestSubsystem::RestartLoop()
+{
+    UWorld* World = GetWorld();
+    if (!World || !LoopTimeline)
+    {
+        return;
+    }
+
+    // Seed diferente por loop para variar posições, mas reproduzível entre execuções
+    UEnemySpawnHelper::StartSpawnTimeline(World, LoopTimeline, 1337 + LoopIndex);
+    LoopStartWorldSeconds = World->GetTimeSeconds();
+}
+
+void USoakTestSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!bRunning)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    ++FramesSinceSample;
+    FrameSecondsSinceSample += DeltaTime;
+
+    if (AMyCharacter* Character = Cast<AMyCharacter>(UGameplayStatics::GetPlayerPawn(World, 0)))
+    {
+        UPlayerHealthComponent* Health = Character->GetHealthComponent();
+        if (Health && !Health->IsInvulnerable())
+        {
+            Health->SetInvulnerable(true);
+        }
+    }
+    UHordeBenchmarkSubsystem::DriveBot(World, World->GetTimeSeconds(), DeltaTime, AttackTimer);
+
+    if (World->GetTimeSeconds() - LoopStartWorldSeconds >= LoopLength)
+    {
+        ++LoopIndex;
+        RestartLoop();
+    }
+
+    // Pede um GC completo e só amostra depois que ele rodar, para contar apenas objetos vivos
+    const double Now = FPlatformTime::Seconds();
+    if (!bSamplePending && Now >= NextSampleWallSeconds)
+    {
+        bSamplePending = true;
+        GCCountAtRequest = GCCount;
+        if (GEngine)
+        {
+            GEngine->ForceGarbageCollection(true);
+        }
+    }
+    else if (bSamplePending && GCCount > GCCountAtRequest)
+    {
+        bSamplePending = false;
+        NextSampleWallSeconds = Now + Interval;
+        TakeSample();
+    }
+
+    if (DurationSeconds > 0.f && Now - StartWallSeconds >= DurationSeconds)
+    {
+        StopSoak();
+    }
+}
+
+void USoakTestSubsystem::HandlePreGC()
+{
+    GCStartSeconds = FPlatformTime::Seconds();
+}
+
+void USoakTestSubsystem::HandlePostGC()
+{
+    if (!bRunning || GCStartSeconds <= 0.0)
+    {
+        return;
+    }
+
+    const double Pause = FPlatformTime::Seconds() - GCStartSeconds;
+    GCStartSeconds = 0.0;
+    ++GCCount;
+    GCMaxSeconds = FMath::Max(GCMaxSeconds, Pause);
+    GCTotalSeconds += Pause;
+}
+
+void USoakTestSubsystem::TakeSample()
+{
+    UWorld* World = GetWorld();
+    FSoakSample& Sample = Samples.AddDefaulted_GetRef();
+    Sample.Time = FPlatformTime::Seconds() - StartWallSeconds;
+    Sample.Loop = LoopIndex;
+
+    const FPlatformMemoryStats Memory = FPlatformMemory::GetStats();
+    Sample.UsedPhysicalMB = BytesToMB(Memory.UsedPhysical);
+    Sample.UsedVirtualMB = BytesToMB(Memory.UsedVirtual);
+    Sample.TotalObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+    if (World)
+    {
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            ++Sample.Actors;
+            if (It->IsA<AEnemyBase>() && !It->IsHidden())
+            {
+                ++Sample.Enemies;
+            }
+            else if (It->IsA<AXPOrb>())
+            {
+                ++Sample.XPOrbs;
+            }
+            else if (It->IsA<ARangedProjectile>())
+            {
+                ++Sample.Projectiles;
+            }
+        }
+
+        if (const UEnemyPoolSubsystem* Pool = World->GetSubsystem<UEnemyPoolSubsystem>())
+        {
+            Sample.PoolActive = Pool->GetNumActive();
+            Sample.PoolPooled = Pool->GetNumPooled();
+        }
+    }
+
+    Sample.GCCount = GCCount;
+    Sample.GCMaxMs = static_cast<float>(GCMaxSeconds * 1000.0);
+    Sample.GCTotalMs = static_cast<float>(GCTotalSeconds * 1000.0);
+    Sample.AvgFrameMs = FramesSinceSample > 0 ? static_cast<float>(FrameSecondsSinceSample * 1000.0 / FramesSinceSample) : 0.f;
+    GCCount = 0;
+    GCCountAtRequest = 0;
+    GCMaxSeconds = 0.0;
+    GCTotalSeconds = 0.0;
+    FramesSinceSample = 0;
+    FrameSecondsSinceSample = 0.0;
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    if (FLowLevelMemTracker::IsEnabled())
+    {
+        for (const FSoakLLMTag& Tag : SoakLLMTags)
+        {
+            Sample.LLMMB.Add(Tag.Name, BytesToMB(FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, Tag.Tag)));
+        }
+    }
+#endif
+
+    // Contagem por classe: caro, mas roda uma vez por intervalo
+    TMap<FName, int32> Counts;
+    for (TObjectIterator<UObject> It; It; ++It)
+    {
+        ++Counts.FindOrAdd(It->GetClass()->GetFName());
+    }
+    for (const TPair<FName, int32>& Pair : Counts)
+    {
+        if (Pair.Value >= SoakMinClassCount)
+        {
+            Sample.ClassCounts.Add(Pair.Key, Pair.Value);
+        }
+    }
+
+    AppendCSV(Sample);
+
+    UE_LOG(LogSoak, Log, TEXT("Soak %.0fs (loop %d): %.0f MB, %d UObjects, %d inimigos, pool %d/%d, GC max %.1fms"),
+           Sample.Time, Sample.Loop, Sample.UsedPhysicalMB, Sample.TotalObjects, Sample.Enemies,
+           Sample.PoolActive, Sample.PoolPooled, Sample.GCMaxMs);
+}
+
+void USoakTestSubsystem::AppendCSV(const FSoakSample& Sample)
+{
+    FString Line = FString::Printf(TEXT("%.1f,%d,%.1f,%.1f,%d,%d,%d,%d,%d,%d,%d,%d,%.2f,%.2f,%.2f"),
+        Sample.Time, Sample.Loop, Sample.UsedPhysicalMB, Sample.UsedVirtualMB, Sample.TotalObjects, Sample.Actors,
+        Sample.Enemies, Sample.PoolActive, Sample.PoolPooled, Sample.XPOrbs, Sample.Projectiles,
+        Sample.GCCount, Sample.GCMaxMs, Sample.GCTotalMs, Sample.AvgFrameMs);
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    for (const FSoakLLMTag& Tag : SoakLLMTags)
+    {
+        const float* MB = Sample.LLMMB.Find(Tag.Name);
+        Line += FString::Printf(TEXT(",%.2f"), MB ? *MB : 0.f);
+    }
+#endif
+    Line += TEXT("\n");
+
+    // Append a cada amostra: se o processo cair, o CSV até ali sobrevive
+    FFileHelper::SaveStringToFile(Line, *CSVPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+// Crescimento monotônico: quase todos os passos não-decrescentes e aumento final relevante
+static bool IsMonotonicGrowth(const TArray<float>& Series, float MinGrowth, float& OutRatio)
+{
+    OutRatio = 0.f;
+    if (Series.Num() < 3)
+    {
+        return false;
+    }
+
+    int32 NonDecreasing = 0;
+    for (int32 i = 1; i < Series.Num(); ++i)
+    {
+        if (Series[i] >= Series[i - 1])
+        {
+            ++NonDecreasing;
+        }
+    }
+    OutRatio = static_cast<float>(NonDecreasing) / (Series.Num() - 1);
+
+    const float Growth = Series.Last() - Series[0];
+    return OutRatio >= SoakMonotonicRatio && Growth >= MinGrowth && Growth > 0.1f * FMath::Abs(Series[0]);
+}
+
+void USoakTestSubsystem::WriteReport()
+{
+    const int32 First = FMath::Min(SoakWarmupSamples, FMath::Max(0, Samples.Num() - 3));
+
+    // Séries avaliadas: nome -> (valores, crescimento mínimo absoluto)
+    TMap<FString, TPair<TArray<float>, float>> Series;
+    auto AddPoint = [&Series](const FString& Key, float Value, float MinGrowth)
+    {
+        TPair<TArray<float>, float>& Entry = Series.FindOrAdd(Key);
+        Entry.Key.Add(Value);
+        Entry.Value = MinGrowth;
+    };
+
+    TSet<FName> ClassNames;
+    TSet<FName> LLMNames;
+    for (int32 i = First; i < Samples.Num(); ++i)
+    {
+        for (const TPair<FName, int32>& Pair : Samples[i].ClassCounts)
+        {
+            ClassNames.Add(Pair.Key);
+        }
+        for (const TPair<FName, float>& Pair : Samples[i].LLMMB)
+        {
+            LLMNames.Add(Pair.Key);
+        }
+    }
+
+    for (int32 i = First; i < Samples.Num(); ++i)
+    {
+        const FSoakSample& Sample = Samples[i];
+        AddPoint(TEXT("used_physical_mb"), Sample.UsedPhysicalMB, 32.f);
+        AddPoint(TEXT("uobjects"), static_cast<float>(Sample.TotalObjects), 500.f);
+        AddPoint(TEXT("actors"), static_cast<float>(Sample.Actors), 50.f);
+        AddPoint(TEXT("pool_pooled"), static_cast<float>(Sample.PoolPooled), 20.f);
+        AddPoint(TEXT("gc_max_ms"), Sample.GCMaxMs, 5.f);
+        for (const FName& LLMName : LLMNames)
+        {
+            const float* MB = Sample.LLMMB.Find(LLMName);
+            AddPoint(TEXT("llm_") + LLMName.ToString(), MB ? *MB : 0.f, 8.f);
+        }
+        for (const FName& ClassName : ClassNames)
+        {
+            const int32* Count = Sample.ClassCounts.Find(ClassName);
+            AddPoint(TEXT("class_") + ClassName.ToString(), Count ? static_cast<float>(*Count) : 0.f, 50.f);
+        }
+    }
+
+    const float Minutes = Samples.Num() > First + 1 ? static_cast<float>((Samples.Last().Time - Samples[First].Time) / 60.0) : 0.f;
+
+    TArray<TSharedPtr<FJsonValue>> Flagged;
+    for (const TPair<FString, TPair<TArray<float>, float>>& Pair : Series)
+    {
+        float Ratio = 0.f;
+        const TArray<float>& Values = Pair.Value.Key;
+        if (!IsMonotonicGrowth(Values, Pair.Value.Value, Ratio))
+        {
+            continue;
+        }
+
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("series"), Pair.Key);
+        Entry->SetNumberField(TEXT("first"), Values[0]);
+        Entry->SetNumberField(TEXT("last"), Values.Last());
+        Entry->SetNumberField(TEXT("growth_per_minute"), Minutes > 0.f ? (Values.Last() - Values[0]) / Minutes : 0.f);
+        Entry->SetNumberField(TEXT("nondecreasing_ratio"), Ratio);
+        Flagged.Add(MakeShared<FJsonValueObject>(Entry));
+
+        UE_LOG(LogSoak, Warning, TEXT("Soak: crescimento monotônico em %s (%.1f -> %.1f, %.0f%% dos passos)"),
+               *Pair.Key, Values[0], Values.Last(), Ratio * 100.f);
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("name"), Name);
+    Root->SetStringField(TEXT("timeline"), TimelineName);
+    Root->SetNumberField(TEXT("speed"), SpeedScale);
+    Root->SetNumberField(TEXT("interval_s"), Interval);
+    Root->SetNumberField(TEXT("loops"), LoopIndex + 1);
+    Root->SetNumberField(TEXT("samples"), Samples.Num());
+    Root->SetNumberField(TEXT("warmup_samples"), First);
+    Root->SetNumberField(TEXT("evaluated_minutes"), Minutes);
+    Root->SetBoolField(TEXT("llm_enabled"), LLMNames.Num() > 0);
+    Root->SetBoolField(TEXT("growth_detected"), Flagged.Num() > 0);
+    Root->SetArrayField(TEXT("monotonic_growth"), Flagged);
+    if (Samples.Num() > 0)
+    {
+        Root->SetNumberField(TEXT("start_used_mb"), Samples[0].UsedPhysicalMB);
+        Root->SetNumberField(TEXT("end_used_mb"), Samples.Last().UsedPhysicalMB);
+        Root->SetNumberField(TEXT("start_uobjects"), Samples[0].TotalObjects);
+        Root->SetNumberField(TEXT("end_uobjects"), Samples.Last().TotalObjects);
+    }
+
+    FString JSON;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSON);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const FString ReportPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Soak"), Name + TEXT("_report.json"));
+    FFileHelper::SaveStringToFile(JSON, *ReportPath);
+
+    UE_LOG(LogSoak, Log, TEXT("Soak '%s' concluído: %d amostras, %d séries com crescimento -> %s"),
+           *Name, Samples.Num(), Flagged.Num(), *ReportPath);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdSoakStart(
+    TEXT("Vazio.Soak.Start"),
+    TEXT("Vazio.Soak.Start [Minutos=0 (sem limite)] [Intervalo=30] [Velocidade=2] [Timeline relativa a Content/] - soak test com relatório em Saved/Soak"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (USoakTestSubsystem* Soak = World ? World->GetSubsystem<USoakTestSubsystem>() : nullptr)
+        {
+            const float Minutes = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 0.f;
+            const float IntervalSeconds = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 30.f;
+            const float Speed = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 2.f;
+            Soak->StartSoak(Minutes, IntervalSeconds, Speed, Args.Num() > 3 ? Args[3] : FString());
+        }
+    }),
+    ECVF_Default
+);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdSoakStop(
+    TEXT("Vazio.Soak.Stop"),
+    TEXT("Vazio.Soak.Stop - encerra o soak test e grava o relatório"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (USoakTestSubsystem* Soak = World ? World->GetSubsystem<USoakTestSubsystem>() : nullptr)
+        {
+            Soak->StopSoak();
+        }
+    }),
+    ECVF_Default
+);
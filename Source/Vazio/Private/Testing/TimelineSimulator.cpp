@@ -0,0 +1,919 @@
+#include "Testing/TimelineSimulator.h"
+#include "Enemy/Components/EnemyDropComponent.h"
+#include "Enemy/EnemyConfig.h"
+#include "Enemy/EnemySpawnHelper.h"
+#include "Enemy/SpawnTimeline.h"
+#include "Enemy/Types/BossEnemy.h"
+#include "Enemy/Types/SplitterSlime.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTimelineSim, Log, All);
+
+// Espelham UEnemySpawnerSubsystem::BossResumeDelayBuffer / BossSpawnForwardDistance
+static constexpr float SimBossResumeDelayBuffer = 3.f;
+static constexpr float SimBossSpawnDistance = 1200.f;
+
+// Tempo extra máximo esperando um boss que o modelo de abate não consegue derrotar
+static constexpr float SimBossOvertimeSeconds = 300.f;
+
+static constexpr int32 SimHistogramSize = 65;
+
+void FTimelineSimSettings::ParseFromCommandLine(const TCHAR* Params)
+{
+    FParse::Value(Params, TEXT("DPS="), PlayerDPS);
+    FParse::Value(Params, TEXT("DPSGrowth="), DPSGrowthPerMinute);
+    FParse::Value(Params, TEXT("Targets="), MaxTargets);
+    FParse::Value(Params, TEXT("Approach="), LinearApproachDistance);
+    FParse::Value(Params, TEXT("OrbPickup="), OrbPickupSeconds);
+    FParse::Value(Params, TEXT("TickRate="), TickRate);
+    FParse::Value(Params, TEXT("Extra="), ExtraSeconds);
+    FParse::Value(Params, TEXT("Headroom="), PoolHeadroom);
+    FParse::Value(Params, TEXT("StopAt="), StopAtSeconds);
+
+    TickRate = FMath::Max(1.f, TickRate);
+    MaxTargets = FMath::Max(1, MaxTargets);
+}
+
+namespace
+{
+    struct FSimEnemy
+    {
+        FName Type;
+        FEnemyInstanceModifiers Mods;
+        float HP = 0.f;
+        float MaxHP = 1.f;
+        float EngageTime = 0.f;
+        int32 XPOrbs = 1;
+        bool bParent = false;
+        bool bSplitChild = false;
+        bool bBossMinion = false;
+        bool bBoss = false;
+    };
+
+    struct FSimDeferredSpawn
+    {
+        FName Type;
+        FEnemyArchetype Archetype;
+        FEnemyInstanceModifiers Mods;
+    };
+
+    // Estado do ciclo de ataque de ABossEnemy (cooldown -> telegraph -> execução / HandleSummoning)
+    struct FSimBoss
+    {
+        bool bActive = false;
+        FBossSpawnEntry Entry;
+        TArray<FBossPhaseDefinition> Phases;
+        int32 PhaseIndex = INDEX_NONE;
+        int32 PatternIndex = 0;
+        float AttackTimer = 0.f;
+        float SummonTimer = 0.f;
+        bool bTelegraph = false;
+        bool bHasPattern = false;
+        FBossAttackPattern CurrentPattern;
+        float DefaultAttackInterval = 5.f;
+        bool bLoopPatterns = true;
+        float MaxHP = 1.f;
+        int32 ReportIndex = INDEX_NONE;
+    };
+
+    int32 GetIntCVar(const TCHAR* Name, int32 Fallback)
+    {
+        const IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name);
+        return CVar ? CVar->GetInt() : Fallback;
+    }
+
+    class FTimelineSimRun
+    {
+    public:
+        FTimelineSimRun(const UEnemyConfig& InConfig, const FTimelineSimSettings& InSettings, FTimelineSimReport& InReport)
+            : Config(InConfig)
+            , Settings(InSettings)
+            , Report(InReport)
+        {
+            Report.SpawnBudget = FMath::Max(1, GetIntCVar(TEXT("Enemy.DeferredSpawnBudget"), 6));
+            Report.MaxSplitChildren = GetIntCVar(TEXT("Enemy.MaxSplitChildren"), 60);
+
+            // Um boss por vez na simulação: os dois tetos de lacaios se reduzem ao menor
+            const int32 MaxPerBoss = GetIntCVar(TEXT("Enemy.Boss.MaxMinionsPerBoss"), 16);
+            const int32 MaxGlobal = GetIntCVar(TEXT("Enemy.Boss.MaxMinions"), 32);
+            Report.MaxBossMinions = MaxPerBoss < 0 ? MaxGlobal : (MaxGlobal < 0 ? MaxPerBoss : FMath::Min(MaxPerBoss, MaxGlobal));
+            Report.FrameSpawnHistogram.SetNumZeroed(SimHistogramSize);
+
+            const ASplitterSlime* Splitter = GetDefault<ASplitterSlime>();
+            SplitChildrenCount = Splitter->GetChildrenCount();
+            SplitChildrenHPMultiplier = Splitter->GetChildrenHPMultiplier();
+        }
+
+        void Run(const USpawnTimeline& Timeline)
+        {
+            TArray<FSpawnEvent> Events = Timeline.Events;
+            Events.StableSort([](const FSpawnEvent& A, const FSpawnEvent& B) { return A.TimeSeconds < B.TimeSeconds; });
+
+            // Bosses vindos do JSON só preenchem TriggerTime; o spawner agenda por TimeSeconds
+            TArray<FBossSpawnEntry> BossEvents;
+            for (FBossSpawnEntry Entry : Timeline.BossEvents)
+            {
+                if (Entry.TimeSeconds <= 0.f && Entry.TriggerTime > 0.f)
+                {
+                    Report.Warnings.Add(FString::Printf(TEXT("Boss %s só tem TriggerTime (%.1fs): o spawner agenda por TimeSeconds e não vai dispará-lo. Simulado em TriggerTime."),
+                        *Entry.BossType.ToString(), Entry.TriggerTime));
+                    Entry.TimeSeconds = Entry.TriggerTime;
+                }
+                BossEvents.Add(Entry);
+            }
+            BossEvents.StableSort([](const FBossSpawnEntry& A, const FBossSpawnEntry& B) { return A.TimeSeconds < B.TimeSeconds; });
+
+            float LastEventTime = 0.f;
+            for (const FSpawnEvent& Event : Events)
+            {
+                LastEventTime = FMath::Max(LastEventTime, Event.TimeSeconds);
+            }
+            for (const FBossSpawnEntry& Entry : BossEvents)
+            {
+                LastEventTime = FMath::Max(LastEventTime, Entry.TimeSeconds);
+            }
+            const float EndTime = LastEventTime + FMath::Max(0.f, Settings.ExtraSeconds);
+
+            const float Dt = 1.f / Settings.TickRate;
+            int32 NextEvent = 0;
+            int32 NextBoss = 0;
+            FTimelineSimSample Sample;
+
+            const bool bStopEarly = Settings.StopAtSeconds >= 0.f;
+            for (int32 Frame = 0;; ++Frame)
+            {
+                Time = Frame * Dt;
+                if (bStopEarly && Time > Settings.StopAtSeconds)
+                {
+                    // Eventos entre o último frame e StopAtSeconds contam como já executados pelo seek
+                    Time = Settings.StopAtSeconds;
+                    while (Events.IsValidIndex(NextEvent) && Events[NextEvent].TimeSeconds <= Time)
+                    {
+                        ExecuteSpawnEvent(Events[NextEvent++]);
+                    }
+                    while (BossEvents.IsValidIndex(NextBoss) && BossEvents[NextBoss].TimeSeconds <= Time)
+                    {
+                        BeginBossEncounter(BossEvents[NextBoss++]);
+                    }
+                    break;
+                }
+                if (Time > EndTime && (!Boss.bActive || Time > EndTime + SimBossOvertimeSeconds))
+                {
+                    if (Boss.bActive)
+                    {
+                        Report.Warnings.Add(FString::Printf(TEXT("Boss %s não foi derrotado pelo modelo de abate (DPS %.0f)"),
+                            *Boss.Entry.BossType.ToString(), Settings.PlayerDPS));
+                    }
+                    break;
+                }
+                FrameSpawns = 0;
+
+                // Timers do spawner
+                while (Events.IsValidIndex(NextEvent) && Events[NextEvent].TimeSeconds <= Time)
+                {
+                    ExecuteSpawnEvent(Events[NextEvent++]);
+                }
+                while (BossEvents.IsValidIndex(NextBoss) && BossEvents[NextBoss].TimeSeconds <= Time)
+                {
+                    BeginBossEncounter(BossEvents[NextBoss++]);
+                }
+                if (ResumeTime >= 0.f && Time >= ResumeTime)
+                {
+                    ResumeTime = -1.f;
+                    bRegularSpawnsPaused = false;
+                    TArray<FSpawnEvent> Pending = MoveTemp(HeldEvents);
+                    HeldEvents.Reset();
+                    for (const FSpawnEvent& Event : Pending)
+                    {
+                        ExecuteSpawnEvent(Event);
+                    }
+                }
+
+                // Tick dos atores: boss, dano do jogador, coleta de orbs
+                if (Boss.bActive)
+                {
+                    TickBoss(Dt);
+                }
+                ApplyPlayerDamage(Dt);
+                while (OrbExpiry.IsValidIndex(OrbHead) && OrbExpiry[OrbHead] <= Time)
+                {
+                    ++OrbHead;
+                }
+
+                // Pós-tick: fila de spawns adiados com orçamento
+                Report.PeakDeferredQueue = FMath::Max(Report.PeakDeferredQueue, Deferred.Num());
+                ProcessDeferredSpawns();
+
+                RecordFrame();
+
+                Sample.Spawns += FrameSpawns;
+                Sample.MaxFrameSpawns = FMath::Max(Sample.MaxFrameSpawns, FrameSpawns);
+                if (FMath::FloorToInt(Time + Dt) > FMath::FloorToInt(Time))
+                {
+                    Sample.Time = FMath::FloorToFloat(Time + Dt);
+                    Sample.Enemies = Alive.Num();
+                    Sample.Orbs = OrbExpiry.Num() - OrbHead;
+                    Sample.BossMinions = BossMinionsAlive;
+                    Sample.DeferredQueue = Deferred.Num();
+                    Report.Samples.Add(Sample);
+                    Sample = FTimelineSimSample();
+                }
+                Report.Frames = Frame + 1;
+            }
+
+            Report.SimulatedSeconds = Time;
+            Report.TotalOrbs = OrbExpiry.Num();
+
+            if (bStopEarly)
+            {
+                CaptureLiveState();
+            }
+        }
+
+    private:
+        void CaptureLiveState()
+        {
+            Report.LiveEnemies.Reset(Alive.Num());
+            for (const FSimEnemy& Enemy : Alive)
+            {
+                if (Enemy.bBoss)
+                {
+                    Report.ActiveBossHealthFraction = FMath::Clamp(Enemy.HP / Enemy.MaxHP, 0.f, 1.f);
+                    continue;
+                }
+
+                FTimelineSimLiveEnemy& Live = Report.LiveEnemies.AddDefaulted_GetRef();
+                Live.Type = Enemy.Type;
+                Live.Mods = Enemy.Mods;
+                Live.HealthFraction = FMath::Clamp(Enemy.HP / Enemy.MaxHP, 0.f, 1.f);
+                Live.bSplitChild = Enemy.bSplitChild;
+                Live.bBossMinion = Enemy.bBossMinion;
+            }
+
+            // Filhos de split ainda na fila também existem no instante do seek
+            for (const FSimDeferredSpawn& Request : Deferred)
+            {
+                FTimelineSimLiveEnemy& Live = Report.LiveEnemies.AddDefaulted_GetRef();
+                Live.Type = Request.Type;
+                Live.Mods = Request.Mods;
+                Live.bSplitChild = true;
+            }
+
+            Report.HeldEvents = HeldEvents;
+            Report.bBossActive = Boss.bActive;
+            Report.ActiveBossEntry = Boss.bActive ? Boss.Entry : FBossSpawnEntry();
+            Report.ResumeInSeconds = ResumeTime >= 0.f ? ResumeTime - Time : -1.f;
+        }
+
+        void ExecuteSpawnEvent(const FSpawnEvent& Event)
+        {
+            if ((Boss.bActive || bRegularSpawnsPaused) && !Event.bAllowDuringBossEncounter)
+            {
+                HeldEvents.Add(Event);
+                return;
+            }
+
+            for (const FTypeCount& TypeCount : Event.Linear)
+            {
+                for (int32 i = 0; i < TypeCount.Count; ++i)
+                {
+                    SpawnEnemy(TypeCount.Type, TypeCount.Mods, Settings.LinearApproachDistance);
+                }
+            }
+            for (const FCircleSpawn& Circle : Event.Circles)
+            {
+                for (int32 i = 0; i < Circle.Count; ++i)
+                {
+                    SpawnEnemy(Circle.Type, Circle.Mods, Circle.Radius);
+                }
+            }
+        }
+
+        FSimEnemy* SpawnEnemy(FName Type, const FEnemyInstanceModifiers& Mods, float ApproachDistance)
+        {
+            const FEnemyArchetype* Archetype = Config.GetArchetype(Type);
+            if (!Archetype)
+            {
+                if (!MissingTypes.Contains(Type))
+                {
+                    MissingTypes.Add(Type);
+                    Report.Warnings.Add(FString::Printf(TEXT("Tipo %s sem arquétipo na EnemyConfig: spawns ignorados"), *Type.ToString()));
+                }
+                return nullptr;
+            }
+            return SpawnEnemy(Type, *Archetype, Mods, ApproachDistance);
+        }
+
+        FSimEnemy* SpawnEnemy(FName Type, const FEnemyArchetype& Archetype, const FEnemyInstanceModifiers& Mods, float ApproachDistance)
+        {
+            // Mesmas regras de AEnemyBase::ApplyArchetypeAndModifiers / UEnemySpawnerSubsystem::SpawnOne
+            const float Speed = FMath::Max(1.f, Archetype.BaseSpeed * (Mods.bBig ? 0.5f : 1.f));
+
+            FSimEnemy& Enemy = Alive.AddDefaulted_GetRef();
+            Enemy.Type = Type;
+            Enemy.Mods = Mods;
+            Enemy.HP = Archetype.BaseHP * (Mods.bBig ? 2.f : 1.f);
+            Enemy.MaxHP = FMath::Max(1.f, Enemy.HP);
+            Enemy.EngageTime = Time + ApproachDistance / Speed;
+            Enemy.bParent = Type == TEXT("SplitterSlime") && Archetype.Death == EOnDeathBehavior::Split;
+            Enemy.XPOrbs = UEnemyDropComponent::GetXPOrbCount(UEnemyDropComponent::CalculateXPDrop(Archetype, Mods, Enemy.bParent));
+
+            FTimelineSimTypeStats& Stats = Report.Types.FindOrAdd(Type);
+            ++Stats.Spawned;
+            ++Stats.Alive;
+            if (Stats.Alive > Stats.PeakAlive)
+            {
+                Stats.PeakAlive = Stats.Alive;
+                Stats.PeakTime = Time;
+            }
+
+            ++FrameSpawns;
+            return &Enemy;
+        }
+
+        void BeginBossEncounter(const FBossSpawnEntry& Entry)
+        {
+            if (Entry.BossType.IsNone())
+            {
+                return;
+            }
+            if (Boss.bActive)
+            {
+                Report.Warnings.Add(FString::Printf(TEXT("Boss %s em %.1fs ignorado: %s ainda ativo (o spawner também descarta)"),
+                    *Entry.BossType.ToString(), Time, *Boss.Entry.BossType.ToString()));
+                return;
+            }
+
+            // Os nomes de tipo do spawner são os nomes das classes nativas
+            const UClass* BossClass = FindFirstObject<UClass>(*Entry.BossType.ToString(), EFindFirstObjectOptions::NativeFirst);
+            const ABossEnemy* BossCDO = BossClass ? Cast<ABossEnemy>(BossClass->GetDefaultObject()) : nullptr;
+            const FEnemyArchetype* Archetype = Config.GetArchetype(Entry.BossType);
+            if (!BossCDO || !Archetype)
+            {
+                Report.Warnings.Add(FString::Printf(TEXT("Boss %s sem classe ou arquétipo: ignorado"), *Entry.BossType.ToString()));
+                return;
+            }
+
+            const float Distance = Entry.EntranceDistance > 0.f ? Entry.EntranceDistance : SimBossSpawnDistance;
+            FSimEnemy* BossEnemy = SpawnEnemy(Entry.BossType, *Archetype, Entry.BossModifiers, Distance);
+            BossEnemy->bBoss = true;
+
+            Boss = FSimBoss();
+            Boss.bActive = true;
+            Boss.Entry = Entry;
+            Boss.MaxHP = FMath::Max(1.f, BossEnemy->HP);
+            Boss.DefaultAttackInterval = BossCDO->GetDefaultAttackInterval();
+            Boss.bLoopPatterns = BossCDO->LoopsPhasePatterns();
+            Boss.Phases = BossCDO->GetPhases();
+            Boss.Phases.Sort([](const FBossPhaseDefinition& A, const FBossPhaseDefinition& B)
+            {
+                return A.HealthThreshold > B.HealthThreshold;
+            });
+
+            FTimelineSimBossStats& Stats = Report.Bosses.AddDefaulted_GetRef();
+            Stats.Type = Entry.BossType;
+            Stats.SpawnTime = Time;
+            Boss.ReportIndex = Report.Bosses.Num() - 1;
+
+            if (Entry.bPauseRegularSpawns)
+            {
+                bRegularSpawnsPaused = true;
+            }
+            if (Boss.Phases.Num() > 0)
+            {
+                EnterBossPhase(0);
+            }
+        }
+
+        void EnterBossPhase(int32 PhaseIndex)
+        {
+            const FBossPhaseDefinition& Phase = Boss.Phases[PhaseIndex];
+            Boss.PhaseIndex = PhaseIndex;
+            Boss.PatternIndex = 0;
+            Boss.bTelegraph = false;
+            Boss.bHasPattern = false;
+            Boss.SummonTimer = Phase.SummonInterval > 0.f ? Phase.SummonInterval : 0.f;
+            Boss.AttackTimer = Phase.AttackIntervalOverride > 0.f ? Phase.AttackIntervalOverride : Boss.DefaultAttackInterval;
+        }
+
+        void EvaluateBossPhase(float HealthFraction)
+        {
+            int32 DesiredIndex = INDEX_NONE;
+            for (int32 Index = 0; Index < Boss.Phases.Num(); ++Index)
+            {
+                if (HealthFraction <= FMath::Clamp(Boss.Phases[Index].HealthThreshold, 0.f, 1.f))
+                {
+                    DesiredIndex = Index;
+                }
+            }
+            if (DesiredIndex == INDEX_NONE)
+            {
+                DesiredIndex = Boss.Phases.Num() - 1;
+            }
+            if (Boss.Phases.IsValidIndex(DesiredIndex) && DesiredIndex != Boss.PhaseIndex)
+            {
+                EnterBossPhase(DesiredIndex);
+            }
+        }
+
+        void TickBoss(float Dt)
+        {
+            if (!Boss.Phases.IsValidIndex(Boss.PhaseIndex))
+            {
+                return;
+            }
+            const FBossPhaseDefinition& Phase = Boss.Phases[Boss.PhaseIndex];
+
+            if (Phase.AttackPatterns.Num() > 0)
+            {
+                Boss.AttackTimer -= Dt;
+                if (Boss.bTelegraph)
+                {
+                    if (Boss.AttackTimer <= 0.f)
+                    {
+                        Boss.bTelegraph = false;
+                        if (Boss.bHasPattern)
+                        {
+                            ExecuteBossPattern(Boss.CurrentPattern);
+                        }
+                    }
+                }
+                else if (Boss.AttackTimer <= 0.f)
+                {
+                    if (!Phase.AttackPatterns.IsValidIndex(Boss.PatternIndex))
+                    {
+                        Boss.PatternIndex = Boss.bLoopPatterns ? 0 : FMath::Clamp(Boss.PatternIndex, 0, Phase.AttackPatterns.Num() - 1);
+                    }
+                    Boss.CurrentPattern = Phase.AttackPatterns[Boss.PatternIndex];
+                    Boss.bHasPattern = true;
+                    Boss.PatternIndex = Boss.bLoopPatterns
+                        ? (Boss.PatternIndex + 1) % Phase.AttackPatterns.Num()
+                        : FMath::Min(Boss.PatternIndex + 1, Phase.AttackPatterns.Num() - 1);
+
+                    if (Boss.CurrentPattern.TelegraphTime > 0.f)
+                    {
+                        Boss.bTelegraph = true;
+                        Boss.AttackTimer = Boss.CurrentPattern.TelegraphTime;
+                    }
+                    else
+                    {
+                        ExecuteBossPattern(Boss.CurrentPattern);
+                    }
+                }
+            }
+
+            // A execução acima pode ter trocado de fase; relê a fase atual
+            const FBossPhaseDefinition& SummonPhase = Boss.Phases[Boss.PhaseIndex];
+            if (SummonPhase.bEnableSummoningLoop && SummonPhase.SummonInterval > 0.f && SummonPhase.SummonCount > 0)
+            {
+                Boss.SummonTimer -= Dt;
+                if (Boss.SummonTimer <= 0.f)
+                {
+                    Boss.SummonTimer = SummonPhase.SummonInterval;
+                    SummonMinions(SummonPhase.SummonType, SummonPhase.SummonCount, SummonPhase.SummonRadius, SummonPhase.SummonModifiers);
+                }
+            }
+        }
+
+        void ExecuteBossPattern(const FBossAttackPattern& Pattern)
+        {
+            float NextInterval = Boss.DefaultAttackInterval;
+            if (Pattern.Cooldown > 0.f)
+            {
+                NextInterval = Pattern.Cooldown;
+            }
+            else if (Boss.Phases[Boss.PhaseIndex].AttackIntervalOverride > 0.f)
+            {
+                NextInterval = Boss.Phases[Boss.PhaseIndex].AttackIntervalOverride;
+            }
+            Boss.AttackTimer = FMath::Max(0.1f, NextInterval);
+            Boss.bHasPattern = false;
+
+            if (Pattern.bSummonsMinions)
+            {
+                SummonMinions(Pattern.MinionType, Pattern.MinionCount, Pattern.MinionSpawnRadius, Pattern.MinionModifiers);
+            }
+        }
+
+        void SummonMinions(FName Type, int32 Count, float Radius, const FEnemyInstanceModifiers& Mods)
+        {
+            if (Type.IsNone() || Count <= 0)
+            {
+                return;
+            }
+
+            const int32 Allowed = Report.MaxBossMinions >= 0 ? FMath::Clamp(Report.MaxBossMinions - BossMinionsAlive, 0, Count) : Count;
+            Report.DeniedBossMinions += Count - Allowed;
+
+            int32 Summoned = 0;
+            for (int32 i = 0; i < Allowed; ++i)
+            {
+                if (FSimEnemy* Minion = SpawnEnemy(Type, Mods, Radius))
+                {
+                    Minion->bBossMinion = true;
+                    ++Summoned;
+                }
+            }
+
+            BossMinionsAlive += Summoned;
+            Report.PeakBossMinions = FMath::Max(Report.PeakBossMinions, BossMinionsAlive);
+            if (Report.Bosses.IsValidIndex(Boss.ReportIndex))
+            {
+                FTimelineSimBossStats& Stats = Report.Bosses[Boss.ReportIndex];
+                Stats.MinionsSummoned += Summoned;
+                Stats.MinionsDenied += Count - Allowed;
+                Stats.PeakMinions = FMath::Max(Stats.PeakMinions, BossMinionsAlive);
+            }
+        }
+
+        void ApplyPlayerDamage(float Dt)
+        {
+            // Dano por alvo cresce com o tempo de partida (upgrades); mais antigos engajados primeiro
+            const float Damage = Settings.PlayerDPS * (1.f + Settings.DPSGrowthPerMinute * Time / 60.f) * Dt;
+            int32 Hits = 0;
+            bool bAnyDead = false;
+            for (FSimEnemy& Enemy : Alive)
+            {
+                if (Hits >= Settings.MaxTargets)
+                {
+                    break;
+                }
+                if (Enemy.EngageTime > Time)
+                {
+                    continue;
+                }
+
+                Enemy.HP -= Damage;
+                ++Hits;
+                bAnyDead |= Enemy.HP <= 0.f;
+                if (Enemy.bBoss && Enemy.HP > 0.f)
+                {
+                    EvaluateBossPhase(Enemy.HP / Boss.MaxHP);
+                }
+            }
+
+            if (!bAnyDead)
+            {
+                return;
+            }
+
+            TArray<FSimEnemy, TInlineAllocator<16>> Dead;
+            for (int32 i = 0; i < Alive.Num(); ++i)
+            {
+                if (Alive[i].HP <= 0.f)
+                {
+                    Dead.Add(Alive[i]);
+                }
+            }
+            Alive.RemoveAll([](const FSimEnemy& Enemy) { return Enemy.HP <= 0.f; });
+
+            for (const FSimEnemy& Enemy : Dead)
+            {
+                HandleKill(Enemy);
+            }
+        }
+
+        void HandleKill(const FSimEnemy& Enemy)
+        {
+            FTimelineSimTypeStats& Stats = Report.Types.FindOrAdd(Enemy.Type);
+            ++Stats.Killed;
+            --Stats.Alive;
+
+            for (int32 i = 0; i < Enemy.XPOrbs; ++i)
+            {
+                OrbExpiry.Add(Time + Settings.OrbPickupSeconds);
+            }
+
+            if (Enemy.bSplitChild)
+            {
+                LiveSplitChildren = FMath::Max(0, LiveSplitChildren - 1);
+            }
+            if (Enemy.bBossMinion)
+            {
+                BossMinionsAlive = FMath::Max(0, BossMinionsAlive - 1);
+            }
+
+            if (Enemy.bParent)
+            {
+                const FEnemyArchetype* Archetype = Config.GetArchetype(Enemy.Type);
+                FSimDeferredSpawn Child;
+                Child.Type = Enemy.Type;
+                Child.Archetype = Archetype ? *Archetype : FEnemyArchetype();
+                Child.Archetype.BaseHP *= SplitChildrenHPMultiplier;
+                Child.Archetype.Death = EOnDeathBehavior::Normal;
+                Child.Mods = Enemy.Mods; // filhos herdam os modificadores do pai
+                for (int32 i = 0; i < SplitChildrenCount; ++i)
+                {
+                    if (Report.MaxSplitChildren >= 0 && LiveSplitChildren + Deferred.Num() >= Report.MaxSplitChildren)
+                    {
+                        ++Report.DroppedSplitChildren;
+                        continue;
+                    }
+                    Deferred.Add(Child);
+                }
+            }
+
+            if (Enemy.bBoss)
+            {
+                Boss.bActive = false;
+                if (Report.Bosses.IsValidIndex(Boss.ReportIndex))
+                {
+                    Report.Bosses[Boss.ReportIndex].DefeatTime = Time;
+                }
+                ResumeTime = Time + (Boss.Entry.bPauseRegularSpawns ? Boss.Entry.ResumeDelay + SimBossResumeDelayBuffer : 0.f);
+            }
+        }
+
+        void ProcessDeferredSpawns()
+        {
+            const int32 Count = FMath::Min(Report.SpawnBudget, Deferred.Num());
+            for (int32 i = 0; i < Count; ++i)
+            {
+                const FSimDeferredSpawn& Request = Deferred[i];
+                FSimEnemy* Child = SpawnEnemy(Request.Type, Request.Archetype, Request.Mods, 0.f);
+                Child->bSplitChild = true;
+                ++LiveSplitChildren;
+            }
+            Deferred.RemoveAt(0, Count, EAllowShrinking::No);
+            Report.PeakSplitChildren = FMath::Max(Report.PeakSplitChildren, LiveSplitChildren);
+        }
+
+        void RecordFrame()
+        {
+            if (Alive.Num() > Report.PeakEnemies)
+            {
+                Report.PeakEnemies = Alive.Num();
+                Report.PeakEnemiesTime = Time;
+            }
+
+            const int32 Orbs = OrbExpiry.Num() - OrbHead;
+            if (Orbs > Report.PeakOrbs)
+            {
+                Report.PeakOrbs = Orbs;
+                Report.PeakOrbsTime = Time;
+            }
+
+            if (FrameSpawns > Report.MaxFrameSpawns)
+            {
+                Report.MaxFrameSpawns = FrameSpawns;
+                Report.MaxFrameSpawnsTime = Time;
+            }
+            ++Report.FrameSpawnHistogram[FMath::Min(FrameSpawns, SimHistogramSize - 1)];
+            if (FrameSpawns > Report.SpawnBudget)
+            {
+                ++Report.FramesOverSpawnBudget;
+            }
+        }
+
+        const UEnemyConfig& Config;
+        const FTimelineSimSettings& Settings;
+        FTimelineSimReport& Report;
+
+        float Time = 0.f;
+        int32 FrameSpawns = 0;
+
+        // Vivos em ordem de spawn
+        TArray<FSimEnemy> Alive;
+        TArray<FSimDeferredSpawn> Deferred;
+        TArray<FSpawnEvent> HeldEvents;
+        TSet<FName> MissingTypes;
+
+        // Expirações de orbs são crescentes: basta avançar a cabeça
+        TArray<float> OrbExpiry;
+        int32 OrbHead = 0;
+
+        FSimBoss Boss;
+        bool bRegularSpawnsPaused = false;
+        float ResumeTime = -1.f;
+        int32 BossMinionsAlive = 0;
+
+        int32 LiveSplitChildren = 0;
+        int32 SplitChildrenCount = 2;
+        float SplitChildrenHPMultiplier = 0.5f;
+    };
+
+    // Percentil dos frames que tiveram spawn
+    int32 SpawnPercentile(const TArray<int32>& Histogram, float P)
+    {
+        int64 Total = 0;
+        for (int32 i = 1; i < Histogram.Num(); ++i)
+        {
+            Total += Histogram[i];
+        }
+        if (Total == 0)
+        {
+            return 0;
+        }
+
+        const int64 Target = FMath::CeilToInt64(Total * P);
+        int64 Running = 0;
+        for (int32 i = 1; i < Histogram.Num(); ++i)
+        {
+            Running += Histogram[i];
+            if (Running >= Target)
+            {
+                return i;
+            }
+        }
+        return Histogram.Num() - 1;
+    }
+}
+
+bool FTimelineSimulator::Run(const USpawnTimeline& Timeline, const UEnemyConfig& Config, const FTimelineSimSettings& Settings, FTimelineSimReport& OutReport)
+{
+    if (Timeline.Events.Num() == 0 && Timeline.BossEvents.Num() == 0)
+    {
+        UE_LOG(LogTimelineSim, Warning, TEXT("Timeline vazia, nada a simular"));
+        return false;
+    }
+
+    FTimelineSimRun SimRun(Config, Settings, OutReport);
+    SimRun.Run(Timeline);
+    return true;
+}
+
+bool FTimelineSimulator::WriteReport(const FTimelineSimReport& Report, const FTimelineSimSettings& Settings, const FString& Name)
+{
+    const FString Dir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"));
+
+    FString CSV = TEXT("time_s,enemies,xp_orbs,boss_minions,spawns,max_frame_spawns,deferred_queue\n");
+    for (const FTimelineSimSample& Sample : Report.Samples)
+    {
+        CSV += FString::Printf(TEXT("%.0f,%d,%d,%d,%d,%d,%d\n"), Sample.Time, Sample.Enemies, Sample.Orbs,
+                               Sample.BossMinions, Sample.Spawns, Sample.MaxFrameSpawns, Sample.DeferredQueue);
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("name"), Name);
+    Root->SetStringField(TEXT("timeline"), Report.TimelineName);
+    Root->SetNumberField(TEXT("simulated_s"), Report.SimulatedSeconds);
+    Root->SetNumberField(TEXT("frames"), Report.Frames);
+
+    TSharedRef<FJsonObject> Model = MakeShared<FJsonObject>();
+    Model->SetNumberField(TEXT("tick_rate"), Settings.TickRate);
+    Model->SetNumberField(TEXT("player_dps"), Settings.PlayerDPS);
+    Model->SetNumberField(TEXT("dps_growth_per_minute"), Settings.DPSGrowthPerMinute);
+    Model->SetNumberField(TEXT("max_targets"), Settings.MaxTargets);
+    Model->SetNumberField(TEXT("linear_approach_distance"), Settings.LinearApproachDistance);
+    Model->SetNumberField(TEXT("orb_pickup_s"), Settings.OrbPickupSeconds);
+    Root->SetObjectField(TEXT("model"), Model);
+
+    TSharedRef<FJsonObject> Peaks = MakeShared<FJsonObject>();
+    Peaks->SetNumberField(TEXT("enemies"), Report.PeakEnemies);
+    Peaks->SetNumberField(TEXT("enemies_time_s"), Report.PeakEnemiesTime);
+    Peaks->SetNumberField(TEXT("xp_orbs"), Report.PeakOrbs);
+    Peaks->SetNumberField(TEXT("xp_orbs_time_s"), Report.PeakOrbsTime);
+    Peaks->SetNumberField(TEXT("boss_minions"), Report.PeakBossMinions);
+    Peaks->SetNumberField(TEXT("split_children"), Report.PeakSplitChildren);
+    Peaks->SetNumberField(TEXT("deferred_queue"), Report.PeakDeferredQueue);
+    Peaks->SetNumberField(TEXT("frame_spawns"), Report.MaxFrameSpawns);
+    Peaks->SetNumberField(TEXT("frame_spawns_time_s"), Report.MaxFrameSpawnsTime);
+    Root->SetObjectField(TEXT("peaks"), Peaks);
+
+    TSharedRef<FJsonObject> Spawns = MakeShared<FJsonObject>();
+    Spawns->SetNumberField(TEXT("p50"), SpawnPercentile(Report.FrameSpawnHistogram, 0.5f));
+    Spawns->SetNumberField(TEXT("p95"), SpawnPercentile(Report.FrameSpawnHistogram, 0.95f));
+    Spawns->SetNumberField(TEXT("p99"), SpawnPercentile(Report.FrameSpawnHistogram, 0.99f));
+    Spawns->SetNumberField(TEXT("budget"), Report.SpawnBudget);
+    Spawns->SetNumberField(TEXT("frames_over_budget"), Report.FramesOverSpawnBudget);
+    Spawns->SetNumberField(TEXT("dropped_split_children"), Report.DroppedSplitChildren);
+    Spawns->SetNumberField(TEXT("boss_minion_cap"), Report.MaxBossMinions);
+    Spawns->SetNumberField(TEXT("denied_boss_minions"), Report.DeniedBossMinions);
+    Root->SetObjectField(TEXT("spawns_per_frame"), Spawns);
+
+    Root->SetNumberField(TEXT("total_xp_orbs"), Report.TotalOrbs);
+
+    // Sugestões: pico * (1 + folga) por arquétipo comum; bosses não passam pelo pool
+    TSharedRef<FJsonObject> Archetypes = MakeShared<FJsonObject>();
+    TSharedRef<FJsonObject> PoolSizes = MakeShared<FJsonObject>();
+    for (const TPair<FName, FTimelineSimTypeStats>& Pair : Report.Types)
+    {
+        const int32 PoolSize = FMath::CeilToInt(Pair.Value.PeakAlive * (1.f + Settings.PoolHeadroom));
+
+        TSharedRef<FJsonObject> Type = MakeShared<FJsonObject>();
+        Type->SetNumberField(TEXT("spawned"), Pair.Value.Spawned);
+        Type->SetNumberField(TEXT("killed"), Pair.Value.Killed);
+        Type->SetNumberField(TEXT("peak"), Pair.Value.PeakAlive);
+        Type->SetNumberField(TEXT("peak_time_s"), Pair.Value.PeakTime);
+        Archetypes->SetObjectField(Pair.Key.ToString(), Type);
+
+        const bool bBoss = Report.Bosses.ContainsByPredicate([&Pair](const FTimelineSimBossStats& Boss) { return Boss.Type == Pair.Key; });
+        if (!bBoss)
+        {
+            PoolSizes->SetNumberField(Pair.Key.ToString(), PoolSize);
+        }
+    }
+    Root->SetObjectField(TEXT("archetypes"), Archetypes);
+
+    TSharedRef<FJsonObject> Suggestions = MakeShared<FJsonObject>();
+    Suggestions->SetObjectField(TEXT("pool_prewarm"), PoolSizes);
+    Suggestions->SetNumberField(TEXT("deferred_spawn_budget"), FMath::Max(1, SpawnPercentile(Report.FrameSpawnHistogram, 0.95f)));
+    Suggestions->SetNumberField(TEXT("boss_minion_budget"), FMath::CeilToInt(Report.PeakBossMinions * (1.f + Settings.PoolHeadroom)));
+    Root->SetObjectField(TEXT("suggestions"), Suggestions);
+
+    TArray<TSharedPtr<FJsonValue>> Bosses;
+    for (const FTimelineSimBossStats& Boss : Report.Bosses)
+    {
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("type"), Boss.Type.ToString());
+        Entry->SetNumberField(TEXT("spawn_s"), Boss.SpawnTime);
+        Entry->SetNumberField(TEXT("defeat_s"), Boss.DefeatTime);
+        Entry->SetNumberField(TEXT("minions_summoned"), Boss.MinionsSummoned);
+        Entry->SetNumberField(TEXT("minions_denied"), Boss.MinionsDenied);
+        Entry->SetNumberField(TEXT("peak_minions"), Boss.PeakMinions);
+        Bosses.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+    Root->SetArrayField(TEXT("bosses"), Bosses);
+
+    TArray<TSharedPtr<FJsonValue>> Warnings;
+    for (const FString& Warning : Report.Warnings)
+    {
+        Warnings.Add(MakeShared<FJsonValueString>(Warning));
+    }
+    Root->SetArrayField(TEXT("warnings"), Warnings);
+
+    FString JSON;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSON);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const FString CSVPath = FPaths::Combine(Dir, Name + TEXT(".csv"));
+    const FString JSONPath = FPaths::Combine(Dir, Name + TEXT(".json"));
+    const bool bSaved = FFileHelper::SaveStringToFile(CSV, *CSVPath) && FFileHelper::SaveStringToFile(JSON, *JSONPath);
+
+    UE_LOG(LogTimelineSim, Log, TEXT("Simulação '%s' (%s, %.0fs): pico %d inimigos em %.1fs, %d spawns num frame (p95 %d, orçamento %d), pico %d orbs, pico %d minions -> %s"),
+           *Name, *Report.TimelineName, Report.SimulatedSeconds, Report.PeakEnemies, Report.PeakEnemiesTime,
+           Report.MaxFrameSpawns, SpawnPercentile(Report.FrameSpawnHistogram, 0.95f), Report.SpawnBudget,
+           Report.PeakOrbs, Report.PeakBossMinions, bSaved ? *JSONPath : TEXT("FALHOU ao gravar"));
+    for (const TPair<FName, FTimelineSimTypeStats>& Pair : Report.Types)
+    {
+        UE_LOG(LogTimelineSim, Log, TEXT("  %-18s pico %4d em %6.1fs  spawns %5d  abates %5d"),
+               *Pair.Key.ToString(), Pair.Value.PeakAlive, Pair.Value.PeakTime, Pair.Value.Spawned, Pair.Value.Killed);
+    }
+    for (const FString& Warning : Report.Warnings)
+    {
+        UE_LOG(LogTimelineSim, Warning, TEXT("  %s"), *Warning);
+    }
+
+    return bSaved;
+}
+
+bool FTimelineSimulator::RunFromFile(const FString& TimelinePath, const FTimelineSimSettings& Settings, const FString& Name, const UEnemyConfig* Config)
+{
+    const FString TimelineName = TimelinePath.IsEmpty() ? TEXT("ExampleJSON") : FPaths::GetCleanFilename(TimelinePath);
+    const USpawnTimeline* Timeline = TimelinePath.IsEmpty()
+        ? UEnemySpawnHelper::CreateTimelineFromJSON(UEnemySpawnHelper::GetExampleJSON())
+        : UEnemySpawnHelper::LoadTimelineFile(TimelinePath);
+    if (!Timeline)
+    {
+        return false;
+    }
+    if (!Config)
+    {
+        Config = UEnemyConfig::CreateDefaultConfig();
+    }
+
+    FTimelineSimReport Report;
+    Report.TimelineName = TimelineName;
+    if (!Run(*Timeline, *Config, Settings, Report))
+    {
+        return false;
+    }
+
+    const FString RunName = Name.IsEmpty()
+        ? FString::Printf(TEXT("TimelineSim-%s-%s"), *FPaths::GetBaseFilename(TimelineName), *FDateTime::Now().ToString())
+        : Name;
+    return WriteReport(Report, Settings, RunName);
+}
+
+static FAutoConsoleCommandWithArgs CmdTimelineSimulate(
+    TEXT("Vazio.Timeline.Simulate"),
+    TEXT("Vazio.Timeline.Simulate [Timeline relativa a Content/] [-DPS=80 -DPSGrowth=0.25 -Targets=3 -Approach=200 -OrbPickup=6 -Extra=60] - simula a timeline offline e grava em Saved/Benchmarks"),
+    FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+    {
+        FString TimelinePath;
+        FString Params;
+        for (const FString& Arg : Args)
+        {
+            if (Arg.StartsWith(TEXT("-")))
+            {
+                Params += TEXT(" ") + Arg;
+            }
+            else if (TimelinePath.IsEmpty())
+            {
+                TimelinePath = Arg;
+            }
+        }
+
+        FTimelineSimSettings Settings;
+        Settings.ParseFromCommandLine(*Params);
+        FTimelineSimulator::RunFromFile(TimelinePath, Settings);
+    }),
+    ECVF_Default
+);
@@ -1,4 +1,5 @@
 #include "UI/HUD/HUDSubsystem.h"
+#include "Core/VazioStats.h"
 #include "UI/HUD/SHUDRoot.h"
 #include "Enemy/EnemySpawnerSubsystem.h"
 #include "Enemy/Types/BossEnemy.h"
@@ -6,6 +7,13 @@
 #include "Widgets/SViewport.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarHUDUpdateInterval(
+    TEXT("Vazio.HUD.UpdateInterval"),
+    0.f,
+    TEXT("Intervalo mínimo (s, tempo real) entre flushes do HUD. 0 = uma atualização por widget por frame."),
+    ECVF_Default);
 
 void UHUDSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -36,14 +44,24 @@ void UHUDSubsystem::ShowHUD()
         return;
     }
 
+    // Spawner é por mundo: religa a cada fase
+    UWorld* World = GetWorld();
+    UEnemySpawnerSubsystem* Spawner = World ? World->GetSubsystem<UEnemySpawnerSubsystem>() : nullptr;
+    if (Spawner != ObservedSpawner.Get())
+    {
+        BindBossDelegates(Spawner);
+    }
+
     if (!bIsHUDVisible)
     {
-        if (UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport())
+        if (UGameViewportClient* ViewportClient = World ? World->GetGameViewport() : nullptr)
         {
             ViewportClient->AddViewportWidgetContent(HUDWidget.ToSharedRef(), 100);
             bIsHUDVisible = true;
         }
     }
+
+    FlushPendingUpdates();
 }
 
 void UHUDSubsystem::HideHUD()
@@ -65,74 +83,209 @@ void UHUDSubsystem::HideHUD()
 
 void UHUDSubsystem::UpdateHealth(float CurrentHealth, float MaxHealth)
 {
-    if (HUDWidget.IsValid())
+    if (Pending.bHealthDirty)
     {
-        HUDWidget->UpdateHealth(CurrentHealth, MaxHealth);
+        INC_DWORD_STAT(STAT_VazioHUDCoalesced);
     }
+    Pending.Health = CurrentHealth;
+    Pending.MaxHealth = MaxHealth;
+    Pending.bHealthDirty = true;
 }
 
 void UHUDSubsystem::UpdateXP(int32 CurrentXP, int32 XPToNextLevel)
 {
-    if (HUDWidget.IsValid())
+    if (Pending.bXPDirty)
     {
-        HUDWidget->UpdateXP(CurrentXP, XPToNextLevel);
+        INC_DWORD_STAT(STAT_VazioHUDCoalesced);
     }
+    Pending.XP = CurrentXP;
+    Pending.XPToNextLevel = XPToNextLevel;
+    Pending.bXPDirty = true;
 }
 
 void UHUDSubsystem::UpdateLevel(int32 NewLevel)
 {
-    if (HUDWidget.IsValid())
+    if (Pending.bLevelDirty)
+    {
+        INC_DWORD_STAT(STAT_VazioHUDCoalesced);
+    }
+    Pending.Level = NewLevel;
+    Pending.bLevelDirty = true;
+}
+
+void UHUDSubsystem::HandleSlatePreTick(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (Now - LastFlushSeconds < CVarHUDUpdateInterval.GetValueOnGameThread())
+    {
+        return;
+    }
+
+    LastFlushSeconds = Now;
+    FlushPendingUpdates();
+}
+
+void UHUDSubsystem::FlushPendingUpdates()
+{
+    if (!HUDWidget.IsValid())
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_VazioHUDUpdate);
+
+    if (Pending.bHealthDirty)
+    {
+        HUDWidget->UpdateHealth(Pending.Health, Pending.MaxHealth);
+        INC_DWORD_STAT(STAT_VazioHUDUpdates);
+    }
+    if (Pending.bXPDirty)
+    {
+        HUDWidget->UpdateXP(Pending.XP, Pending.XPToNextLevel);
+        INC_DWORD_STAT(STAT_VazioHUDUpdates);
+    }
+    if (Pending.bLevelDirty)
+    {
+        HUDWidget->UpdateLevel(Pending.Level);
+        INC_DWORD_STAT(STAT_VazioHUDUpdates);
+    }
+    if (Pending.bBossHealthDirty)
+    {
+        HUDWidget->UpdateBossHealth(Pending.BossHealth);
+        INC_DWORD_STAT(STAT_VazioHUDUpdates);
+    }
+    if (Pending.bBossPhaseDirty)
     {
-        HUDWidget->UpdateLevel(NewLevel);
+        HUDWidget->UpdateBossPhase(Pending.BossPhaseIndex, CachedBossPhaseCount);
+        INC_DWORD_STAT(STAT_VazioHUDUpdates);
     }
+
+    Pending.bHealthDirty = false;
+    Pending.bXPDirty = false;
+    Pending.bLevelDirty = false;
+    Pending.bBossHealthDirty = false;
+    Pending.bBossPhaseDirty = false;
 }
 
 void UHUDSubsystem::SetupDelegateBindings()
 {
-    // TODO: Setup delegate bindings for enemy spawner events
+    // Pré-tick do Slate roda depois do tick do mundo e antes do paint, inclusive com o jogo pausado
+    if (FSlateApplication::IsInitialized())
+    {
+        SlatePreTickHandle = FSlateApplication::Get().OnPreTick().AddUObject(this, &UHUDSubsystem::HandleSlatePreTick);
+    }
 }
 
 void UHUDSubsystem::CleanupDelegateBindings()
 {
-    // TODO: Cleanup delegate bindings
+    if (FSlateApplication::IsInitialized())
+    {
+        FSlateApplication::Get().OnPreTick().Remove(SlatePreTickHandle);
+    }
+    SlatePreTickHandle.Reset();
+
+    UnbindBossDelegates();
 }
 
 void UHUDSubsystem::BindBossDelegates(UEnemySpawnerSubsystem* Spawner)
 {
-    // TODO: Bind boss-related delegates
+    UnbindBossDelegates();
+    if (!Spawner)
+    {
+        return;
+    }
+
+    ObservedSpawner = Spawner;
+    BossSpawnedHandle = Spawner->OnBossSpawned.AddUObject(this, &UHUDSubsystem::HandleBossSpawned);
+    BossEndedHandle = Spawner->OnBossEnded.AddUObject(this, &UHUDSubsystem::HandleBossEnded);
+    BossHealthHandle = Spawner->OnBossHealthChanged.AddUObject(this, &UHUDSubsystem::HandleBossHealthChanged);
+    BossPhaseHandle = Spawner->OnBossPhaseChanged.AddUObject(this, &UHUDSubsystem::HandleBossPhaseChanged);
+    BossWarningHandle = Spawner->OnBossWarning.AddUObject(this, &UHUDSubsystem::HandleBossWarning);
+
+    if (ABossEnemy* Boss = Spawner->GetActiveBoss())
+    {
+        HandleBossSpawned(Boss, Spawner->GetActiveBossEntry());
+    }
 }
 
 void UHUDSubsystem::UnbindBossDelegates()
 {
-    // TODO: Unbind boss-related delegates
+    if (UEnemySpawnerSubsystem* Spawner = ObservedSpawner.Get())
+    {
+        Spawner->OnBossSpawned.Remove(BossSpawnedHandle);
+        Spawner->OnBossEnded.Remove(BossEndedHandle);
+        Spawner->OnBossHealthChanged.Remove(BossHealthHandle);
+        Spawner->OnBossPhaseChanged.Remove(BossPhaseHandle);
+        Spawner->OnBossWarning.Remove(BossWarningHandle);
+    }
+
+    ObservedSpawner.Reset();
+    BossSpawnedHandle.Reset();
+    BossEndedHandle.Reset();
+    BossHealthHandle.Reset();
+    BossPhaseHandle.Reset();
+    BossWarningHandle.Reset();
 }
 
 void UHUDSubsystem::HandleBossSpawned(ABossEnemy* Boss, const FBossSpawnEntry& Entry)
 {
-    // TODO: Handle boss spawned event
+    if (!Boss || !HUDWidget.IsValid())
+    {
+        return;
+    }
+
+    CachedBossName = Boss->GetBossDisplayName().IsEmpty() ? FText::FromName(Entry.BossType) : Boss->GetBossDisplayName();
+    CachedBossPhaseCount = Boss->GetPhases().Num();
+
+    // Barra aparece já com os valores atuais; o que estava pendente é de antes do spawn
+    Pending.bBossHealthDirty = false;
+    Pending.bBossPhaseDirty = false;
+    HUDWidget->ShowBossWarning(FText::GetEmpty());
+    HUDWidget->ShowBoss(CachedBossName, Boss->GetHealthFraction(), FMath::Max(0, Boss->GetCurrentPhaseIndex()), CachedBossPhaseCount);
 }
 
 void UHUDSubsystem::HandleBossEnded()
 {
-    // TODO: Handle boss ended event
+    Pending.bBossHealthDirty = false;
+    Pending.bBossPhaseDirty = false;
+    CachedBossPhaseCount = 0;
+
+    if (HUDWidget.IsValid())
+    {
+        HUDWidget->ShowBossWarning(FText::GetEmpty());
+        HUDWidget->HideBoss();
+    }
 }
 
 void UHUDSubsystem::HandleBossHealthChanged(float NormalizedHealth, ABossEnemy* Boss)
 {
-    // TODO: Handle boss health changed event
+    if (Pending.bBossHealthDirty)
+    {
+        INC_DWORD_STAT(STAT_VazioHUDCoalesced);
+    }
+    Pending.BossHealth = NormalizedHealth;
+    Pending.bBossHealthDirty = true;
 }
 
 void UHUDSubsystem::HandleBossPhaseChanged(int32 PhaseIndex, const FBossPhaseDefinition& PhaseDefinition)
 {
-    // TODO: Handle boss phase changed event
+    if (Pending.bBossPhaseDirty)
+    {
+        INC_DWORD_STAT(STAT_VazioHUDCoalesced);
+    }
+    Pending.BossPhaseIndex = PhaseIndex;
+    Pending.bBossPhaseDirty = true;
 }
 
 void UHUDSubsystem::HandleBossWarning(const FBossSpawnEntry& Entry)
 {
-    // TODO: Handle boss warning event
-}
+    if (!HUDWidget.IsValid())
+    {
+        return;
+    }
 
-void UHUDSubsystem::HandleBossTelegraph(const FBossAttackPattern& Pattern)
-{
-    // TODO: Handle boss telegraph event
+    const FText Warning = Entry.Announcement.IsEmpty()
+        ? FText::Format(NSLOCTEXT("BossHealth", "BossIncoming", "{0} approaches"), FText::FromName(Entry.BossType))
+        : Entry.Announcement;
+    HUDWidget->ShowBossWarning(Warning);
 }
@@ -19,36 +19,40 @@ void SBossHealthBar::Construct(const FArguments& InArgs)
         .BorderBackgroundColor(FLinearColor(0.f, 0.f, 0.f, 0.55f))
         .VAlign(VAlign_Center)
         .HAlign(HAlign_Fill)
-        .Visibility(this, &SBossHealthBar::GetWidgetVisibility)
         [
             SNew(SVerticalBox)
             + SVerticalBox::Slot()
             .AutoHeight()
             [
-                SAssignNew(NameLabel, STextBlock)
-                .Font(FCoreStyle::GetDefaultFontStyle("Bold", 20))
-                .ColorAndOpacity(FLinearColor::White)
-                .Text(CachedBossName)
-                .Justification(ETextJustify::Center)
-            ]
+                SAssignNew(BossInfo, SVerticalBox)
+                + SVerticalBox::Slot()
+                .AutoHeight()
+                [
+                    SAssignNew(NameLabel, STextBlock)
+                    .Font(FCoreStyle::GetDefaultFontStyle("Bold", 20))
+                    .ColorAndOpacity(FLinearColor::White)
+                    .Text(CachedBossName)
+                    .Justification(ETextJustify::Center)
+                ]
 
-            + SVerticalBox::Slot()
-            .AutoHeight()
-            .Padding(0.f, 6.f, 0.f, 0.f)
-            [
-                SAssignNew(HealthProgress, SProgressBar)
-                .Percent(HealthPercent)
-            ]
+                + SVerticalBox::Slot()
+                .AutoHeight()
+                .Padding(0.f, 6.f, 0.f, 0.f)
+                [
+                    SAssignNew(HealthProgress, SProgressBar)
+                    .Percent(HealthPercent)
+                ]
 
-            + SVerticalBox::Slot()
-            .AutoHeight()
-            .Padding(0.f, 4.f, 0.f, 0.f)
-            [
-                SAssignNew(PhaseLabel, STextBlock)
-                .Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
-                .ColorAndOpacity(FLinearColor::Gray)
-                .Text(CachedPhaseLabel)
-                .Justification(ETextJustify::Center)
+                + SVerticalBox::Slot()
+                .AutoHeight()
+                .Padding(0.f, 4.f, 0.f, 0.f)
+                [
+                    SAssignNew(PhaseLabel, STextBlock)
+                    .Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
+                    .ColorAndOpacity(FLinearColor::Gray)
+                    .Text(CachedPhaseLabel)
+                    .Justification(ETextJustify::Center)
+                ]
             ]
 
             + SVerticalBox::Slot()
@@ -64,6 +68,8 @@ void SBossHealthBar::Construct(const FArguments& InArgs)
             ]
         ]
     ];
+
+    RefreshVisibility();
 }
 
 void SBossHealthBar::UpdateBossInfo(const FText& BossName, float HealthFraction, int32 PhaseIndex, int32 PhaseCount)
@@ -80,7 +86,13 @@ void SBossHealthBar::UpdateBossInfo(const FText& BossName, float HealthFraction,
 
 void SBossHealthBar::UpdateHealth(float HealthFraction)
 {
-    HealthPercent = FMath::Clamp(HealthFraction, 0.f, 1.f);
+    const float NewPercent = FMath::Clamp(HealthFraction, 0.f, 1.f);
+    if (NewPercent == HealthPercent)
+    {
+        return;
+    }
+
+    HealthPercent = NewPercent;
     if (HealthProgress.IsValid())
     {
         HealthProgress->SetPercent(HealthPercent);
@@ -103,16 +115,28 @@ void SBossHealthBar::SetWarning(const FText& WarningText)
     {
         WarningLabel->SetText(CachedWarningText);
     }
+    RefreshVisibility();
 }
 
 void SBossHealthBar::SetBossVisible(bool bVisibleIn)
 {
     bVisible = bVisibleIn;
+    RefreshVisibility();
 }
 
-EVisibility SBossHealthBar::GetWidgetVisibility() const
+void SBossHealthBar::RefreshVisibility()
 {
-    return bVisible ? EVisibility::Visible : EVisibility::Collapsed;
+    // Visibilidade fixa em vez de atributo: só invalida quando o boss/aviso entra ou sai
+    const bool bHasWarning = !CachedWarningText.IsEmpty();
+    if (BossInfo.IsValid())
+    {
+        BossInfo->SetVisibility(bVisible ? EVisibility::Visible : EVisibility::Collapsed);
+    }
+    if (WarningLabel.IsValid())
+    {
+        WarningLabel->SetVisibility(bHasWarning ? EVisibility::Visible : EVisibility::Collapsed);
+    }
+    SetVisibility(bVisible || bHasWarning ? EVisibility::Visible : EVisibility::Collapsed);
 }
 
 FText SBossHealthBar::BuildPhaseLabel(int32 PhaseIndex, int32 PhaseCount) const
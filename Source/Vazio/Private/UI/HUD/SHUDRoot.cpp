@@ -3,51 +3,67 @@
 #include "UI/HUD/SXPBar.h"
 #include "UI/HUD/SLevelText.h"
 #include "UI/HUD/SBossHealthBar.h"
+#include "UI/HUD/SPerfOverlay.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/SOverlay.h"
+#include "Slate/SInvalidationPanel.h"
 #include "Framework/Application/SlateApplication.h"
 
 void SHUDRoot::Construct(const FArguments& InArgs)
 {
+    // HUD inteiro em cache: sem bindings por paint, só repinta o widget cujo valor mudou (Set* invalida)
     ChildSlot
     [
-        SNew(SOverlay)
-
-        // Top-left corner: Health Bar
-        + SOverlay::Slot()
-        .HAlign(HAlign_Left)
-        .VAlign(VAlign_Top)
-        .Padding(20.0f)
+        SNew(SInvalidationPanel)
+        .DebugName(TEXT("VazioHUD"))
         [
-            SAssignNew(HealthBar, SHealthBar)
-        ]
+            SNew(SOverlay)
 
-        // Top-center: Boss health bar
-        + SOverlay::Slot()
-        .HAlign(HAlign_Center)
-        .VAlign(VAlign_Top)
-        .Padding(0.0f, 10.0f, 0.0f, 0.0f)
-        [
-            SAssignNew(BossHealthBar, SBossHealthBar)
-        ]
+            // Top-left corner: Health Bar
+            + SOverlay::Slot()
+            .HAlign(HAlign_Left)
+            .VAlign(VAlign_Top)
+            .Padding(20.0f)
+            [
+                SAssignNew(HealthBar, SHealthBar)
+            ]
 
-        // Slightly below boss bar: Level Display
-        + SOverlay::Slot()
-        .HAlign(HAlign_Center)
-        .VAlign(VAlign_Top)
-        .Padding(0.0f, 80.0f, 0.0f, 0.0f)
-        [
-            SAssignNew(LevelText, SLevelText)
-        ]
+            // Top-center: Boss health bar
+            + SOverlay::Slot()
+            .HAlign(HAlign_Center)
+            .VAlign(VAlign_Top)
+            .Padding(0.0f, 10.0f, 0.0f, 0.0f)
+            [
+                SAssignNew(BossHealthBar, SBossHealthBar)
+            ]
 
-        // Bottom-center: XP Bar
-        + SOverlay::Slot()
-        .HAlign(HAlign_Center)
-        .VAlign(VAlign_Bottom)
-        .Padding(0.0f, 0.0f, 0.0f, 50.0f)
-        [
-            SAssignNew(XPBar, SXPBar)
+            // Slightly below boss bar: Level Display
+            + SOverlay::Slot()
+            .HAlign(HAlign_Center)
+            .VAlign(VAlign_Top)
+            .Padding(0.0f, 80.0f, 0.0f, 0.0f)
+            [
+                SAssignNew(LevelText, SLevelText)
+            ]
+
+            // Bottom-center: XP Bar
+            + SOverlay::Slot()
+            .HAlign(HAlign_Center)
+            .VAlign(VAlign_Bottom)
+            .Padding(0.0f, 0.0f, 0.0f, 50.0f)
+            [
+                SAssignNew(XPBar, SXPBar)
+            ]
+
+            // Top-right: overlay de performance (Vazio.PerfOverlay 1)
+            + SOverlay::Slot()
+            .HAlign(HAlign_Right)
+            .VAlign(VAlign_Top)
+            .Padding(0.0f, 20.0f, 20.0f, 0.0f)
+            [
+                SAssignNew(PerfOverlay, SPerfOverlay)
+            ]
         ]
     ];
 
@@ -37,8 +37,6 @@ void SHealthBar::Construct(const FArguments& InArgs)
                 + SOverlay::Slot()
                 [
                     SAssignNew(HealthProgressBar, SProgressBar)
-                    .Percent(this, &SHealthBar::GetHealthPercent)
-                    .FillColorAndOpacity(this, &SHealthBar::GetHealthColor)
                 ]
                 
                 // Health Text
@@ -47,7 +45,6 @@ void SHealthBar::Construct(const FArguments& InArgs)
                 .VAlign(VAlign_Center)
                 [
                     SAssignNew(HealthText, STextBlock)
-                    .Text(this, &SHealthBar::GetHealthText)
                     .Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
                     .ColorAndOpacity(FLinearColor::White)
                     .ShadowOffset(FVector2D(1.0f, 1.0f))
@@ -56,55 +53,60 @@ void SHealthBar::Construct(const FArguments& InArgs)
             ]
         ]
     ];
+
+    UpdateVisuals();
 }
 
 void SHealthBar::UpdateHealth(float NewCurrentHealth, float NewMaxHealth)
 {
+    if (NewCurrentHealth == CurrentHealth && NewMaxHealth == MaxHealth && DisplayedCurrent != INDEX_NONE)
+    {
+        return;
+    }
+
     CurrentHealth = NewCurrentHealth;
     MaxHealth = NewMaxHealth;
-    
-    // Force refresh of the widget
+    UpdateVisuals();
+}
+
+void SHealthBar::UpdateVisuals()
+{
+    const float HealthPercent = (MaxHealth > 0.0f) ? (CurrentHealth / MaxHealth) : 0.0f;
+
     if (HealthProgressBar.IsValid())
     {
-        HealthProgressBar->Invalidate(EInvalidateWidgetReason::Layout);
-    }
-    if (HealthText.IsValid())
-    {
-        HealthText->Invalidate(EInvalidateWidgetReason::Layout);
+        HealthProgressBar->SetPercent(HealthPercent);
+
+        const int32 Tier = HealthPercent > 0.6f ? 2 : (HealthPercent > 0.3f ? 1 : 0);
+        if (Tier != DisplayedColorTier)
+        {
+            DisplayedColorTier = Tier;
+            HealthProgressBar->SetFillColorAndOpacity(GetTierColor(Tier));
+        }
     }
-}
 
-TOptional<float> SHealthBar::GetHealthPercent() const
-{
-    if (MaxHealth > 0.0f)
+    const int32 RoundedCurrent = FMath::RoundToInt(CurrentHealth);
+    const int32 RoundedMax = FMath::RoundToInt(MaxHealth);
+    if (HealthText.IsValid() && (RoundedCurrent != DisplayedCurrent || RoundedMax != DisplayedMax))
     {
-        return CurrentHealth / MaxHealth;
+        DisplayedCurrent = RoundedCurrent;
+        DisplayedMax = RoundedMax;
+        HealthText->SetText(FText::FromString(FString::Printf(TEXT("%d / %d"), RoundedCurrent, RoundedMax)));
     }
-    return 0.0f;
 }
 
-FSlateColor SHealthBar::GetHealthColor() const
+FLinearColor SHealthBar::GetTierColor(int32 Tier)
 {
-    float HealthPercent = (MaxHealth > 0.0f) ? (CurrentHealth / MaxHealth) : 0.0f;
-    
-    if (HealthPercent > 0.6f)
+    switch (Tier)
     {
+    case 2:
         // Green when healthy
         return FLinearColor(0.0f, 0.8f, 0.0f, 1.0f);
-    }
-    else if (HealthPercent > 0.3f)
-    {
+    case 1:
         // Yellow when damaged
         return FLinearColor(1.0f, 1.0f, 0.0f, 1.0f);
-    }
-    else
-    {
+    default:
         // Red when critical
         return FLinearColor(1.0f, 0.0f, 0.0f, 1.0f);
     }
 }
-
-FText SHealthBar::GetHealthText() const
-{
-    return FText::FromString(FString::Printf(TEXT("%.0f / %.0f"), CurrentHealth, MaxHealth));
-}
@@ -23,7 +23,7 @@ void SLevelText::Construct(const FArguments& InArgs)
             .VAlign(VAlign_Center)
             [
                 SAssignNew(LevelTextBlock, STextBlock)
-                .Text(this, &SLevelText::GetLevelText)
+                .Text(FText::FromString(FString::Printf(TEXT("LVL %d"), CurrentLevel)))
                 .Font(FCoreStyle::GetDefaultFontStyle("Bold", 18))
                 .ColorAndOpacity(FLinearColor(1.0f, 0.8f, 0.0f, 1.0f)) // Golden color
                 .ShadowOffset(FVector2D(2.0f, 2.0f))
@@ -36,16 +36,14 @@ void SLevelText::Construct(const FArguments& InArgs)
 
 void SLevelText::UpdateLevel(int32 NewLevel)
 {
+    if (NewLevel == CurrentLevel)
+    {
+        return;
+    }
+
     CurrentLevel = NewLevel;
-    
-    // Force refresh of the widget
     if (LevelTextBlock.IsValid())
     {
-        LevelTextBlock->Invalidate(EInvalidateWidgetReason::Layout);
+        LevelTextBlock->SetText(FText::FromString(FString::Printf(TEXT("LVL %d"), CurrentLevel)));
     }
 }
-
-FText SLevelText::GetLevelText() const
-{
-    return FText::FromString(FString::Printf(TEXT("LVL %d"), CurrentLevel));
-}
@@ -0,0 +1,309 @@
+#include "UI/HUD/SPerfOverlay.h"
+#include "Core/VazioStats.h"
+#include "Enemy/BossProjectileSubsystem.h"
+#include "Enemy/EnemyBase.h"
+#include "Enemy/EnemyPoolSubsystem.h"
+#include "Enemy/EnemySimSubsystem.h"
+#include "Enemy/EnemySpawnerSubsystem.h"
+#include "World/Common/Collectables/XPOrb.h"
+#include "World/Common/Projectiles/RangedProjectile.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Rendering/DrawElements.h"
+#include "Slate/SInvalidationPanel.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/Text/STextBlock.h"
+
+static int32 GPerfOverlayEnabled = 0;
+static FAutoConsoleVariableRef CVarPerfOverlay(
+    TEXT("Vazio.PerfOverlay"),
+    GPerfOverlayEnabled,
+    TEXT("Mostra o overlay de performance da horda no HUD (0/1)"),
+    ECVF_Default
+);
+
+static float GPerfOverlayHz = 4.f;
+static FAutoConsoleVariableRef CVarPerfOverlayHz(
+    TEXT("Vazio.PerfOverlay.Hz"),
+    GPerfOverlayHz,
+    TEXT("Frequência de atualização do texto do overlay de performance"),
+    ECVF_Default
+);
+
+// Linhas de custo por sistema mostradas (maiores primeiro)
+static constexpr int32 PerfOverlayMaxStatLines = 8;
+
+/** Gráfico de frame time: ring buffer pintado com uma polyline, repintado só quando o overlay atualiza. */
+class SFrameTimeGraph : public SLeafWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SFrameTimeGraph) {}
+    SLATE_END_ARGS()
+
+    static constexpr int32 NumSamples = 240;
+    static constexpr float MaxMs = 50.f;
+
+    void Construct(const FArguments& InArgs)
+    {
+        Samples.SetNumZeroed(NumSamples);
+    }
+
+    void AddSample(float FrameMs)
+    {
+        Samples[Head] = FrameMs;
+        Head = (Head + 1) % NumSamples;
+    }
+
+    virtual FVector2D ComputeDesiredSize(float) const override
+    {
+        return FVector2D(NumSamples, 60.f);
+    }
+
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+                          FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+    {
+        const FVector2D Size = AllottedGeometry.GetLocalSize();
+        const float XStep = Size.X / (NumSamples - 1);
+        auto ToY = [&Size](float Ms) { return Size.Y * (1.f - FMath::Clamp(Ms / MaxMs, 0.f, 1.f)); };
+
+        // Referências de 60 e 30 fps
+        for (const float Budget : { 1000.f / 60.f, 1000.f / 30.f })
+        {
+            TArray<FVector2D> Line = { FVector2D(0.f, ToY(Budget)), FVector2D(Size.X, ToY(Budget)) };
+            FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Line,
+                                         ESlateDrawEffect::None, FLinearColor(1.f, 1.f, 1.f, 0.25f), false, 1.f);
+        }
+
+        TArray<FVector2D> Points;
+        Points.Reserve(NumSamples);
+        for (int32 i = 0; i < NumSamples; ++i)
+        {
+            Points.Add(FVector2D(i * XStep, ToY(Samples[(Head + i) % NumSamples])));
+        }
+        FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(), Points,
+                                     ESlateDrawEffect::None, FLinearColor(0.2f, 1.f, 0.3f, 1.f), true, 1.f);
+        return LayerId + 1;
+    }
+
+private:
+    TArray<float> Samples;
+    int32 Head = 0;
+};
+
+SPerfOverlay::~SPerfOverlay()
+{
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+}
+
+void SPerfOverlay::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SInvalidationPanel)
+        [
+            SNew(SBorder)
+            .BorderImage(FCoreStyle::Get().GetBrush("GenericWhiteBox"))
+            .BorderBackgroundColor(FLinearColor(0.f, 0.f, 0.f, 0.6f))
+            .Padding(FMargin(8.f))
+            [
+                SNew(SVerticalBox)
+
+                + SVerticalBox::Slot()
+                .AutoHeight()
+                [
+                    SAssignNew(Text, STextBlock)
+                    .Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
+                    .ColorAndOpacity(FLinearColor::White)
+                ]
+
+                + SVerticalBox::Slot()
+                .AutoHeight()
+                .Padding(0.f, 6.f, 0.f, 0.f)
+                [
+                    SAssignNew(Graph, SFrameTimeGraph)
+                ]
+            ]
+        ]
+    ];
+
+    SetVisibility(EVisibility::Collapsed);
+    RegisterRefreshTimer();
+}
+
+void SPerfOverlay::RegisterRefreshTimer()
+{
+    RefreshHz = FMath::Max(0.5f, GPerfOverlayHz);
+    RegisterActiveTimer(1.f / RefreshHz, FWidgetActiveTimerDelegate::CreateSP(this, &SPerfOverlay::Refresh));
+}
+
+void SPerfOverlay::SetOverlayEnabled(bool bInEnabled)
+{
+    if (bEnabled == bInEnabled)
+    {
+        return;
+    }
+
+    bEnabled = bInEnabled;
+    SetVisibility(bEnabled ? EVisibility::HitTestInvisible : EVisibility::Collapsed);
+
+    // O registro por frame só existe com o overlay visível
+    if (bEnabled)
+    {
+        LastFrameSeconds = FPlatformTime::Seconds();
+        EndFrameHandle = FCoreDelegates::OnEndFrame.AddSP(this, &SPerfOverlay::HandleEndFrame);
+    }
+    else
+    {
+        FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+        EndFrameHandle.Reset();
+    }
+}
+
+void SPerfOverlay::HandleEndFrame()
+{
+    const double Now = FPlatformTime::Seconds();
+    const float FrameMs = static_cast<float>((Now - LastFrameSeconds) * 1000.0);
+    LastFrameSeconds = Now;
+
+    ++WindowFrames;
+    WindowFrameMsSum += FrameMs;
+    WindowFrameMsMax = FMath::Max(WindowFrameMsMax, FrameMs);
+    if (Graph.IsValid())
+    {
+        Graph->AddSample(FrameMs);
+    }
+}
+
+EActiveTimerReturnType SPerfOverlay::Refresh(double InCurrentTime, float InDeltaTime)
+{
+    // Período do active timer é fixo no registro: troca de Hz em runtime reinicia o timer
+    if (FMath::Max(0.5f, GPerfOverlayHz) != RefreshHz)
+    {
+        RegisterRefreshTimer();
+        return EActiveTimerReturnType::Stop;
+    }
+
+    SetOverlayEnabled(GPerfOverlayEnabled != 0);
+    if (!bEnabled)
+    {
+        return EActiveTimerReturnType::Continue;
+    }
+
+    UWorld* World = GEngine && GEngine->GameViewport ? GEngine->GameViewport->GetWorld() : nullptr;
+    if (Text.IsValid())
+    {
+        Text->SetText(FText::FromString(BuildText(World)));
+    }
+    if (Graph.IsValid())
+    {
+        Graph->Invalidate(EInvalidateWidgetReason::Paint);
+    }
+
+    WindowFrames = 0;
+    WindowFrameMsSum = 0.f;
+    WindowFrameMsMax = 0.f;
+    return EActiveTimerReturnType::Continue;
+}
+
+FString SPerfOverlay::BuildText(UWorld* World)
+{
+    const float AvgMs = WindowFrames > 0 ? WindowFrameMsSum / WindowFrames : 0.f;
+    FString Out = FString::Printf(TEXT("Frame %5.1fms (max %5.1f)  Game %5.1fms  %3.0f fps\n"),
+        AvgMs, WindowFrameMsMax, FPlatformTime::ToMilliseconds(GGameThreadTime), AvgMs > 0.f ? 1000.f / AvgMs : 0.f);
+
+    if (!World)
+    {
+        return Out;
+    }
+
+    // Inimigos por arquétipo e faixa de distância (mesmas faixas do agendador de decisões)
+    static const IConsoleVariable* NearCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Enemy.AI.NearDistance"));
+    static const IConsoleVariable* FarCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Enemy.AI.FarDistance"));
+    const float NearDistance = NearCVar ? NearCVar->GetFloat() : 1200.f;
+    const float FarDistance = FarCVar ? FarCVar->GetFloat() : 4000.f;
+
+    int32 Live = 0;
+    int32 Tiers[3] = { 0, 0, 0 };
+    TMap<FName, int32> PerClass;
+    if (const UEnemySimSubsystem* Sim = World->GetSubsystem<UEnemySimSubsystem>())
+    {
+        for (const TObjectPtr<AEnemyBase>& Enemy : Sim->GetEnemies())
+        {
+            if (!Enemy || Enemy->IsHidden())
+            {
+                continue;
+            }
+            ++Live;
+            ++PerClass.FindOrAdd(Enemy->GetClass()->GetFName());
+            if (const FEnemySimOutput* SimOut = Sim->GetOutput(Enemy))
+            {
+                ++Tiers[SimOut->DistanceToPlayer < NearDistance ? 0 : (SimOut->DistanceToPlayer < FarDistance ? 1 : 2)];
+            }
+        }
+    }
+    PerClass.ValueSort(TGreater<int32>());
+
+    Out += FString::Printf(TEXT("Enemies %d  near %d / mid %d / far %d\n"), Live, Tiers[0], Tiers[1], Tiers[2]);
+    for (const TPair<FName, int32>& Pair : PerClass)
+    {
+        Out += FString::Printf(TEXT("  %-18s %d\n"), *Pair.Key.ToString(), Pair.Value);
+    }
+
+    if (const UEnemyPoolSubsystem* Pool = World->GetSubsystem<UEnemyPoolSubsystem>())
+    {
+        Out += FString::Printf(TEXT("Pool active %d  pooled %d  peak %d\n"), Pool->GetNumActive(), Pool->GetNumPooled(), Pool->GetActiveHighWater());
+    }
+
+    int32 Orbs = 0;
+    for (TActorIterator<AXPOrb> It(World); It; ++It)
+    {
+        ++Orbs;
+    }
+    int32 Projectiles = 0;
+    for (TActorIterator<ARangedProjectile> It(World); It; ++It)
+    {
+        ++Projectiles;
+    }
+    Out += FString::Printf(TEXT("Orbs %d  Projectiles %d"), Orbs, Projectiles);
+    if (const UBossProjectileSubsystem* Bullets = World->GetSubsystem<UBossProjectileSubsystem>())
+    {
+        Out += FString::Printf(TEXT("  Boss bullets %d"), Bullets->GetNumLive());
+    }
+
+    if (const UEnemySpawnerSubsystem* Spawner = World->GetSubsystem<UEnemySpawnerSubsystem>())
+    {
+        Out += FString::Printf(TEXT("  Spawn queue %d (+%d events held)"), Spawner->GetNumPendingDeferredSpawns(), Spawner->GetNumDeferredEvents());
+        if (Spawner->GetNumLiveBossMinions() > 0 || Spawner->GetNumDeniedBossMinions() > 0)
+        {
+            Out += FString::Printf(TEXT("\nBoss minions %d (over budget %d)"), Spawner->GetNumLiveBossMinions(), Spawner->GetNumDeniedBossMinions());
+        }
+    }
+    Out += TEXT("\n");
+
+    TArray<FVazioStatTime> Times;
+    GetVazioStatTimes(Times);
+#if STATS
+    // Liga a coleta do grupo sem desenhar o "stat Vazio" por cima do overlay
+    if (Times.Num() == 0 && !bRequestedStats && GEngine)
+    {
+        bRequestedStats = true;
+        GEngine->Exec(World, TEXT("stat Vazio -nodisplay"));
+    }
+#endif
+    Times.Sort([](const FVazioStatTime& A, const FVazioStatTime& B) { return A.Milliseconds > B.Milliseconds; });
+    for (int32 i = 0; i < FMath::Min(Times.Num(), PerfOverlayMaxStatLines); ++i)
+    {
+        Out += FString::Printf(TEXT("  %-26s %6.2fms\n"), *Times[i].Description, Times[i].Milliseconds);
+    }
+
+    Out.RemoveFromEnd(TEXT("\n"));
+    return Out;
+}
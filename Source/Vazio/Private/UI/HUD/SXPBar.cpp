@@ -37,7 +37,6 @@ void SXPBar::Construct(const FArguments& InArgs)
                 + SOverlay::Slot()
                 [
                     SAssignNew(XPProgressBar, SProgressBar)
-                    .Percent(this, &SXPBar::GetXPPercent)
                     .FillColorAndOpacity(FLinearColor(0.0f, 0.6f, 1.0f, 1.0f)) // Blue XP bar
                 ]
                 
@@ -47,7 +46,6 @@ void SXPBar::Construct(const FArguments& InArgs)
                 .VAlign(VAlign_Center)
                 [
                     SAssignNew(XPText, STextBlock)
-                    .Text(this, &SXPBar::GetXPText)
                     .Font(FCoreStyle::GetDefaultFontStyle("Regular", 12))
                     .ColorAndOpacity(FLinearColor::White)
                     .ShadowOffset(FVector2D(1.0f, 1.0f))
@@ -56,34 +54,31 @@ void SXPBar::Construct(const FArguments& InArgs)
             ]
         ]
     ];
+
+    UpdateVisuals();
 }
 
 void SXPBar::UpdateXP(int32 NewCurrentXP, int32 NewXPToNextLevel)
 {
+    if (NewCurrentXP == CurrentXP && NewXPToNextLevel == XPToNextLevel)
+    {
+        return;
+    }
+
     CurrentXP = NewCurrentXP;
     XPToNextLevel = NewXPToNextLevel;
-    
-    // Force refresh of the widget
+    UpdateVisuals();
+}
+
+void SXPBar::UpdateVisuals()
+{
+    // Valores estáticos nos widgets: sem bindings avaliados a cada paint, o texto é formatado só aqui
     if (XPProgressBar.IsValid())
     {
-        XPProgressBar->Invalidate(EInvalidateWidgetReason::Layout);
+        XPProgressBar->SetPercent(XPToNextLevel > 0 ? static_cast<float>(CurrentXP) / static_cast<float>(XPToNextLevel) : 0.f);
     }
     if (XPText.IsValid())
     {
-        XPText->Invalidate(EInvalidateWidgetReason::Layout);
+        XPText->SetText(FText::FromString(FString::Printf(TEXT("XP: %d / %d"), CurrentXP, XPToNextLevel)));
     }
 }
-
-TOptional<float> SXPBar::GetXPPercent() const
-{
-    if (XPToNextLevel > 0)
-    {
-        return static_cast<float>(CurrentXP) / static_cast<float>(XPToNextLevel);
-    }
-    return 0.0f;
-}
-
-FText SXPBar::GetXPText() const
-{
-    return FText::FromString(FString::Printf(TEXT("XP: %d / %d"), CurrentXP, XPToNextLevel));
-}
@@ -48,7 +48,7 @@ void SLevelUpModal::Construct(const FArguments& InArgs)
             .HAlign(HAlign_Center)
             .Padding(0, 0, 0, 40)
             [
-                SNew(STextBlock)
+                SAssignNew(SubtitleText, STextBlock)
                 .Text(FText::FromString(TEXT("Escolha um upgrade")))
                 .Font(FCoreStyle::GetDefaultFontStyle("Regular", 18))
                 .ColorAndOpacity(FLinearColor::White)
@@ -65,34 +65,56 @@ void SLevelUpModal::Construct(const FArguments& InArgs)
         ]
     ];
 
+    for (int32 i = 0; i < InArgs._NumCards; ++i)
+    {
+        AddCard();
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("LevelUp:UI:SlateModalConstructed"));
 }
 
+void SLevelUpModal::AddCard()
+{
+    TSharedPtr<SUpgradeCard> Card = SNew(SUpgradeCard)
+        .CardIndex(UpgradeCards.Num());
+
+    Card->OnCardClicked.BindSP(this, &SLevelUpModal::OnCardClicked);
+    Card->SetVisibility(EVisibility::Collapsed);
+    UpgradeCards.Add(Card);
+
+    CardsContainer->AddSlot()
+    .AutoWidth()
+    .Padding(20, 0)
+    [
+        Card.ToSharedRef()
+    ];
+}
+
 void SLevelUpModal::SetupUpgrades(const TArray<FUpgradeData>& Upgrades)
 {
     CurrentUpgrades = Upgrades;
-    UpgradeCards.Empty();
-    CardsContainer->ClearChildren();
-
-    for (int32 i = 0; i < Upgrades.Num(); i++)
+    while (UpgradeCards.Num() < Upgrades.Num())
     {
-        TSharedPtr<SUpgradeCard> Card = SNew(SUpgradeCard)
-            .Upgrade(Upgrades[i])
-            .CardIndex(i);
-
-        Card->OnCardClicked.BindSP(this, &SLevelUpModal::OnCardClicked);
-        UpgradeCards.Add(Card);
+        AddCard();
+    }
 
-        CardsContainer->AddSlot()
-        .AutoWidth()
-        .Padding(20, 0)
-        [
-            Card.ToSharedRef()
-        ];
+    NumActiveCards = Upgrades.Num();
+    for (int32 i = 0; i < UpgradeCards.Num(); i++)
+    {
+        if (i < NumActiveCards)
+        {
+            UpgradeCards[i]->SetUpgrade(Upgrades[i], i);
+            UpgradeCards[i]->SetVisibility(EVisibility::Visible);
+        }
+        else
+        {
+            UpgradeCards[i]->SetVisibility(EVisibility::Collapsed);
+        }
     }
 
     // Select first card by default
-    if (UpgradeCards.Num() > 0)
+    SelectedIndex = INDEX_NONE;
+    if (NumActiveCards > 0)
     {
         SelectCard(0);
     }
@@ -100,15 +122,28 @@ void SLevelUpModal::SetupUpgrades(const TArray<FUpgradeData>& Upgrades)
     UE_LOG(LogTemp, Warning, TEXT("LevelUp:UI:CardsSetup Count=%d"), Upgrades.Num());
 }
 
+void SLevelUpModal::SetRemainingChoices(int32 Remaining)
+{
+    if (Remaining == RemainingChoices || !SubtitleText.IsValid())
+    {
+        return;
+    }
+
+    RemainingChoices = Remaining;
+    SubtitleText->SetText(Remaining > 0
+        ? FText::FromString(FString::Printf(TEXT("Escolha um upgrade (+%d)"), Remaining))
+        : FText::FromString(TEXT("Escolha um upgrade")));
+}
+
 void SLevelUpModal::SelectCard(int32 Index)
 {
-    if (Index < 0 || Index >= UpgradeCards.Num())
+    if (Index < 0 || Index >= NumActiveCards)
     {
         return;
     }
 
     // Deselect previous
-    if (SelectedIndex >= 0 && SelectedIndex < UpgradeCards.Num())
+    if (SelectedIndex >= 0 && SelectedIndex < NumActiveCards)
     {
         UpgradeCards[SelectedIndex]->SetSelected(false);
     }
@@ -143,15 +178,19 @@ void SLevelUpModal::OnCardClicked(int32 CardIndex)
 FReply SLevelUpModal::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
 {
     FKey Key = InKeyEvent.GetKey();
+    if (NumActiveCards == 0)
+    {
+        return FReply::Unhandled();
+    }
 
     if (Key == EKeys::Left || Key == EKeys::A)
     {
-        SelectCard((SelectedIndex - 1 + UpgradeCards.Num()) % UpgradeCards.Num());
+        SelectCard((SelectedIndex - 1 + NumActiveCards) % NumActiveCards);
         return FReply::Handled();
     }
     else if (Key == EKeys::Right || Key == EKeys::D)
     {
-        SelectCard((SelectedIndex + 1) % UpgradeCards.Num());
+        SelectCard((SelectedIndex + 1) % NumActiveCards);
         return FReply::Handled();
     }
     else if (Key == EKeys::Enter || Key == EKeys::SpaceBar)
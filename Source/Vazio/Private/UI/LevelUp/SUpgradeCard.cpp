@@ -71,6 +71,27 @@ void SUpgradeCard::Construct(const FArguments& InArgs)
     UpdateVisualState();
 }
 
+void SUpgradeCard::SetUpgrade(const FUpgradeData& Upgrade, int32 InCardIndex)
+{
+    CardUpgrade = Upgrade;
+    CardIndex = InCardIndex;
+    bIsSelected = false;
+
+    if (IconBorder.IsValid())
+    {
+        IconBorder->SetBorderBackgroundColor(CardUpgrade.IconColor);
+    }
+    if (TitleText.IsValid())
+    {
+        TitleText->SetText(CardUpgrade.DisplayName);
+    }
+    if (DescriptionText.IsValid())
+    {
+        DescriptionText->SetText(CardUpgrade.Description);
+    }
+    UpdateVisualState();
+}
+
 void SUpgradeCard::SetSelected(bool bSelected)
 {
     bIsSelected = bSelected;
@@ -1,4 +1,5 @@
 #include "UI/Widgets/SPauseMenuSlate.h"
+#include "Core/WorldFreezeSubsystem.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SConstraintCanvas.h"
@@ -6,7 +7,6 @@
 #include "Widgets/Text/STextBlock.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Engine/World.h"
-#include "GameFramework/GameModeBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
 
@@ -140,9 +140,9 @@ FReply SPauseMenuSlate::OnExitClicked()
     if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull) : nullptr)
     {
         // First unpause
-        if (AGameModeBase* GameMode = World->GetAuthGameMode())
+        if (UWorldFreezeSubsystem* Freeze = World->GetSubsystem<UWorldFreezeSubsystem>())
         {
-            GameMode->ClearPause();
+            Freeze->ThawAll();
         }
 
         // Then quit to main menu
@@ -176,9 +176,9 @@ void SPauseMenuSlate::ShowPauseMenu(UWorld* World)
     }
 
     // Pause the game
-    if (AGameModeBase* GameMode = World->GetAuthGameMode())
+    if (UWorldFreezeSubsystem* Freeze = World->GetSubsystem<UWorldFreezeSubsystem>())
     {
-        GameMode->SetPause(PC);
+        Freeze->Freeze(EWorldFreezeReason::PauseMenu);
         UE_LOG(LogTemp, Log, TEXT("[SPauseMenuSlate] Game paused"));
     }
 
@@ -238,10 +238,15 @@ void SPauseMenuSlate::HidePauseMenu(UWorld* World)
         return;
     }
 
-    // Unpause the game
-    if (AGameModeBase* GameMode = World->GetAuthGameMode())
+    // Unpause the game (só volta de fato se nada mais segura o mundo, ex. modal de level-up)
+    if (UWorldFreezeSubsystem* Freeze = World->GetSubsystem<UWorldFreezeSubsystem>())
     {
-        GameMode->ClearPause();
+        Freeze->Thaw(EWorldFreezeReason::PauseMenu);
+        if (Freeze->IsFrozen())
+        {
+            UE_LOG(LogTemp, Log, TEXT("[SPauseMenuSlate] Pause menu closed, world still frozen"));
+            return;
+        }
         UE_LOG(LogTemp, Log, TEXT("[SPauseMenuSlate] Game unpaused"));
     }
 
@@ -1,8 +1,8 @@
 #include "UI/Widgets/UMGPauseMenuWidget.h"
+#include "Core/WorldFreezeSubsystem.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
 #include "Engine/World.h"
-#include "GameFramework/GameModeBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
 #include "Framework/Application/SlateApplication.h"
@@ -90,9 +90,9 @@ void UUMGPauseMenuWidget::OnExitClicked()
     if (UWorld* World = GetWorld())
     {
         // First unpause
-        if (AGameModeBase* GameMode = World->GetAuthGameMode())
+        if (UWorldFreezeSubsystem* Freeze = World->GetSubsystem<UWorldFreezeSubsystem>())
         {
-            GameMode->ClearPause();
+            Freeze->ThawAll();
         }
 
         // Then quit to main menu or exit
@@ -124,9 +124,9 @@ void UUMGPauseMenuWidget::ShowPauseMenu(UWorld* World)
     }
 
     // Pause the game
-    if (AGameModeBase* GameMode = World->GetAuthGameMode())
+    if (UWorldFreezeSubsystem* Freeze = World->GetSubsystem<UWorldFreezeSubsystem>())
     {
-        GameMode->SetPause(PC);
+        Freeze->Freeze(EWorldFreezeReason::PauseMenu);
         UE_LOG(LogTemp, Log, TEXT("[UMGPauseMenu] Game paused"));
     }
 
@@ -174,10 +174,15 @@ void UUMGPauseMenuWidget::HidePauseMenu(UWorld* World)
         return;
     }
 
-    // Unpause the game
-    if (AGameModeBase* GameMode = World->GetAuthGameMode())
+    // Unpause the game (só volta de fato se nada mais segura o mundo, ex. modal de level-up)
+    if (UWorldFreezeSubsystem* Freeze = World->GetSubsystem<UWorldFreezeSubsystem>())
     {
-        GameMode->ClearPause();
+        Freeze->Thaw(EWorldFreezeReason::PauseMenu);
+        if (Freeze->IsFrozen())
+        {
+            UE_LOG(LogTemp, Log, TEXT("[UMGPauseMenu] Pause menu closed, world still frozen"));
+            return;
+        }
         UE_LOG(LogTemp, Log, TEXT("[UMGPauseMenu] Game unpaused"));
     }
 
@@ -20,6 +20,10 @@
 #include "Enemy/EnemySpawnerSubsystem.h"
 #include "Enemy/EnemyConfig.h"
 #include "Enemy/EnemySpawnHelper.h"
+#include "Enemy/SpawnTimeline.h"
+#include "Testing/HordeBenchmarkSubsystem.h"
+#include "Testing/SoakTestSubsystem.h"
+#include "Testing/BossAutoTestSubsystem.h"
 
 ABattleGameMode::ABattleGameMode()
 {
@@ -64,6 +68,13 @@ void ABattleGameMode::BeginPlay()
 
     // Initialize enemy system
     InitializeEnemySystem();
+
+    // Benchmarks e soak headless controlam os próprios spawns
+    if (UHordeBenchmarkSubsystem::IsBenchmarkCommandLine() || USoakTestSubsystem::IsSoakCommandLine() ||
+        UBossAutoTestSubsystem::IsBossBenchmarkCommandLine())
+    {
+        return;
+    }
     
     // Auto-start the first wave after a small delay to ensure everything is initialized
     FTimerHandle AutoStartTimer;
@@ -242,51 +253,18 @@ void ABattleGameMode::StartDefaultWave()
 
 void ABattleGameMode::StartTestWave()
 {
-    // CORRECT JSON FORMAT for SpawnTimeline system with BOTH regular enemies AND bosses
-    FString TestWaveJSON = TEXT(R"({
-        "spawnEvents": [
-            {
-                "time": 0.0,
-                "spawns": {
-                    "NormalEnemy": {
-                        "count": 3,
-                        "big": false
-                    }
-                }
-            },
-            {
-                "time": 5.0,
-                "spawns": {
-                    "HeavyEnemy": 2,
-                    "RangedEnemy": 2
-                }
-            },
-            {
-                "time": 15.0,
-                "spawns": {
-                    "DashEnemy": 1,
-                    "circle": [
-                        {
-                            "type": "NormalEnemy",
-                            "count": 3,
-                            "radius": 200
-                        }
-                    ]
-                }
-            }
-        ],
-        "bosses": [
-            {
-                "time": 30.0,
-                "bossType": "BurrowerBoss",
-                "warningDuration": 3.0,
-                "announcement": "Test: Burrower Boss spawned!",
-                "pauseRegularSpawns": true,
-                "resumeDelay": 2.0
-            }
-        ]
-    })");
+    // Sem asset configurado: Enemy/TestWave cozida (.vtl); JSON só se o cook estiver velho
+    if (!TestWaveTimeline)
+    {
+        TestWaveTimeline = UEnemySpawnHelper::LoadTimelineFile(TEXT("Enemy/TestWave"));
+    }
+
+    if (!TestWaveTimeline)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[BattleGM] No test wave timeline available"));
+        return;
+    }
 
-    StartEnemyWave(TestWaveJSON, FMath::Rand());
-    UE_LOG(LogTemp, Warning, TEXT("[BattleGM] Started test wave from JSON with bosses"));
+    UEnemySpawnHelper::StartSpawnTimeline(this, TestWaveTimeline, FMath::Rand());
+    UE_LOG(LogTemp, Warning, TEXT("[BattleGM] Started test wave from timeline %s"), *TestWaveTimeline->GetName());
 }
@@ -1,4 +1,5 @@
 #include "World/Common/Collectables/XPOrb.h"
+#include "Core/VazioStats.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -51,6 +52,8 @@ void AXPOrb::BeginPlay() {
 }
 
 void AXPOrb::Tick(float DeltaTime) {
+    SCOPE_CYCLE_COUNTER(STAT_VazioXPOrbTick);
+
     Super::Tick(DeltaTime);
     if (!TargetPlayer) {
         TargetPlayer = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
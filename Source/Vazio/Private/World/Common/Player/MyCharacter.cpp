@@ -1,4 +1,5 @@
 #include "World/Common/Player/MyCharacter.h"
+#include "Core/VazioStats.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Camera/CameraComponent.h"
@@ -17,6 +18,8 @@
 #include "Gameplay/Upgrades/UpgradeSystem.h"
 #include "UI/LevelUp/SLevelUpModal.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Core/GameplayTrace.h"
+#include "Core/WorldFreezeSubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPlayerHealth, Log, All);
 DEFINE_LOG_CATEGORY_STATIC(LogXP, Log, All);
@@ -123,6 +126,8 @@ void AMyCharacter::BeginPlay()
 		XPComponent->OnLevelChanged.AddDynamic(this, &AMyCharacter::OnPlayerLevelUp);
 		UE_LOG(LogXP, Log, TEXT("[MyCharacter] Connected to XPComponent OnLevelChanged delegate"));
 	}
+
+	CreateLevelUpModal();
 }
 
 void AMyCharacter::SpawnDefaultWeapons()
@@ -231,7 +236,9 @@ void AMyCharacter::Attack()
 
 void AMyCharacter::PerformAttack()
 {
-	UE_LOG(LogTemp, Warning, TEXT("[ATTACK] PerformAttack called - Range=%.1f, Damage=%.1f"), AttackRange, AttackDamage);
+	SCOPE_CYCLE_COUNTER(STAT_VazioPlayerAttack);
+
+	VAZIO_TRACE(Combat, "ATTACK", "Range Damage", this, AttackRange, AttackDamage);
 	
 	// Play attack montage if available
 	if (AttackMontage)
@@ -263,17 +270,13 @@ void AMyCharacter::PerformAttack()
 		Params
 	);
 	
-	UE_LOG(LogTemp, Warning, TEXT("[ATTACK] Sweep result: %s, Found %d hits"), bHit ? TEXT("HIT") : TEXT("MISS"), HitResults.Num());
-	
 	if (bHit)
 	{
-		int32 EnemiesHit = 0;
+		[[maybe_unused]] int32 EnemiesHit = 0; // só o trace lê (some em Shipping)
 		for (const FHitResult& Hit : HitResults)
 		{
 			if (AActor* HitActor = Hit.GetActor())
 			{
-				UE_LOG(LogTemp, Warning, TEXT("[ATTACK] Checking hit actor: %s (Class: %s)"), *HitActor->GetName(), *HitActor->GetClass()->GetName());
-				
 				// Check if it's an enemy by looking for EnemyBase class
 				if (HitActor->GetClass()->GetName().Contains(TEXT("Enemy")))
 				{
@@ -283,23 +286,19 @@ void AMyCharacter::PerformAttack()
 					DamageEvent.HitInfo = Hit;
 					DamageEvent.ShotDirection = (HitActor->GetActorLocation() - GetActorLocation()).GetSafeNormal();
 					
-					float DamageApplied = HitActor->TakeDamage(AttackDamage, DamageEvent, GetController(), this);
+					[[maybe_unused]] const float DamageApplied = HitActor->TakeDamage(AttackDamage, DamageEvent, GetController(), this);
 					EnemiesHit++;
 					
-					UE_LOG(LogTemp, Warning, TEXT("[ATTACK] Player dealt %.1f damage to %s (Applied: %.1f)"), AttackDamage, *HitActor->GetName(), DamageApplied);
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("[ATTACK] Hit non-enemy: %s"), *HitActor->GetName());
+					VAZIO_TRACE(Combat, "ATTACK-HIT", "Damage Applied", HitActor, AttackDamage, DamageApplied);
 				}
 			}
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("[ATTACK] Attack complete - Hit %d enemies total"), EnemiesHit);
+		VAZIO_TRACE(Combat, "ATTACK-DONE", "Hits", this, EnemiesHit);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[ATTACK] No targets found in range %.1f"), AttackRange);
+		VAZIO_TRACE(Combat, "ATTACK-MISS", "Range", this, AttackRange);
 	}
 }
 
@@ -335,16 +334,12 @@ void AMyCharacter::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* O
 {
 	if (!OtherActor || OtherActor == this) return;
 	
-	UE_LOG(LogPlayerHealth, Warning, TEXT("[PLAYER-OVERLAP] %s (%s) overlapped with %s (%s)"), 
-        *GetName(),
-        OverlappedComp ? *OverlappedComp->GetName() : TEXT("NULL"), 
-        *OtherActor->GetName(),
-        OtherComp ? *OtherComp->GetName() : TEXT("NULL"));
+	VAZIO_TRACE_EVENT(Overlap, "PLAYER-OVERLAP", OtherActor);
 	
 	// Check if it's an enemy
 	if (OtherActor->FindComponentByClass<UEnemyHealthComponent>())
 	{
-		UE_LOG(LogPlayerHealth, Warning, TEXT("[PLAYER-ENEMY-DETECTED] Enemy %s entered damage area"), *OtherActor->GetName());
+		VAZIO_TRACE_EVENT(Overlap, "PLAYER-ENEMY-DETECTED", OtherActor);
 	}
 }
 
@@ -371,6 +366,14 @@ void AMyCharacter::OnRep_Health()
 void AMyCharacter::OnPlayerLevelUp(int32 NewLevel)
 {
 	UE_LOG(LogXP, Warning, TEXT("[MyCharacter] ⭐ LEVEL UP! New Level: %d"), NewLevel);
+
+	// Vários níveis num único AddXP: pausa uma vez e as escolhas seguem em sequência no mesmo modal
+	if (bLevelUpModalOpen)
+	{
+		++QueuedLevelUps;
+		UE_LOG(LogXP, Display, TEXT("[MyCharacter] Level up queued (%d pending)"), QueuedLevelUps);
+		return;
+	}
 	
 	// Get upgrade subsystem
 	UWorld* World = GetWorld();
@@ -387,25 +390,29 @@ void AMyCharacter::OnPlayerLevelUp(int32 NewLevel)
 		return;
 	}
 	
-	// Generate random upgrades
-	TArray<FUpgradeData> RandomUpgrades = UpgradeSS->GenerateRandomUpgrades(3);
-	if (RandomUpgrades.Num() == 0)
+	// Oferta já sorteada pelo subsistema (depois do último ApplyUpgrade)
+	UpgradeSS->TakePreparedOffer(PendingUpgradeChoices);
+	if (PendingUpgradeChoices.Num() == 0)
 	{
 		UE_LOG(LogXP, Warning, TEXT("[MyCharacter] No upgrades available!"));
 		return;
 	}
 	
-	UE_LOG(LogXP, Display, TEXT("[MyCharacter] Generated %d upgrade options:"), RandomUpgrades.Num());
-	for (const FUpgradeData& Upgrade : RandomUpgrades)
-	{
-		UE_LOG(LogXP, Display, TEXT("  - %s (Level %d/%d)"), 
-			*Upgrade.DisplayName.ToString(), 
-			Upgrade.CurrentLevel, 
-			Upgrade.MaxLevel);
-	}
+	UE_LOG(LogXP, Verbose, TEXT("[MyCharacter] Offering %d upgrade options"), PendingUpgradeChoices.Num());
 	
 	// Show level up modal
-	ShowLevelUpModal(RandomUpgrades);
+	ShowLevelUpModal(PendingUpgradeChoices);
+}
+
+void AMyCharacter::CreateLevelUpModal()
+{
+	if (LevelUpModal.IsValid() || !FSlateApplication::IsInitialized() || IsRunningDedicatedServer())
+	{
+		return;
+	}
+
+	LevelUpModal = SNew(SLevelUpModal)
+		.OnUpgradeChosen_UObject(this, &AMyCharacter::OnUpgradeChosen);
 }
 
 void AMyCharacter::ShowLevelUpModal(const TArray<FUpgradeData>& Upgrades)
@@ -417,50 +424,54 @@ void AMyCharacter::ShowLevelUpModal(const TArray<FUpgradeData>& Upgrades)
 		return;
 	}
 	
-	// Close existing modal if any
-	if (ActiveLevelUpModal.IsValid())
+	CreateLevelUpModal();
+	if (!LevelUpModal.IsValid())
 	{
-		CloseLevelUpModal();
+		UE_LOG(LogXP, Error, TEXT("[MyCharacter] Cannot show modal - Slate not available"));
+		return;
 	}
 	
-	// Pause game
-	PC->SetPause(true);
-	UE_LOG(LogXP, Display, TEXT("[MyCharacter] Game paused for level up"));
-	
-	// Set input mode to UI only
-	FInputModeUIOnly InputMode;
-	InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
-	PC->SetInputMode(InputMode);
-	PC->bShowMouseCursor = true;
-	
-	// Create Slate modal
-	ActiveLevelUpModal = SNew(SLevelUpModal)
-		.OnUpgradeChosen_Lambda([this](EUpgradeType ChosenType)
-		{
-			OnUpgradeChosen(ChosenType);
-		});
-	
-	// Setup upgrades
-	ActiveLevelUpModal->SetupUpgrades(Upgrades);
+	// Reaproveita os cards existentes; sem alocar widgets no frame do level-up
+	if (&Upgrades != &PendingUpgradeChoices)
+	{
+		PendingUpgradeChoices = Upgrades;
+	}
+	LevelUpModal->SetupUpgrades(PendingUpgradeChoices);
+	LevelUpModal->SetRemainingChoices(QueuedLevelUps);
 	
-	// Add to viewport
-	if (GEngine && GEngine->GameViewport)
+	// Já aberto (próxima escolha da fila): jogo continua pausado, só troca o conteúdo
+	if (!bLevelUpModalOpen)
 	{
+		if (!GEngine || !GEngine->GameViewport)
+		{
+			UE_LOG(LogXP, Error, TEXT("[MyCharacter] Failed to add modal to viewport - GEngine or GameViewport is null"));
+			return;
+		}
+		
+		// Pause game
+		if (UWorldFreezeSubsystem* Freeze = GetWorld()->GetSubsystem<UWorldFreezeSubsystem>())
+		{
+			Freeze->Freeze(EWorldFreezeReason::LevelUp);
+		}
+		UE_LOG(LogXP, Display, TEXT("[MyCharacter] Game paused for level up"));
+		
+		// Set input mode to UI only
+		FInputModeUIOnly InputMode;
+		InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
+		PC->SetInputMode(InputMode);
+		PC->bShowMouseCursor = true;
+		
 		GEngine->GameViewport->AddViewportWidgetContent(
-			ActiveLevelUpModal.ToSharedRef(),
+			LevelUpModal.ToSharedRef(),
 			100 // High Z-order to be on top
 		);
-		
-		// Force focus to the modal
-		FSlateApplication::Get().SetKeyboardFocus(ActiveLevelUpModal);
+		bLevelUpModalOpen = true;
 		
 		UE_LOG(LogXP, Display, TEXT("[MyCharacter] ✅ Level Up modal displayed!"));
 	}
-	else
-	{
-		UE_LOG(LogXP, Error, TEXT("[MyCharacter] Failed to add modal to viewport - GEngine or GameViewport is null"));
-		PC->SetPause(false); // Unpause if we failed
-	}
+	
+	// Force focus to the modal
+	FSlateApplication::Get().SetKeyboardFocus(LevelUpModal);
 }
 
 void AMyCharacter::OnUpgradeChosen(EUpgradeType ChosenType)
@@ -482,33 +493,53 @@ void AMyCharacter::OnUpgradeChosen(EUpgradeType ChosenType)
 		}
 	}
 	
+	// Próximo level-up da fila: nova oferta no mesmo modal, sem despausar no meio
+	if (bLevelUpModalOpen && QueuedLevelUps > 0)
+	{
+		--QueuedLevelUps;
+		if (UUpgradeSubsystem* UpgradeSS = GetWorld() ? GetWorld()->GetSubsystem<UUpgradeSubsystem>() : nullptr)
+		{
+			UpgradeSS->TakePreparedOffer(PendingUpgradeChoices);
+			if (PendingUpgradeChoices.Num() > 0)
+			{
+				ShowLevelUpModal(PendingUpgradeChoices);
+				return;
+			}
+		}
+	}
+	
 	// Close modal and resume game
 	CloseLevelUpModal();
 }
 
 void AMyCharacter::CloseLevelUpModal()
 {
-	if (!ActiveLevelUpModal.IsValid())
+	if (!bLevelUpModalOpen)
 	{
 		return;
 	}
 	
-	// Remove from viewport
-	if (GEngine && GEngine->GameViewport)
+	// Remove from viewport (o widget fica guardado para o próximo level-up)
+	if (GEngine && GEngine->GameViewport && LevelUpModal.IsValid())
 	{
-		GEngine->GameViewport->RemoveViewportWidgetContent(ActiveLevelUpModal.ToSharedRef());
+		GEngine->GameViewport->RemoveViewportWidgetContent(LevelUpModal.ToSharedRef());
 		UE_LOG(LogXP, Display, TEXT("[MyCharacter] Level Up modal closed"));
 	}
 	
-	// Reset modal reference
-	ActiveLevelUpModal.Reset();
+	bLevelUpModalOpen = false;
+	PendingUpgradeChoices.Reset();
+	QueuedLevelUps = 0;
+	
+	// Unpause game and restore input mode (menu de pausa aberto por cima mantém o mundo parado)
+	UWorldFreezeSubsystem* Freeze = GetWorld() ? GetWorld()->GetSubsystem<UWorldFreezeSubsystem>() : nullptr;
+	if (Freeze)
+	{
+		Freeze->Thaw(EWorldFreezeReason::LevelUp);
+	}
 	
-	// Unpause game and restore input mode
 	APlayerController* PC = Cast<APlayerController>(GetController());
-	if (PC)
+	if (PC && !(Freeze && Freeze->IsFrozen()))
 	{
-		PC->SetPause(false);
-		
 		FInputModeGameAndUI InputMode;
 		InputMode.SetHideCursorDuringCapture(false);
 		InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
@@ -15,7 +15,7 @@ void UPlayerHealthComponent::BeginPlay()
 
 void UPlayerHealthComponent::ReceiveDamage(float DamageAmount)
 {
-    if (DamageAmount <= 0.f || CurrentHealth <= 0.f) return;
+    if (DamageAmount <= 0.f || CurrentHealth <= 0.f || bInvulnerable) return;
 
     CurrentHealth = FMath::Max(0.f, CurrentHealth - DamageAmount);
     OnHealthChanged.Broadcast(CurrentHealth, MaxHealth);
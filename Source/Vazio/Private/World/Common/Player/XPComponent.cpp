@@ -23,23 +23,21 @@ void UXPComponent::AddXP(int32 Amount)
     CurrentXP += FinalAmount;
     UE_LOG(LogTemp, Log, TEXT("XP Added: %d (base: %d, multiplier: %.2f)"), FinalAmount, Amount, XPMultiplier);
 
-    bool bLeveled = false;
+    const int32 StartLevel = CurrentLevel;
     while (CurrentXP >= XPToNextLevel)
     {
         CurrentXP -= XPToNextLevel;
         CurrentLevel++;
         XPToNextLevel = CalculateXPForNextLevel();
-        bLeveled = true;
-        
-        // Broadcast level up - MyCharacter will handle showing upgrade modal
-        OnLevelChanged.Broadcast(CurrentLevel);
-        UE_LOG(LogTemp, Warning, TEXT("[XPComponent] 🎉 Level Up! New Level: %d"), CurrentLevel);
     }
 
     OnXPChanged.Broadcast(CurrentXP, XPToNextLevel);
-    if (bLeveled)
+
+    // Level-ups só depois do estado final do XP; MyCharacter enfileira os modais
+    for (int32 Level = StartLevel + 1; Level <= CurrentLevel; ++Level)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Level Up! New Level: %d"), CurrentLevel);
+        UE_LOG(LogTemp, Warning, TEXT("[XPComponent] 🎉 Level Up! New Level: %d"), Level);
+        OnLevelChanged.Broadcast(Level);
     }
 }
 
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Trace de gameplay: ligado em Debug/Development/Test, removido por completo em Shipping
+#ifndef VAZIO_GAMEPLAY_TRACE
+#define VAZIO_GAMEPLAY_TRACE !UE_BUILD_SHIPPING
+#endif
+
+enum class EGameplayTraceCategory : uint8
+{
+    Spawn,
+    Tick,
+    Move,
+    Overlap,
+    Damage,
+    Combat,
+    Drop,
+    Boss,
+    AI,
+    Count
+};
+
+/**
+ * Evento binário gravado no ring buffer. Nada é formatado na gravação: Name e Fields
+ * apontam para literais estáticos e o objeto é guardado como FName; o texto só é montado
+ * no dump.
+ */
+struct FGameplayTraceEvent
+{
+    static constexpr int32 MaxValues = 6;
+
+    uint64 Cycles = 0;
+    uint64 Frame = 0;
+    const TCHAR* Name = nullptr;
+    const TCHAR* Fields = nullptr; // rótulos dos valores separados por espaço (pode ser nullptr)
+    FName Object;
+    float Values[MaxValues] = {};
+    EGameplayTraceCategory Category = EGameplayTraceCategory::Count;
+    uint8 NumValues = 0;
+};
+
+/**
+ * Ring buffer de tamanho fixo, sem locks (múltiplos produtores), com máscara de
+ * categorias (GameplayTrace.Mask) e limite de eventos por segundo por categoria
+ * (GameplayTrace.Rate). Use pelas macros VAZIO_TRACE* para que o custo suma em Shipping.
+ */
+class VAZIO_API FGameplayTrace
+{
+public:
+    static constexpr int32 Capacity = 8192; // potência de 2
+
+    static bool IsCategoryEnabled(EGameplayTraceCategory Category);
+
+    static void Record(EGameplayTraceCategory Category, const TCHAR* Name, const TCHAR* Fields, const UObject* Object,
+                       std::initializer_list<float> Values);
+
+    // Converte cada valor (double dos FVector do UE5, int, etc.) para float antes de gravar
+    template <typename... ValueTypes>
+    static FORCEINLINE void RecordValues(EGameplayTraceCategory Category, const TCHAR* Name, const TCHAR* Fields, const UObject* Object,
+                                         ValueTypes... Values)
+    {
+        Record(Category, Name, Fields, Object, { static_cast<float>(Values)... });
+    }
+
+    // Copia os eventos válidos dos últimos WindowSeconds (0 = buffer inteiro), do mais antigo ao mais novo
+    static void Snapshot(TArray<FGameplayTraceEvent>& OutEvents, double WindowSeconds = 0.0);
+
+    // Texto legível dos eventos, com idade relativa a NowCycles. Não toca no buffer: pode rodar em outra thread.
+    static FString FormatEvents(const TArray<FGameplayTraceEvent>& Events, uint64 NowCycles);
+
+    // Formata e grava em disco; retorna o caminho escrito (vazio em caso de falha)
+    static FString DumpToFile(const FString& FileName = FString(), double WindowSeconds = 0.0);
+
+    static void SetCategoryRate(EGameplayTraceCategory Category, int32 EventsPerSecond);
+    static const TCHAR* GetCategoryName(EGameplayTraceCategory Category);
+    static EGameplayTraceCategory FindCategory(const FString& Name);
+
+    static uint64 GetNumRecorded();
+    static uint64 GetNumDropped();
+};
+
+#if VAZIO_GAMEPLAY_TRACE
+#define VAZIO_TRACE(Category, Name, Fields, Object, ...) \
+    FGameplayTrace::RecordValues(EGameplayTraceCategory::Category, TEXT(Name), TEXT(Fields), Object, __VA_ARGS__)
+#define VAZIO_TRACE_EVENT(Category, Name, Object) \
+    FGameplayTrace::Record(EGameplayTraceCategory::Category, TEXT(Name), nullptr, Object, {})
+#else
+#define VAZIO_TRACE(Category, Name, Fields, Object, ...)
+#define VAZIO_TRACE_EVENT(Category, Name, Object)
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpikeCaptureSubsystem.generated.h"
+
+/**
+ * Detector de picos de frame. Guarda por frame só alguns contadores baratos num ring buffer
+ * (o trace de gameplay já tem sua própria janela) e, quando um frame passa de
+ * Vazio.Spike.ThresholdMs, grava em Saved/Spikes um arquivo com a janela recente de contadores,
+ * os eventos de trace, contagens de entidades, stat Vazio e o tempo da timeline de spawn.
+ * A formatação e a escrita rodam fora do game thread.
+ */
+UCLASS()
+class VAZIO_API USpikeCaptureSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Captura imediata (Vazio.Spike.Capture), independente do limiar
+    void Capture(float FrameMs, const TCHAR* Reason);
+
+private:
+    struct FFrameCounters
+    {
+        uint64 Frame = 0;
+        float FrameMs = 0.f;
+        float GameThreadMs = 0.f;
+        int32 Enemies = 0;
+        int32 PoolActive = 0;
+        int32 PendingSpawns = 0;
+    };
+
+    static constexpr int32 HistorySize = 1024; // potência de 2
+
+    TArray<FFrameCounters> History;
+    int32 HistoryHead = 0;
+    int32 HistoryCount = 0;
+
+    double LastFrameSeconds = 0.0;
+    uint64 LastTickFrame = 0;
+    double LastCaptureSeconds = -1.0e9;
+    int32 NumCaptures = 0;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stat group do jogo: `stat Vazio` no console mostra o custo por sistema e por arquétipo.
+ * Os SCOPE_CYCLE_COUNTER também aparecem como eventos de CPU no Unreal Insights
+ * (-trace=cpu,stats) e os contadores DWORD como counters.
+ */
+DECLARE_STATS_GROUP(TEXT("Vazio"), STATGROUP_Vazio, STATCAT_Advanced);
+
+struct FVazioStatTime
+{
+    FName Name;          // STAT_Vazio...
+    FString Description; // "AI: Horde Sim"
+    float Milliseconds = 0.f;
+};
+
+// Tempo inclusivo médio de cada cycle stat do grupo no último frame processado pelo stats thread.
+// Só retorna dados com o grupo ativo ("stat Vazio" ou "stat Vazio -nodisplay") e em builds com STATS.
+VAZIO_API void GetVazioStatTimes(TArray<FVazioStatTime>& OutTimes);
+
+// Percentil por nearest-rank (P em [0,1]) dos relatórios de benchmark; 0 com amostra vazia
+VAZIO_API float GetVazioPercentile(TArray<float> Values, float P);
+
+// Spawner / pool
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawner: Spawn Events"), STAT_VazioSpawnEvents, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawner: Spawn Actor"), STAT_VazioSpawnActor, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawner: Deferred Spawns"), STAT_VazioDeferredSpawns, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawner: Events/Frame"), STAT_VazioSpawnEventsPerFrame, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawner: Enemies Spawned/Frame"), STAT_VazioEnemiesSpawned, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawner: Deferred Queue"), STAT_VazioDeferredQueue, STATGROUP_Vazio, VAZIO_API);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool: Acquire"), STAT_VazioPoolAcquire, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool: Release"), STAT_VazioPoolRelease, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pool: Hits"), STAT_VazioPoolHits, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pool: Misses"), STAT_VazioPoolMisses, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pool: Active"), STAT_VazioPoolActive, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pool: High Water"), STAT_VazioPoolHighWater, STATGROUP_Vazio, VAZIO_API);
+
+// IA e movimento
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Horde Sim"), STAT_VazioHordeSim, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Decisions"), STAT_VazioDecisions, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI: Cooldowns"), STAT_VazioCooldowns, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Movement: Chase"), STAT_VazioChase, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI: Live Enemies"), STAT_VazioLiveEnemies, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI: Decisions/Frame"), STAT_VazioDecisionsPerFrame, STATGROUP_Vazio, VAZIO_API);
+
+// Custo de Tick por arquétipo
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: NormalEnemy"), STAT_VazioTickNormal, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: HeavyEnemy"), STAT_VazioTickHeavy, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: RangedEnemy"), STAT_VazioTickRanged, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: DashEnemy"), STAT_VazioTickDash, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: AuraEnemy"), STAT_VazioTickAura, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: SplitterSlime"), STAT_VazioTickSplitter, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: GoldEnemy"), STAT_VazioTickGold, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick: Boss"), STAT_VazioTickBoss, STATGROUP_Vazio, VAZIO_API);
+
+// Dano
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage: Enemy Damage"), STAT_VazioEnemyDamage, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage: Status Effects"), STAT_VazioStatusEffects, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage: Auras"), STAT_VazioAuras, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage: Player Attack"), STAT_VazioPlayerAttack, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage: Hits/Frame"), STAT_VazioDamageEvents, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage: Deaths/Frame"), STAT_VazioDeaths, STATGROUP_Vazio, VAZIO_API);
+
+// Drops e XP
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Drops: Spawn"), STAT_VazioDrops, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Drops: XP Orb Tick"), STAT_VazioXPOrbTick, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Drops: XP Orbs Spawned/Frame"), STAT_VazioXPOrbsSpawned, STATGROUP_Vazio, VAZIO_API);
+
+// Boss
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss: Encounter"), STAT_VazioBossEncounter, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Boss: Sync Loads"), STAT_VazioBossSyncLoads, STATGROUP_Vazio, VAZIO_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss: Bullets"), STAT_VazioBossBullets, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Boss: Live Bullets"), STAT_VazioBossBulletsLive, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Boss: Live Minions"), STAT_VazioBossMinions, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Boss: Minions Over Budget"), STAT_VazioBossMinionsDenied, STATGROUP_Vazio, VAZIO_API);
+
+// HUD
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD: Updates"), STAT_VazioHUDUpdate, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD: Updates/Frame"), STAT_VazioHUDUpdates, STATGROUP_Vazio, VAZIO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD: Coalesced/Frame"), STAT_VazioHUDCoalesced, STATGROUP_Vazio, VAZIO_API);
+
+// Pausa
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pause: Thaw"), STAT_VazioWorldThaw, STATGROUP_Vazio, VAZIO_API);
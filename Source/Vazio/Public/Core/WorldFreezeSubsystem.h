@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldFreezeSubsystem.generated.h"
+
+// Quem está segurando o mundo parado; o mundo só volta quando todos soltarem
+enum class EWorldFreezeReason : uint8
+{
+    None      = 0,
+    LevelUp   = 1 << 0,
+    PauseMenu = 1 << 1,
+};
+ENUM_CLASS_FLAGS(EWorldFreezeReason);
+
+/**
+ * Pausa "mundo congelado" para o modal de level-up e os menus de pausa.
+ * Usa a pausa do engine (ticks, timers, roda de cooldowns, overlaps e projéteis de boss
+ * param sem custo; o render continua com as transforms/poses já calculadas) e conta os
+ * motivos, então fechar o menu de pausa com o level-up aberto não solta o jogo.
+ * Na volta, os inimigos com tick reduzido recebem fases espalhadas no intervalo em vez de
+ * vencerem todos no primeiro frame.
+ */
+UCLASS()
+class VAZIO_API UWorldFreezeSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+
+    void Freeze(EWorldFreezeReason Reason);
+    void Thaw(EWorldFreezeReason Reason);
+
+    // Solta todos os motivos (saída para o menu principal)
+    void ThawAll();
+
+    bool IsFrozen() const { return Reasons != EWorldFreezeReason::None; }
+    bool IsFrozenBy(EWorldFreezeReason Reason) const { return EnumHasAnyFlags(Reasons, Reason); }
+
+    // Tempo real (s) passado congelado neste mundo
+    double GetTotalFrozenSeconds() const;
+
+private:
+    void EnterFreeze();
+    void ExitFreeze();
+    void StaggerThrottledTicks();
+
+    EWorldFreezeReason Reasons = EWorldFreezeReason::None;
+    double FrozenAtSeconds = 0.0;
+    double TotalFrozenSeconds = 0.0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BossProjectileSubsystem.generated.h"
+
+class AActor;
+class UInstancedStaticMeshComponent;
+struct FBossBulletEmitter;
+
+/**
+ * Projéteis de boss sem atores: posições/velocidades em arrays (SoA) com remoção por swap,
+ * colisão só contra os pawns dos jogadores (dano acumulado e aplicado uma vez por frame) e
+ * um único UInstancedStaticMeshComponent atualizado em lote para o desenho.
+ * Os emissores de FBossAttackPattern::Bullets escrevem direto aqui; rajadas seguintes ficam
+ * pendentes e acompanham a posição do boss.
+ */
+UCLASS()
+class VAZIO_API UBossProjectileSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Dispara a primeira rajada agora e agenda as demais. Source é a origem e o DamageCauser.
+    void Emit(AActor* Source, const FBossBulletEmitter& Emitter);
+
+    // Cancela rajadas pendentes de Source (boss morto/devolvido ao pool); projéteis já no ar seguem
+    void CancelEmitters(const AActor* Source);
+
+    void ClearAll();
+
+    int32 GetNumLive() const { return Positions.Num(); }
+    int32 GetNumPendingVolleys() const { return PendingVolleys.Num(); }
+
+private:
+    struct FPendingVolley
+    {
+        TWeakObjectPtr<AActor> Source;
+        TSharedPtr<const FBossBulletEmitter> Emitter;
+        int32 VolleyIndex = 0;
+        float TimeUntilNext = 0.f;
+        FVector AimDirection = FVector::ForwardVector; // fixada na primeira rajada (exceto AimedBurst)
+    };
+
+    void FireVolley(FPendingVolley& Volley);
+    void AddProjectile(const FVector& Location, const FVector& Velocity, const FBossBulletEmitter& Emitter, AActor* Source);
+    void RemoveProjectile(int32 Index);
+    void Simulate(float DeltaTime);
+    void UpdateInstances();
+    void EnsureRenderer();
+
+    // SoA: mesmo índice em todos os arrays
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+    TArray<float> LifeRemaining;
+    TArray<float> Damages;
+    TArray<float> Radii;
+    TArray<TWeakObjectPtr<AActor>> Sources;
+
+    TArray<FPendingVolley> PendingVolleys;
+
+    UPROPERTY()
+    TObjectPtr<AActor> RenderActor;
+
+    UPROPERTY()
+    TObjectPtr<UInstancedStaticMeshComponent> Instances;
+
+    // Transforms enviados ao ISM; reaproveitado entre frames
+    TArray<FTransform> InstanceScratch;
+};
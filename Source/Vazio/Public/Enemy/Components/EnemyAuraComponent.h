@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "EnemyAuraComponent.generated.h"
 
+// Dados de aura; o dano é resolvido centralmente pelo UEnemyAuraSubsystem (sem tick nem overlaps por componente)
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class VAZIO_API UEnemyAuraComponent : public UActorComponent
 {
@@ -14,28 +15,27 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
     UFUNCTION(BlueprintCallable, Category = "Enemy Aura")
     void SetAuraProperties(float NewRadius, float NewDPS);
 
+    UFUNCTION(BlueprintCallable, Category = "Enemy Aura")
+    void SetAuraActive(bool bActive);
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aura")
     float Radius = 400.f;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aura")
     float DPS = 5.f;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aura")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Aura")
     bool bAuraActive = true;
 
 private:
-    void DealAuraDamage(float DeltaTime);
-    void FindTargetsInRadius(TArray<AActor*>& OutTargets);
-    
-    UPROPERTY(EditAnywhere, Category = "Aura")
-    float DamageTickRate = 0.5f; // Damage every 0.5 seconds
-    
-    float DamageAccumulator = 0.f;
+    friend class UEnemyAuraSubsystem;
+
+    // Índice no array denso de emissores do subsystem (INDEX_NONE = não registrado)
+    int32 EmitterIndex = INDEX_NONE;
 };
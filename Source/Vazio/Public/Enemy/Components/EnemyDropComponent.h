@@ -20,12 +20,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy Drop")
     void DropOnDeath(const AEnemyBase* Enemy, const FEnemyArchetype& Arch, const FEnemyInstanceModifiers& Mods, bool bIsParent);
 
+    // Regras de XP compartilhadas com o FTimelineSimulator
+    static int32 CalculateXPDrop(const FEnemyArchetype& Arch, const FEnemyInstanceModifiers& Mods, bool bIsParent);
+    static int32 GetXPOrbCount(int32 TotalXP);
+
 private:
     void SpawnXPOrbs(int32 TotalXP, const FVector& Location);
     void SpawnGold(int32 GoldAmount, const FVector& Location);
     void HandleBossRewards(const ABossEnemy* Boss);
 
-    int32 CalculateXPDrop(const FEnemyArchetype& Arch, const FEnemyInstanceModifiers& Mods, bool bIsParent);
     int32 CalculateGoldDrop(const FEnemyArchetype& Arch, const FEnemyInstanceModifiers& Mods, bool bIsParent);
 
     UPROPERTY(EditAnywhere, Category = "Drop Settings")
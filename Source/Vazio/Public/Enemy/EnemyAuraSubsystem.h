@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyAuraSubsystem.generated.h"
+
+class UEnemyAuraComponent;
+
+/**
+ * Resolve o dano de todas as auras de inimigos num único passo.
+ * A cada intervalo de dano, os emissores são ordenados num grid uniforme (hash de células,
+ * arrays reaproveitados) e cada jogador consulta só as células ao seu redor, acumulando o dano
+ * total antes de aplicá-lo uma única vez. Sem queries de física e sem alocação por tick.
+ */
+UCLASS()
+class VAZIO_API UEnemyAuraSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterEmitter(UEnemyAuraComponent* Emitter);
+    void UnregisterEmitter(UEnemyAuraComponent* Emitter);
+
+    int32 GetNumEmitters() const { return Emitters.Num(); }
+
+private:
+    static constexpr int32 NumCellBuckets = 1024;
+
+    void ResolveAuraDamage(float Interval);
+    void BuildGrid();
+
+    FORCEINLINE static int32 HashCell(int32 X, int32 Y)
+    {
+        return static_cast<int32>((static_cast<uint32>(X) * 73856093u) ^ (static_cast<uint32>(Y) * 19349663u)) & (NumCellBuckets - 1);
+    }
+
+    UPROPERTY()
+    TArray<TObjectPtr<UEnemyAuraComponent>> Emitters;
+
+    // Snapshot por intervalo (SoA), reaproveitado entre ticks
+    TArray<FVector> EmitterPositions;
+    TArray<FIntPoint> EmitterCells;
+    TArray<int32> EmitterBuckets;
+    TArray<int32> SortedEmitters;
+    int32 BucketStart[NumCellBuckets + 1];
+    int32 BucketCursor[NumCellBuckets];
+
+    float CellSize = 512.f;
+    float MaxRadius = 0.f;
+    float Accumulator = 0.f;
+};
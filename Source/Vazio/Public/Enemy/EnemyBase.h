@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"  
 #include "Enemy/EnemyTypes.h"
+#include "Enemy/EnemyCooldownSubsystem.h"
 #include "EnemyBase.generated.h"
 
 class UEnemyDropComponent;
@@ -20,6 +21,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
 
 public:
@@ -32,9 +34,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy")
     void StartDissolveTimer();
 
+    // Cancela todos os cooldowns pendentes (morte, dissolve, retorno ao pool)
+    virtual void ResetCooldowns();
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
     bool bIsParent = false;
 
+    // Filho gerado por split (conta no teto global do spawner)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy")
+    bool bIsSplitChild = false;
+
+    // Lacaio invocado por boss (conta no orçamento de lacaios do spawner)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy")
+    bool bIsBossMinion = false;
+
+    // Devolve ao pool se veio dele, senão destrói
+    void ReleaseEnemy();
+
+    // Assets que ApplyArchetypeAndModifiers/BeginPlay carregam; chamado no CDO para preload async
+    virtual void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     TObjectPtr<UEnemyDropComponent> DropComponent;
 
@@ -60,8 +79,14 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
     float MaxHP = 100.f;
 
-    FTimerHandle DissolveTimerHandle;
-    FTimerHandle DashCooldownHandle;
+    FEnemyCooldownHandle DissolveTimerHandle;
+    FEnemyCooldownHandle DashCooldownHandle;
+    FEnemyCooldownHandle DamageFlashHandle;
+
+    float StatusSpeedScale = 1.f;
+    float BaseWalkSpeed = 300.f; // sem slow/freeze; MaxWalkSpeed = BaseWalkSpeed * StatusSpeedScale
+
+    UEnemyCooldownSubsystem* GetCooldowns() const;
 
     UFUNCTION()
     void OnDissolveComplete();
@@ -75,11 +100,31 @@ protected:
     virtual void SetupMovement();
     virtual void HandleDashLogic(float DeltaTime);
 
+    // Decisão de IA fatiada no tempo pelo UEnemyDecisionSubsystem (movimento continua por frame)
+    virtual void MakeDecision() {}
+    void RegisterForDecisions(FName DecisionType);
+    bool IsDecisionScheduled() const { return DecisionIndex != INDEX_NONE; }
+
 public:
     FORCEINLINE float GetCurrentHP() const { return CurrentHP; }
     FORCEINLINE float GetMaxHP() const { return MaxHP; }
+
+    // Seek da timeline: recria inimigos já feridos sem passar pelo fluxo de dano
+    void SetHealthFraction(float Fraction) { CurrentHP = FMath::Max(1.f, MaxHP * FMath::Clamp(Fraction, 0.f, 1.f)); }
     FORCEINLINE const FEnemyArchetype& GetArchetype() const { return CurrentArchetype; }
     FORCEINLINE const FEnemyInstanceModifiers& GetModifiers() const { return CurrentModifiers; }
+    FORCEINLINE float GetStatusSpeedScale() const { return StatusSpeedScale; }
+    FORCEINLINE bool IsStatusFrozen() const { return StatusSpeedScale <= 0.f; }
+
+    // Slow/freeze vindos do UStatusEffectSubsystem (1 = sem efeito, 0 = congelado)
+    void SetStatusSpeedScale(float NewScale);
+
+    // Velocidade sem status (arquétipo, modificadores, fases de boss); o slow ativo continua valendo
+    void SetBaseWalkSpeed(float Speed);
+    FORCEINLINE float GetBaseWalkSpeed() const { return BaseWalkSpeed; }
+
+    // Invocação acima do orçamento vira reforço: +BonusFraction do HP base modificado (até MaxScale vezes ele, sem nunca baixar o MaxHP) e cura total
+    void Empower(float BonusFraction, float MaxScale);
 
     UFUNCTION(BlueprintCallable, Category = "Enemy")
     virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
@@ -93,6 +138,9 @@ public:
     // AI movement
     void ChasePlayer();
 
+    // Direção de perseguição + separação da simulação paralela (Fallback se ainda não simulado)
+    FVector GetSimSteerDirection(const FVector& Fallback) const;
+
     // Toggle base chase behavior (ranged enemies disable this)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|AI")
     bool bUseBaseChase = true;
@@ -111,4 +159,14 @@ public:
     FVector LastTargetLocation = FVector::ZeroVector;
     // Se já inicializou PreviousLocation
     bool bHasPreviousLocation = false;
+
+private:
+    friend class UEnemySimSubsystem;
+    friend class UEnemyDecisionSubsystem;
+
+    // Slot na simulação paralela da horda (INDEX_NONE = não registrado)
+    int32 SimIndex = INDEX_NONE;
+
+    // Slot no agendador de decisões (INDEX_NONE = decide a cada tick)
+    int32 DecisionIndex = INDEX_NONE;
 };
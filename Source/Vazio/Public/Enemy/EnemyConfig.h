@@ -24,6 +24,10 @@ public:
         return Archetypes.Find(TypeName);
     }
 
+    // Partial archetype overrides: { "archetypes": { "NormalEnemy": { "BaseHP": 60 } } }.
+    // Missing fields keep their current value; unknown types start from the default archetype.
+    bool ApplyOverridesFromJSON(const FString& JSONString, TArray<FString>* OutErrors = nullptr);
+
     // Factory method for creating default config
     UFUNCTION(CallInEditor, Category = "Factory")
     static UEnemyConfig* CreateDefaultConfig();
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyCooldownSubsystem.generated.h"
+
+/**
+ * Handle to a cooldown scheduled on UEnemyCooldownSubsystem.
+ * Slot + serial: once the slot fires or is cancelled its serial changes, so stale
+ * handles (e.g. kept by a pooled enemy that was recycled) are harmless no-ops.
+ */
+struct VAZIO_API FEnemyCooldownHandle
+{
+    uint32 Slot = 0;
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Serial != 0; }
+    void Invalidate() { Slot = 0; Serial = 0; }
+};
+
+/**
+ * Hierarchical timing wheel for gameplay cooldowns (dissolve, dash, fire cadence, burrow...).
+ * Schedule/Cancel are O(1) and never touch the world FTimerManager heap. Expired entries are
+ * collected while the wheel advances and fired as one batch at the end of the subsystem tick.
+ * Runs on game time, so it respects pause and time dilation like FTimerManager does.
+ */
+UCLASS()
+class VAZIO_API UEnemyCooldownSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Schedules Callback to run after DelaySeconds. Invalidates/cancels whatever InOutHandle pointed to.
+    void Schedule(FEnemyCooldownHandle& InOutHandle, float DelaySeconds, FSimpleDelegate Callback);
+
+    // Cancels the cooldown if it is still pending and invalidates the handle.
+    void Cancel(FEnemyCooldownHandle& InOutHandle);
+
+    bool IsPending(const FEnemyCooldownHandle& Handle) const;
+    float GetTimeRemaining(const FEnemyCooldownHandle& Handle) const;
+
+    int32 GetNumPending() const { return NumPending; }
+
+    // Resolução de um tick da roda (s)
+    static constexpr float TickResolution = 1.f / 60.f;
+
+private:
+    static constexpr int32 Level0Bits = 8;   // 256 slots  ~4.3s
+    static constexpr int32 LevelNBits = 6;   // 64 slots por nível superior
+    static constexpr int32 NumUpperLevels = 3;
+    static constexpr int32 Level0Size = 1 << Level0Bits;
+    static constexpr int32 LevelNSize = 1 << LevelNBits;
+    static constexpr int32 NumBuckets = Level0Size + LevelNSize * NumUpperLevels;
+    static constexpr uint64 MaxTicks = (uint64(1) << (Level0Bits + LevelNBits * NumUpperLevels)) - 1;
+
+    struct FEntry
+    {
+        FSimpleDelegate Callback;
+        uint64 ExpireTick = 0;
+        uint32 Serial = 0;
+        int32 Bucket = INDEX_NONE;
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+    };
+
+    FEntry* FindEntry(const FEnemyCooldownHandle& Handle);
+    const FEntry* FindEntry(const FEnemyCooldownHandle& Handle) const;
+
+    int32 AllocEntry();
+    void FreeEntry(int32 Index);
+    void InsertEntry(int32 Index);
+    void UnlinkEntry(int32 Index);
+    void CascadeBucket(int32 Bucket);
+    void AdvanceOneTick();
+    void FireExpired();
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeList;
+    int32 BucketHeads[NumBuckets];
+
+    // Entradas expiradas neste frame; reaproveitado entre frames para não alocar
+    TArray<FEnemyCooldownHandle> ExpiredScratch;
+
+    uint64 CurrentTick = 0;
+    float Accumulator = 0.f;
+    uint32 NextSerial = 1;
+    int32 NumPending = 0;
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyDecisionSubsystem.generated.h"
+
+class AEnemyBase;
+
+/**
+ * Agenda as decisões de IA (começar dash, atirar/recuar, perseguir) em round-robin com
+ * orçamento por frame. Inimigos perto do jogador decidem com mais frequência; o movimento
+ * continua sendo integrado a cada frame pelos próprios atores.
+ */
+UCLASS()
+class VAZIO_API UEnemyDecisionSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterAgent(AEnemyBase* Enemy, FName DecisionType);
+    void UnregisterAgent(AEnemyBase* Enemy);
+
+    int32 GetNumAgents() const { return Agents.Num(); }
+
+    // Custo médio por tipo desde o último reset
+    void DumpStats(bool bReset);
+
+private:
+    struct FDecisionAgent
+    {
+        TWeakObjectPtr<AEnemyBase> Enemy;
+        FName DecisionType;
+        double NextDecisionTime = 0.0;
+    };
+
+    struct FDecisionTypeStats
+    {
+        int64 Decisions = 0;
+        uint64 Cycles = 0;
+        uint64 MaxCycles = 0;
+    };
+
+    float GetDecisionInterval(const AEnemyBase* Enemy, const FVector& PlayerLocation) const;
+
+    TArray<FDecisionAgent> Agents;
+
+    TMap<FName, FDecisionTypeStats> TypeStats;
+
+    int32 Cursor = 0;
+    int32 LastFrameDecisions = 0;
+};
@@ -24,6 +24,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
     void ClearPool();
 
+    bool IsTracked(AEnemyBase* Enemy) const { return ActiveEnemies.Contains(Enemy); }
+    int32 GetNumActive() const { return ActiveEnemies.Num(); }
+    int32 GetNumPooled() const;
+    int32 GetActiveHighWater() const { return ActiveHighWater; }
+
 private:
     TMap<FName, TArray<AEnemyBase*>> PooledEnemies;
     
@@ -31,6 +36,10 @@ private:
     
     UPROPERTY(EditAnywhere, Category = "Pool Settings")
     int32 MaxPoolSizePerType = 50;
+
+    // Maior número de inimigos ativos simultâneos vindos do pool (stat Vazio)
+    int32 ActiveHighWater = 0;
     
     void PrepoolEnemies();
+    void UpdateActiveStats();
 };
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemySimSubsystem.generated.h"
+
+class AEnemyBase;
+
+// Resultado da simulação para um inimigo (lido pelo ator no tick seguinte)
+struct FEnemySimOutput
+{
+    FVector SteerDirection = FVector::ZeroVector; // perseguição + separação, normalizado no plano XY
+    float DistanceToPlayer = 0.f;                 // distância 2D ao jogador
+    bool bValid = false;
+};
+
+/**
+ * Simulação da horda em worker threads.
+ * No fim do frame faz snapshot (SoA) das posições, monta um grid de vizinhança e roda
+ * ParallelFor por blocos de índices escrevendo no back buffer; os atores leem o front buffer
+ * no tick seguinte. Cada índice só escreve no próprio slot e a ordem de vizinhos é fixa,
+ * então o resultado é idêntico com qualquer número de workers (timelines com seed continuam
+ * reproduzíveis).
+ * Só cobre steering. Dano de contato (AEnemyBase::OnOverlapBegin, cooldown por inimigo) e de
+ * aura (UEnemyAuraSubsystem) ficam no game thread: aplicar dano chama TakeDamage/delegates de
+ * UObject, que não podem rodar nos workers, e os dois já são baratos (evento de overlap e um
+ * passo em grid por intervalo). Avaliar contato aqui exigiria devolver os hits ao game thread.
+ */
+UCLASS()
+class VAZIO_API UEnemySimSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterEnemy(AEnemyBase* Enemy);
+    void UnregisterEnemy(AEnemyBase* Enemy);
+
+    // Resultado do último passo para o inimigo, ou nullptr se ainda não simulado
+    const FEnemySimOutput* GetOutput(const AEnemyBase* Enemy) const;
+
+    int32 GetNumSimulated() const { return Enemies.Num(); }
+    const TArray<TObjectPtr<AEnemyBase>>& GetEnemies() const { return Enemies; }
+
+private:
+    static constexpr int32 NumCellBuckets = 4096;
+
+    void GatherInputs();
+    void BuildNeighbourGrid();
+    struct FSimParams
+    {
+        FVector PlayerLocation = FVector::ZeroVector;
+        float SeparationRadius = 150.f;
+        float SeparationWeight = 0.6f;
+    };
+
+    void SimulateRange(int32 Begin, int32 End, const FSimParams& Params, TArray<FEnemySimOutput>& Out) const;
+
+    FORCEINLINE static int32 HashCell(int32 X, int32 Y)
+    {
+        return static_cast<int32>((static_cast<uint32>(X) * 73856093u) ^ (static_cast<uint32>(Y) * 19349663u)) & (NumCellBuckets - 1);
+    }
+
+    UPROPERTY()
+    TArray<TObjectPtr<AEnemyBase>> Enemies;
+
+    // Entradas (somente leitura nos workers)
+    TArray<FVector> Positions;
+    TArray<FIntPoint> Cells;
+    TArray<int32> Buckets;
+    TArray<uint8> ActiveFlags;
+    TArray<int32> SortedIndices;
+    TArray<int32> BucketStart;
+    TArray<int32> BucketCursor;
+
+    // Saída com double buffer: Outputs[FrontIndex] é lido pelos atores, o outro é escrito pela simulação
+    TArray<FEnemySimOutput> Outputs[2];
+    int32 FrontIndex = 0;
+
+    float CellSize = 150.f;
+};
@@ -16,13 +16,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawn", CallInEditor)
     static USpawnTimeline* CreateTimelineFromJSON(const FString& JSONString);
     
+    // Carrega uma timeline de arquivo (caminho relativo a Content/). Usa o .vtl binário ao lado
+    // quando existe e não é mais antigo que o JSON; o JSON só é lido como fallback de desenvolvimento
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawn")
+    static USpawnTimeline* LoadTimelineFile(const FString& Path);
+
     // Get example JSON for testing
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawn", CallInEditor)
     static FString GetExampleJSON();
     
     // Start spawn timeline with subsystem
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawn")
-    static void StartSpawnTimeline(UObject* WorldContext, USpawnTimeline* Timeline, int32 Seed = 0);
+    static void StartSpawnTimeline(UObject* WorldContext, USpawnTimeline* Timeline, int32 Seed = 0, float StartSeconds = 0.f);
     
     // Quick spawn function for testing
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawn")
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
 #include "Enemy/EnemyTypes.h"
 #include "Enemy/Types/BossEnemy.h"
 #include "EnemySpawnerSubsystem.generated.h"
@@ -9,6 +10,8 @@
 class UEnemyConfig;
 class USpawnTimeline;
 class AEnemyBase;
+struct FTimelineSimReport;
+struct FStreamableHandle;
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FSpawnerBossWarningSignature, const FBossSpawnEntry&);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FSpawnerBossSpawnSignature, ABossEnemy*, const FBossSpawnEntry&);
@@ -18,6 +21,30 @@ DECLARE_MULTICAST_DELEGATE_TwoParams(FSpawnerBossPhaseSignature, int32, const FB
 DECLARE_MULTICAST_DELEGATE_OneParam(FSpawnerBossTelegraphSignature, const FBossAttackPattern&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FSpawnerBossAttackSignature, const FBossAttackPattern&);
 
+// Spawn adiado: registrado durante dano/morte e executado depois dos ticks dos atores, com orçamento por frame
+struct FDeferredSpawnRequest
+{
+    FName Type;
+    FTransform Transform;
+    FEnemyInstanceModifiers Mods;
+    FEnemyArchetype Archetype;
+    bool bSplitChild = false;
+};
+
+// Evento da timeline com timer ainda pendente; guarda a cópia agendada para o diff do hot reload
+struct FScheduledSpawnEvent
+{
+    FSpawnEvent Event;
+    FTimerHandle Timer;
+};
+
+struct FScheduledBossEvent
+{
+    FBossSpawnEntry Entry;
+    FTimerHandle WarningTimer;
+    FTimerHandle SpawnTimer;
+};
+
 UCLASS()
 class VAZIO_API UEnemySpawnerSubsystem : public UWorldSubsystem
 {
@@ -30,6 +57,29 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawner")
     void StartTimeline(const USpawnTimeline* Timeline, int32 Seed = 0);
 
+    // Inicia a timeline já em StartSeconds: eventos até lá contam como executados. Com bPrepopulate,
+    // o FTimelineSimulator roda até StartSeconds e recria a população viva, o boss ativo e os eventos retidos.
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Testing")
+    void StartTimelineAt(const USpawnTimeline* Timeline, float StartSeconds, int32 Seed = 0, bool bPrepopulate = true);
+
+    // Controles de reprodução para teste. A pausa congela só a timeline (eventos, bosses agendados,
+    // retomada pós-boss); a horda continua simulando. Step roda a timeline por N segundos e pausa de novo.
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Testing")
+    void PauseTimeline();
+
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Testing")
+    void ResumeTimeline();
+
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Testing")
+    void StepTimeline(float Seconds = 1.f);
+
+    bool IsTimelinePaused() const { return bTimelinePaused; }
+    const USpawnTimeline* GetActiveTimeline() const { return ActiveTimeline; }
+
+    // Velocidade do jogo inteiro (time dilation global): timers, IA, projéteis e jogador juntos
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Testing")
+    void SetPlaybackSpeed(float Speed);
+
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawner")
     void SpawnLinear(FName Type, int32 Count, const FEnemyInstanceModifiers& Mods);
 
@@ -39,12 +89,55 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawner")
     AEnemyBase* SpawnOne(FName Type, const FTransform& Transform, const FEnemyInstanceModifiers& Mods);
 
+    // Enfileira um spawn para a fase pós-tick do frame (via pool). Retorna false se o teto de filhos de split foi atingido.
+    bool EnqueueDeferredSpawn(const FDeferredSpawnRequest& Request);
+
+    // Chamado quando um filho de split morre/dissolve/volta ao pool
+    void NotifySplitChildReleased();
+
+    int32 GetNumPendingDeferredSpawns() const { return PendingSpawns.Num(); }
+    int32 GetNumLiveSplitChildren() const { return LiveSplitChildren; }
+    int32 GetNumDeferredEvents() const { return DeferredEvents.Num(); }
+
+    // Orçamento de lacaios de boss: invoca até os tetos por boss e global (Enemy.Boss.MaxMinions*);
+    // o excedente reforça os lacaios vivos do mesmo boss. Retorna quantos foram criados.
+    int32 SummonBossMinions(ABossEnemy* Boss, FName Type, int32 Count, float Radius, const FEnemyInstanceModifiers& Mods);
+
+    // Chamado quando um lacaio de boss morre/dissolve/volta ao pool
+    void NotifyBossMinionReleased(AEnemyBase* Minion);
+
+    int32 GetNumLiveBossMinions() const { return BossMinions.Num(); }
+    int32 GetNumBossMinionsFor(const ABossEnemy* Boss) const;
+    int32 GetNumDeniedBossMinions() const { return DeniedBossMinions; }
+
+    // Segundos desde StartTimeline (tempo de jogo), ou -1 sem timeline ativa
+    float GetTimelineTime() const;
+
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawner")
     void SetEnemyConfig(UEnemyConfig* Config);
 
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawner")
     UEnemyConfig* GetEnemyConfig() const { return CurrentEnemyConfig; }
 
+    // Hot reload: carrega a timeline de um arquivo (relativo a Content/) e passa a observá-lo
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Hot Reload")
+    bool StartTimelineFromFile(const FString& Path, int32 Seed = 0, float StartSeconds = 0.f, bool bPrepopulate = true);
+
+    // Hot reload: aplica overrides de arquétipo de um JSON sobre a config atual e observa o arquivo
+    UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Hot Reload")
+    bool WatchEnemyConfigOverrides(const FString& Path);
+
+    // Troca a timeline ativa sem reiniciar: eventos futuros iguais mantêm o timer, removidos são
+    // cancelados e novos são agendados a partir do tempo atual. Eventos passados não reexecutam.
+    void ReloadTimeline(const USpawnTimeline* NewTimeline);
+
+    // Compara a config atual com o último snapshot e loga os arquétipos alterados.
+    // Spawns seguintes já leem o arquétipo novo (SpawnOne consulta a config a cada spawn).
+    void ApplyEnemyConfigChange();
+
+    // Recarrega as fontes observadas agora, mesmo sem mudança de timestamp
+    void ReloadWatchedSources();
+
     // Função para testar bosses individualmente
     UFUNCTION(BlueprintCallable, Category = "Enemy Spawner|Testing")
     void SpawnTestBoss(FName BossType);
@@ -57,6 +150,9 @@ public:
     ABossEnemy* GetActiveBoss() const { return ActiveBoss.Get(); }
     const FBossSpawnEntry& GetActiveBossEntry() const { return ActiveBossEntry; }
 
+    // Carregamentos síncronos de pacote desde o início do encontro atual (stat Boss: Sync Loads)
+    int32 GetEncounterSyncLoads() const { return EncounterSyncLoads; }
+
     FSpawnerBossWarningSignature OnBossWarning;
     FSpawnerBossSpawnSignature OnBossSpawned;
     FSpawnerBossEndSignature OnBossEnded;
@@ -66,12 +162,20 @@ public:
     FSpawnerBossAttackSignature OnBossAttackExecuted;
 
 private:
-    void ScheduleEvent(const FSpawnEvent& Event);
+    // ElapsedSeconds: tempo de timeline já decorrido (reagendamento no hot reload)
+    void ScheduleEvent(const FSpawnEvent& Event, float ElapsedSeconds = 0.f);
     void ExecuteSpawnEvent(const FSpawnEvent& Event);
 
-    void ScheduleBossEvent(const FBossSpawnEntry& BossEvent);
+    void ScheduleBossEvent(const FBossSpawnEntry& BossEvent, float ElapsedSeconds = 0.f);
+    void ClearScheduledTimers();
+    void SetScheduledTimersPaused(bool bPaused);
+    void PrepopulateFromSimulation(const FTimelineSimReport& Report);
     void TriggerBossWarning(FBossSpawnEntry BossEvent);
     void BeginBossEncounter(FBossSpawnEntry BossEvent);
+    // Pede async tudo que o boss e os tipos que ele invoca carregam no spawn (classes, materiais, som)
+    void PreloadBossAssets(const FBossSpawnEntry& BossEvent);
+    void ReleaseBossPreload();
+    void HandleSyncLoadPackage(const FString& PackageName);
     UFUNCTION()
     void HandleActiveBossDefeated(ABossEnemy* Boss);
     UFUNCTION()
@@ -92,18 +196,44 @@ private:
     bool FindSpawnPointCircle(float Radius, int32 Index, int32 TotalCount, FVector& OutLocation);
 
     AEnemyBase* CreateEnemyActor(FName Type, const FTransform& Transform);
+    AEnemyBase* AcquirePooledEnemy(FName Type, const FTransform& Transform);
+
+    void HandlePostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+    void ProcessDeferredSpawns();
 
     void ClearBossDelegates();
 
+    bool HotReloadTick(float DeltaTime);
+    bool ReloadTimelineFile();
+    bool ReloadConfigOverrides();
+#if WITH_EDITOR
+    // Asset de timeline reimportado ou config editada no editor durante o PIE
+    void HandleObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& Event);
+    FDelegateHandle ObjectPropertyChangedHandle;
+#endif
+
     UPROPERTY()
     TObjectPtr<UEnemyConfig> CurrentEnemyConfig;
 
     UPROPERTY()
     TObjectPtr<const USpawnTimeline> ActiveTimeline;
+    double TimelineStartSeconds = 0.0;
+    double TimelinePausedAtSeconds = 0.0;
+    bool bTimelinePaused = false;
+    FTimerHandle TimelineStepHandle;
 
     FRandomStream SpawnRng;
-    TArray<FTimerHandle> ScheduledTimers;
-    TArray<FTimerHandle> ScheduledBossTimers;
+    TArray<FScheduledSpawnEvent> ScheduledEvents;
+    TArray<FScheduledBossEvent> ScheduledBosses;
+
+    // Hot reload: arquivos observados e o último timestamp aplicado
+    FString TimelineSourcePath;
+    FDateTime TimelineSourceStamp;
+    FString ConfigOverridesPath;
+    FDateTime ConfigOverridesStamp;
+    TMap<FName, FEnemyArchetype> ConfigOverridesBase; // arquétipos antes dos overrides
+    TMap<FName, FEnemyArchetype> ArchetypeSnapshot;
+    FTSTicker::FDelegateHandle HotReloadTickerHandle;
 
     TArray<FSpawnEvent> DeferredEvents;
 
@@ -115,6 +245,30 @@ private:
 
     FTimerHandle BossResumeHandle;
 
+    // Preload do aviso: mantido até o fim do encontro para o GC não descarregar os assets
+    TSharedPtr<FStreamableHandle> BossPreloadHandle;
+    FName PreloadedBossType;
+    FDelegateHandle SyncLoadHandle;
+    int32 EncounterSyncLoads = 0;
+    bool bTrackSyncLoads = false; // do spawn do boss até a derrota
+
+    // Lacaios de boss vivos e quem os invocou (o teto global é pequeno, busca linear basta)
+    struct FBossMinionEntry
+    {
+        TWeakObjectPtr<AEnemyBase> Minion;
+        TWeakObjectPtr<ABossEnemy> Boss;
+    };
+    void TrackBossMinion(AEnemyBase* Minion, ABossEnemy* Boss);
+
+    TArray<FBossMinionEntry> BossMinions;
+    int32 DeniedBossMinions = 0; // encontro atual
+    int32 NextEmpowerIndex = 0;
+
+    TArray<FDeferredSpawnRequest> PendingSpawns;
+    int32 LiveSplitChildren = 0;
+    int32 QueuedSplitChildren = 0;
+    FDelegateHandle PostActorTickHandle;
+
     // Spawn parameters - VISIBLE RANGE FOR PROPER GAMEPLAY
     UPROPERTY(EditAnywhere, Category = "Spawn Settings")
     float LinearSpawnMinDistance = 200.f;
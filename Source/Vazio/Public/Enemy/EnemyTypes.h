@@ -46,6 +46,16 @@ enum class EOnDeathBehavior : uint8
     Explode
 };
 
+UENUM(BlueprintType)
+enum class EStatusEffectType : uint8
+{
+    Burn,
+    Poison,
+    Slow,
+    Freeze,
+    Count UMETA(Hidden)
+};
+
 USTRUCT(BlueprintType)
 struct VAZIO_API FEnemyInstanceModifiers
 {
@@ -18,18 +18,42 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawn Timeline")
     TArray<FBossSpawnEntry> BossEvents;
 
+#if WITH_EDITORONLY_DATA
+    // Arquivo JSON de origem (reimport pelo editor)
+    UPROPERTY(VisibleAnywhere, Instanced, Category = "Import Settings")
+    TObjectPtr<class UAssetImportData> AssetImportData;
+#endif
+
     virtual FPrimaryAssetId GetPrimaryAssetId() const override
     {
         return FPrimaryAssetId("SpawnTimeline", GetFName());
     }
 
-    bool ParseFromJSON(const FString& JSONString);
+#if WITH_EDITORONLY_DATA
+    virtual void PostInitProperties() override;
+#endif
+
+    // Problemas estruturais do JSON vão para OutErrors (se informado); retorna false se o JSON é inválido
+    bool ParseFromJSON(const FString& JSONString, TArray<FString>* OutErrors = nullptr);
+
+    // Checagem semântica: tipos conhecidos, tempos, contagens, classes de boss. Config nula pula os arquétipos
+    bool Validate(const class UEnemyConfig* Config, TArray<FString>& OutErrors) const;
+
+    // Formato binário compacto (.vtl): cabeçalho com versão, tabela de nomes e eventos empacotados
+    static constexpr uint32 BinaryMagic = 0x4E4C5456; // "VTLN"
+    static constexpr uint32 BinaryVersion = 1;
+    static const TCHAR* BinaryExtension;
+
+    void SaveToBinary(TArray<uint8>& OutBytes) const;
+    bool LoadFromBinary(const TArray<uint8>& Bytes);
 
 private:
     void NormalizeSpawnData(const TSharedPtr<FJsonObject>& SpawnObject, FSpawnEvent& OutEvent);
-    void ParseBossEvents(const TSharedPtr<FJsonObject>& RootObject);
+    void ParseBossEvents(const TSharedPtr<FJsonObject>& RootObject, TArray<FString>* OutErrors);
     FEnemyInstanceModifiers ParseModifiers(const TSharedPtr<FJsonObject>& ModObject);
-    void ParseSpawnObjectIntoEvent(const TSharedPtr<FJsonObject>& SpawnsObject, FSpawnEvent& OutEvent);
+    void ParseSpawnObjectIntoEvent(const TSharedPtr<FJsonObject>& SpawnsObject, FSpawnEvent& OutEvent, TArray<FString>* OutErrors);
+    bool ParseTypeCountValue(FName Type, const TSharedPtr<FJsonValue>& Value, FSpawnEvent& OutEvent, TArray<FString>* OutErrors);
+    void SerializeBinary(FArchive& Ar);
 };
 
 
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Enemy/EnemyTypes.h"
+#include "StatusEffectSubsystem.generated.h"
+
+class AEnemyBase;
+
+/**
+ * Central status-effect engine (burn, poison, slow, freeze).
+ * One compact record per affected enemy (all effect types inline), processed in a single
+ * pass at a fixed rate. DoT damage is fed through AEnemyBase::TakeDamageSimple and
+ * slow/freeze through AEnemyBase::SetStatusSpeedScale.
+ */
+UCLASS()
+class VAZIO_API UStatusEffectSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Burn/Poison: Magnitude = DPS. Slow: Magnitude = fração de redução (0..1). Freeze: Magnitude ignorada.
+    // Reaplicar o mesmo tipo renova a duração e mantém a maior magnitude.
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    void ApplyEffect(AEnemyBase* Target, EStatusEffectType Type, float Duration, float Magnitude);
+
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    void ClearEffects(AEnemyBase* Target);
+
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    bool HasEffect(AEnemyBase* Target, EStatusEffectType Type) const;
+
+    int32 GetNumAffectedEnemies() const { return Targets.Num(); }
+    int32 GetNumActiveEffects() const;
+
+private:
+    static constexpr int32 NumEffectTypes = static_cast<int32>(EStatusEffectType::Count);
+
+    struct FStatusTarget
+    {
+        TWeakObjectPtr<AEnemyBase> Enemy;
+        const AEnemyBase* Key = nullptr; // chave em SlotByEnemy (válida mesmo após o ator morrer)
+        float Remaining[NumEffectTypes] = {};
+        float Magnitude[NumEffectTypes] = {};
+        uint8 ActiveMask = 0;
+        float AppliedSpeedScale = 1.f;
+    };
+
+    void StepEffects(float StepSeconds);
+    void RemoveTargetAt(int32 Index);
+
+    TArray<FStatusTarget> Targets;
+    TMap<const AEnemyBase*, int32> SlotByEnemy;
+
+    float Accumulator = 0.f;
+    bool bProcessing = false;
+};
@@ -8,6 +8,65 @@
 class UEnemySpawnerSubsystem;
 class ABossEnemy; // forward for delegate
 
+UENUM(BlueprintType)
+enum class EBossBulletShape : uint8
+{
+    Ring,       // Count projéteis em 360°
+    Spiral,     // anel que gira SpinPerVolley a cada rajada
+    Fan,        // Count projéteis em SpreadDegrees, centrado na mira
+    AimedBurst  // rajadas no jogador com dispersão aleatória de até SpreadDegrees
+};
+
+// Emissor de projéteis de boss; simulado e desenhado em lote pelo UBossProjectileSubsystem (sem atores)
+USTRUCT(BlueprintType)
+struct VAZIO_API FBossBulletEmitter
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    EBossBulletShape Shape = EBossBulletShape::Ring;
+
+    // Projéteis por rajada
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets", meta=(ClampMin="1"))
+    int32 Count = 12;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets", meta=(ClampMin="1"))
+    int32 Volleys = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float VolleyInterval = 0.25f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float SpreadDegrees = 60.f;
+
+    // Rotação extra por rajada (espiral) e offset inicial, em graus
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float SpinPerVolley = 10.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float AngleOffset = 0.f;
+
+    // Anéis/espirais partem da direção do jogador em vez da frente do boss
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    bool bAimAtPlayer = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float Speed = 600.f;
+
+    // Somado à velocidade a cada rajada (rajadas mais rápidas alcançam as anteriores)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float SpeedPerVolley = 0.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float Damage = 8.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float Radius = 20.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Bullets")
+    float LifeSeconds = 4.f;
+};
+
 USTRUCT(BlueprintType)
 struct VAZIO_API FBossAttackPattern
 {
@@ -40,6 +99,10 @@ struct VAZIO_API FBossAttackPattern
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Pattern", meta=(EditCondition="bSummonsMinions"))
     FEnemyInstanceModifiers MinionModifiers;
 
+    // Barragens disparadas na execução do padrão, além do handler
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Pattern")
+    TArray<FBossBulletEmitter> Bullets;
+
     FBossAttackPattern();
 };
 
@@ -81,6 +144,13 @@ struct VAZIO_API FBossPhaseDefinition
     FBossPhaseDefinition();
 };
 
+enum class EBossAttackState : uint8
+{
+    Idle,
+    Cooldown,
+    Telegraph
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBossPhaseChanged, int32, NewPhaseIndex, const FBossPhaseDefinition&, NewPhase);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBossHealthChanged, float, HealthFraction);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBossTelegraph, const FBossAttackPattern&, Pattern);
@@ -97,6 +167,7 @@ public:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
     virtual void HandleDeath(bool bIsParentParam = false) override;
+    virtual void ResetCooldowns() override;
     virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
 
     UFUNCTION(BlueprintCallable, BlueprintPure, Category="Boss")
@@ -109,6 +180,14 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category="Boss")
     FBossPhaseDefinition GetCurrentPhase() const;
 
+    const TArray<FBossPhaseDefinition>& GetPhases() const { return Phases; }
+    const FText& GetBossDisplayName() const { return BossDisplayName; }
+
+    // Tipos invocados por qualquer fase (loop de summon e padrões de ataque), sem repetição
+    void GetSummonTypes(TArray<FName>& OutTypes) const;
+    float GetDefaultAttackInterval() const { return DefaultAttackInterval; }
+    bool LoopsPhasePatterns() const { return bLoopPhasePatterns; }
+
     UPROPERTY(BlueprintAssignable, Category="Boss|Events")
     FOnBossPhaseChanged OnBossPhaseChanged;
     UPROPERTY(BlueprintAssignable, Category="Boss|Events")
@@ -143,15 +222,28 @@ protected:
     bool bFacePlayer = true;
 
     virtual void HandlePhaseStarted(const FBossPhaseDefinition& Phase);
+    // Fallback para padrões sem handler registrado (só dados: summon, telegraph, cooldown)
     virtual void PerformAttackPattern(const FBossAttackPattern& Pattern);
     virtual void PerformMovementPattern(float DeltaTime);
 
+    // Registra no construtor o comportamento de um PatternName; resolvido uma vez para índice no BeginPlay
+    template <typename TBoss>
+    void RegisterAttackHandler(FName PatternName, void (TBoss::*Handler)())
+    {
+        AttackHandlerIndices.Add(PatternName, AttackHandlers.Add(FSimpleDelegate::CreateUObject(static_cast<TBoss*>(this), Handler)));
+    }
+
+    void CompileAttackPatterns();
     void EvaluatePhase();
     void EnterPhase(int32 NewPhaseIndex);
-    void TickAttackCycle(float DeltaTime);
-    void StartTelegraph(const FBossAttackPattern& Pattern);
-    void FinishTelegraph();
-    void ExecuteAttackPattern(const FBossAttackPattern& Pattern);
+
+    // Máquina de estados do ataque: Cooldown -> Telegraph -> execução -> Cooldown, cada
+    // transição agendada no UEnemyCooldownSubsystem (nada roda por tick)
+    void ScheduleAttackState(EBossAttackState NewState, float DelaySeconds);
+    void CancelAttackCycle();
+    void OnAttackTimerElapsed();
+    void StartTelegraph(int32 PatternId);
+    void ExecuteAttackPattern(int32 PatternId);
     void HandleSummoning(float DeltaTime);
     void SpawnSummonedMinions(FName MinionType, int32 Count, float Radius, const FEnemyInstanceModifiers& Mods);
     void CacheSpawner();
@@ -160,14 +252,34 @@ protected:
     const FBossPhaseDefinition* GetCurrentPhasePtr() const { return Phases.IsValidIndex(CurrentPhaseIndex) ? &Phases[CurrentPhaseIndex] : nullptr; }
 
     int32 CurrentPhaseIndex = INDEX_NONE;
-    int32 CurrentPatternIndex = 0;
-    float AttackTimer = 0.f;
+    int32 CurrentPatternIndex = 0; // posição dentro da fase
     float SummonTimer = 0.f;
-    bool bTelegraphActive = false;
-    bool bHasCurrentPattern = false;
     float CachedMaxHP = 0.f;
+    float LastEvaluatedHP = -1.f; // fase só é reavaliada quando o HP muda
+
+    struct FCompiledBossPattern
+    {
+        FBossAttackPattern Pattern;
+        int32 HandlerIndex = INDEX_NONE;
+    };
+
+    struct FCompiledBossPhase
+    {
+        float Threshold = 1.f;
+        float AttackInterval = 5.f; // override da fase ou DefaultAttackInterval
+        int32 FirstPattern = 0; // ids contíguos em CompiledPatterns
+        int32 NumPatterns = 0;
+    };
+
+    TArray<FCompiledBossPattern> CompiledPatterns;
+    TArray<FCompiledBossPhase> CompiledPhases;
+    TArray<FSimpleDelegate> AttackHandlers;
+    TMap<FName, int32> AttackHandlerIndices;
+
+    EBossAttackState AttackState = EBossAttackState::Idle;
+    int32 CurrentPatternId = INDEX_NONE;
+    FEnemyCooldownHandle AttackHandle;
 
-    FBossAttackPattern CurrentPattern;
     TWeakObjectPtr<UEnemySpawnerSubsystem> CachedSpawnerSubsystem;
 
     // Para logs de debug de posição
@@ -14,7 +14,6 @@ public:
 
 protected:
     virtual void HandlePhaseStarted(const FBossPhaseDefinition& Phase) override;
-    virtual void PerformAttackPattern(const FBossAttackPattern& Pattern) override;
     virtual void PerformMovementPattern(float DeltaTime) override;
     virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
 
@@ -29,6 +28,6 @@ private:
     float SpikeDamage;
     float SpikeRadius;
 
-    FTimerHandle BurrowTimerHandle;
+    FEnemyCooldownHandle BurrowTimerHandle;
 };
 
@@ -12,9 +12,13 @@ class VAZIO_API ADashEnemy : public AEnemyBase
 public:
     ADashEnemy();
 
+public:
+    virtual void ResetCooldowns() override;
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
+    virtual void MakeDecision() override;
 
 private:
     void HandleDashBehavior(float DeltaTime);
@@ -34,7 +38,7 @@ private:
     FVector DashDirection;
     float DashTimeRemaining = 0.f;
     
-    FTimerHandle DashCooldownTimerHandle;
+    FEnemyCooldownHandle DashCooldownTimerHandle;
     
     UFUNCTION()
     void OnDashCooldownComplete();
@@ -15,7 +15,6 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void HandlePhaseStarted(const FBossPhaseDefinition& Phase) override;
-    virtual void PerformAttackPattern(const FBossAttackPattern& Pattern) override;
     virtual void PerformMovementPattern(float DeltaTime) override;
 
 protected:
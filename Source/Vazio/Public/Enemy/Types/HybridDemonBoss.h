@@ -14,13 +14,11 @@ public:
 
 protected:
     virtual void HandlePhaseStarted(const FBossPhaseDefinition& Phase) override;
-    virtual void PerformAttackPattern(const FBossAttackPattern& Pattern) override;
     virtual void PerformMovementPattern(float DeltaTime) override;
 
 private:
     void PerformInfernoRain();
     void PerformShadowDash();
-    void PerformOblivionProjectiles();
     void PerformCataclysm();
 
     float InfernoDamage;
@@ -12,9 +12,13 @@ class VAZIO_API ARangedEnemy : public AEnemyBase
 public:
     ARangedEnemy();
 
+public:
+    virtual void ResetCooldowns() override;
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
+    virtual void MakeDecision() override;
 
 private:
     void HandleRangedCombat(float DeltaTime);
@@ -32,6 +36,12 @@ private:
     UPROPERTY(EditAnywhere, Category = "Combat")
     TSubclassOf<AActor> ProjectileClass;
     
-    FTimerHandle FireTimerHandle;
-    float LastFireTime = 0.f;
+    // Cadência de tiro: arma pronta até disparar, depois espera 1/FireRate na roda de cooldowns
+    FEnemyCooldownHandle FireTimerHandle;
+    bool bFireReady = true;
+
+    // Resultado da última decisão: >0 aproxima, <0 recua, 0 segura posição
+    float DesiredMoveScale = 0.f;
+
+    void OnFireCooldownComplete();
 };
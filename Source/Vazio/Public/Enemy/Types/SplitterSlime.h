@@ -12,10 +12,17 @@ class VAZIO_API ASplitterSlime : public AEnemyBase
 public:
     ASplitterSlime();
 
+    int32 GetChildrenCount() const { return ChildrenCount; }
+    float GetChildrenHPMultiplier() const { return ChildrenHPMultiplier; }
+
+    // Arquétipo dos filhos a partir do arquétipo do pai (também usado pelo seek da timeline)
+    FEnemyArchetype MakeChildArchetype(const FEnemyArchetype& ParentArchetype) const;
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
     virtual void HandleDeath(bool bIsParentParam = false) override;
+    virtual void MakeDecision() override;
 
 private:
     void PursuePlayer(float DeltaTime);
@@ -38,4 +45,6 @@ private:
     
     UPROPERTY(EditAnywhere, Category = "Splitting")
     float ChildrenDMGMultiplier = 0.5f;
+
+    bool bWantsPursue = true;
 };
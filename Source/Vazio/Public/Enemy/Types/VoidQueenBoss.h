@@ -14,12 +14,12 @@ public:
 
 protected:
     virtual void HandlePhaseStarted(const FBossPhaseDefinition& Phase) override;
-    virtual void PerformAttackPattern(const FBossAttackPattern& Pattern) override;
     virtual void PerformMovementPattern(float DeltaTime) override;
 
 private:
     void PerformTentacleSlam();
     void PerformVoidDash();
+    void PerformVoidNova();
     void PerformBroodSummon();
 
     void DashTowardsPlayer(float Distance, float HeightOffset);
@@ -106,6 +106,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Upgrades")
     TArray<FUpgradeData> GenerateRandomUpgrades(int32 Count = 3);
 
+    /** Same as above, writing into OutUpgrades so callers can reuse its allocation */
+    void GenerateRandomUpgradesInto(int32 Count, TArray<FUpgradeData>& OutUpgrades);
+
+    /**
+     * Hand out the options for the next level-up. They are generated ahead of time
+     * (on Initialize and after each ApplyUpgrade), so the level-up itself only swaps arrays.
+     */
+    void TakePreparedOffer(TArray<FUpgradeData>& OutUpgrades);
+
     /**
      * Apply chosen upgrade to player character
      * @param Type The upgrade type to apply
@@ -157,6 +166,9 @@ private:
     /** Get upgrade value based on current level (scaling) */
     float CalculateUpgradeValue(EUpgradeType Type, int32 Level) const;
 
+    /** Regenerate PreparedOffer from the current upgrade levels */
+    void PrepareOffer();
+
 private:
     /** Track current level of each upgrade */
     UPROPERTY()
@@ -166,6 +178,15 @@ private:
     UPROPERTY()
     TArray<FUpgradeData> AvailableUpgrades;
 
+    /** Options for the next level-up (see TakePreparedOffer) */
+    TArray<FUpgradeData> PreparedOffer;
+    bool bOfferPrepared = false;
+
+    /** Indices of non-maxed upgrades, reused between generations */
+    TArray<int32> EligibleScratch;
+
+    static constexpr int32 OfferSize = 3;
+
     /** Cache of player controller for UI management */
     UPROPERTY()
     TWeakObjectPtr<APlayerController> CachedPlayerController;
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Engine/Console.h"
+#include "Enemy/Types/BossEnemy.h"
 #include "BossAutoTestSubsystem.generated.h"
 
 class UEnemySpawnerSubsystem;
@@ -14,6 +15,7 @@ class VAZIO_API UBossAutoTestSubsystem : public UWorldSubsystem
 
 public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
     virtual void Deinitialize() override;
 
     // Console Commands - podem ser chamadas via console do editor
@@ -42,6 +44,17 @@ public:
     UFUNCTION(Exec)
     void StopAutoTest();
 
+    // Benchmark roteirizado: cada boss passa por todas as fases (PhaseSeconds em cada) com o
+    // jogador invulnerável no bot do benchmark; mede frame time por padrão/estágio (telegraph,
+    // ataque, invocação) e conta atores spawnados. Saída em Saved/Benchmarks/<Nome>.csv/.json.
+    // Linha de comando: -BossBenchmark [-BossPhaseSeconds=20] [-BenchName=Nome] (sai ao terminar)
+    // Console: Vazio.Benchmark.Boss [PhaseSeconds] / Vazio.Benchmark.BossStop
+    void StartBossBenchmark(float PhaseSeconds = 20.f, const FString& RunName = FString());
+    void StopBossBenchmark();
+    bool IsBossBenchmarkRunning() const { return bBenchRunning; }
+
+    static bool IsBossBenchmarkCommandLine();
+
     // Input bindings - teclas para ativar testes
     void SetupInputBindings();
 
@@ -64,4 +77,62 @@ private:
 
     void GetEnemySpawner();
     void LogBossTest(const FString& Message);
+
+    // Benchmark de boss
+    struct FPatternBucket
+    {
+        FName Boss;
+        int32 Phase = 0;
+        FName Pattern;
+        FName Stage;
+        int32 Occurrences = 0;
+        int32 EnemiesSpawned = 0;
+        int32 ProjectilesSpawned = 0;
+        int32 OtherSpawned = 0;
+        TArray<float> FrameMs;
+    };
+
+    void RunNextBenchBoss();
+    void FinishBenchBoss();
+    void AdvanceBenchBossPhase();
+    void EnterBenchStage(FName Stage, FName Pattern, float Duration = 0.f);
+    FPatternBucket& GetBenchBucket(FName Stage);
+    void HandleBenchPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+    void HandleBenchActorSpawned(AActor* Actor);
+    void WriteBossBenchmarkReport();
+
+    UFUNCTION()
+    void HandleBenchTelegraph(const FBossAttackPattern& Pattern);
+    UFUNCTION()
+    void HandleBenchAttack(const FBossAttackPattern& Pattern);
+    UFUNCTION()
+    void HandleBenchPhaseChanged(int32 PhaseIndex, const FBossPhaseDefinition& PhaseData);
+    UFUNCTION()
+    void HandleBenchBossDefeated(ABossEnemy* Boss);
+
+    bool bBenchRunning = false;
+    bool bBenchExitWhenDone = false;
+    bool bBenchSummonThisFrame = false;
+    float BenchPhaseSeconds = 20.f;
+    float BenchAttackTimer = 0.f;
+    FString BenchName;
+
+    TArray<FName> BenchQueue;
+    int32 BenchBossIndex = INDEX_NONE;
+    TWeakObjectPtr<ABossEnemy> BenchBoss;
+
+    FName BenchStage;
+    FName BenchPattern;
+    int32 BenchPhase = 0;
+    double BenchStageEnd = 0.0;
+    double BenchPhaseStart = 0.0;
+    double BenchBossStart = 0.0;
+    double BenchLastFrame = 0.0;
+
+    TArray<FPatternBucket> BenchBuckets;
+    TMap<FString, int32> BenchBucketIndex;
+
+    FTimerHandle BenchNextBossTimer;
+    FDelegateHandle BenchPostTickHandle;
+    FDelegateHandle BenchSpawnHandle;
 };
\ No newline at end of file
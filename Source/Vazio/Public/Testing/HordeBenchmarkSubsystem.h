@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HordeBenchmarkSubsystem.generated.h"
+
+class USpawnTimeline;
+
+/**
+ * Benchmark headless da horda. Toca uma USpawnTimeline com seed fixa, move o jogador com
+ * um bot roteirizado e grava tempos de frame, custo por sistema (stat Vazio), contagens de
+ * inimigos/orbs/projéteis e memória em Saved/Benchmarks (CSV por janela + JSON resumo).
+ *
+ * Linha de comando (sai do processo ao terminar):
+ *   Vazio.uproject /Game/Levels/Battle_Main -game -nullrhi -unattended -benchmark -fps=60
+ *     -HordeBenchmark [-BenchSeconds=120] [-BenchSeed=1337] [-BenchTimeline=Enemy/TestWave.json] [-BenchName=Nome]
+ *     [-BenchStartAt=900] [-BenchSpeed=1]
+ * Console: Vazio.Benchmark.Start [Segundos] [Seed] [Timeline] [StartAt] [Speed] / Vazio.Benchmark.Stop
+ *
+ * StartAt pula direto para aquele ponto da timeline (população prevista pelo simulador);
+ * Speed > 1 acelera o jogo via time dilation, então os tempos de frame deixam de ser comparáveis.
+ */
+UCLASS()
+class VAZIO_API UHordeBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Timeline vazia = UEnemySpawnHelper::GetExampleJSON(); caminho relativo = relativo a Content/
+    void StartBenchmark(float DurationSeconds, int32 Seed, const FString& TimelinePath = FString(), const FString& RunName = FString(),
+                        float StartAtSeconds = 0.f, float Speed = 1.f);
+    void StopBenchmark();
+
+    bool IsRunning() const { return bRunning; }
+
+    // -HordeBenchmark na linha de comando: o GameMode não deve iniciar a wave de teste
+    static bool IsBenchmarkCommandLine();
+
+    // Bot roteirizado (também usado pelo soak): orbita a origem, ataca em intervalo fixo e
+    // escolhe a primeira opção do modal de level-up. SimTime deve ser tempo de jogo, não de parede.
+    static void DriveBot(UWorld* World, float SimTime, float DeltaTime, float& InOutAttackTimer);
+
+private:
+    struct FWindowSample
+    {
+        double Time = 0.0;
+        float AvgFrameMs = 0.f;
+        float MaxFrameMs = 0.f;
+        float AvgGameThreadMs = 0.f;
+        int32 Enemies = 0;
+        int32 XPOrbs = 0;
+        int32 Projectiles = 0;
+        float UsedMemoryMB = 0.f;
+        TArray<float> StatMs; // alinhado com StatColumns
+    };
+
+    void CloseWindow();
+    void SampleStats(TArray<float>& OutStatMs);
+    void WriteResults();
+
+    UPROPERTY()
+    TObjectPtr<USpawnTimeline> Timeline;
+
+    bool bRunning = false;
+    bool bExitWhenDone = false;
+    float Duration = 120.f;
+    int32 BenchSeed = 1337;
+    float BenchStartAt = 0.f;
+    float BenchSpeed = 1.f;
+    FString TimelineName;
+    FString Name;
+
+    double StartSeconds = 0.0;
+    double LastFrameSeconds = 0.0;
+    float AttackTimer = 0.f;
+
+    // Todos os frames (para percentis) e a janela corrente (para o CSV)
+    TArray<float> FrameMs;
+    TArray<float> GameThreadMs;
+    int32 WindowFrames = 0;
+    float WindowFrameMsSum = 0.f;
+    float WindowFrameMsMax = 0.f;
+    float WindowGameMsSum = 0.f;
+    double WindowStart = 0.0;
+
+    TArray<FWindowSample> Windows;
+    TArray<FString> StatColumns;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SoakTestSubsystem.generated.h"
+
+class USpawnTimeline;
+
+/**
+ * Soak test de longa duração para caçar vazamentos. Toca a timeline em loop infinito e
+ * acelerada, com o jogador invulnerável movido pelo bot do benchmark, e a cada intervalo
+ * força um GC e amostra: UObjects por classe, pausas de GC, tags LLM, pool e memória.
+ * Grava Saved/Soak/<Nome>.csv incrementalmente e, ao fim, <Nome>_report.json com as
+ * séries que cresceram de forma monotônica.
+ *
+ * Linha de comando (headless, sai ao terminar):
+ *   Vazio.uproject /Game/Levels/Battle_Main -game -nullrhi -unattended -fps=60 -llm
+ *     -HordeSoak [-SoakMinutes=30] [-SoakInterval=30] [-SoakSpeed=2] [-SoakTimeline=Enemy/TestWave.json] [-SoakName=Nome]
+ * Console: Vazio.Soak.Start [Minutos] [Intervalo] [Velocidade] / Vazio.Soak.Stop
+ */
+UCLASS()
+class VAZIO_API USoakTestSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Minutes <= 0 roda até Vazio.Soak.Stop
+    void StartSoak(float Minutes, float IntervalSeconds, float Speed, const FString& TimelinePath = FString(), const FString& RunName = FString());
+    void StopSoak();
+
+    bool IsRunning() const { return bRunning; }
+
+    static bool IsSoakCommandLine();
+
+private:
+    struct FSoakSample
+    {
+        double Time = 0.0;
+        int32 Loop = 0;
+        float UsedPhysicalMB = 0.f;
+        float UsedVirtualMB = 0.f;
+        int32 TotalObjects = 0;
+        int32 Actors = 0;
+        int32 Enemies = 0;
+        int32 PoolActive = 0;
+        int32 PoolPooled = 0;
+        int32 XPOrbs = 0;
+        int32 Projectiles = 0;
+        int32 GCCount = 0;
+        float GCMaxMs = 0.f;
+        float GCTotalMs = 0.f;
+        float AvgFrameMs = 0.f;
+        TMap<FName, float> LLMMB;
+        TMap<FName, int32> ClassCounts;
+    };
+
+    void RestartLoop();
+    void TakeSample();
+    void AppendCSV(const FSoakSample& Sample);
+    void WriteReport();
+
+    void HandlePreGC();
+    void HandlePostGC();
+
+    UPROPERTY()
+    TObjectPtr<USpawnTimeline> LoopTimeline;
+
+    bool bRunning = false;
+    bool bExitWhenDone = false;
+    bool bSamplePending = false;
+    float DurationSeconds = 0.f;
+    float Interval = 30.f;
+    float SpeedScale = 2.f;
+    float LoopLength = 60.f;
+    int32 LoopIndex = 0;
+    FString TimelineName;
+    FString Name;
+    FString CSVPath;
+
+    double StartWallSeconds = 0.0;
+    double LoopStartWorldSeconds = 0.0;
+    double NextSampleWallSeconds = 0.0;
+    float AttackTimer = 0.f;
+
+    // Acumulado desde a última amostra
+    int32 FramesSinceSample = 0;
+    double FrameSecondsSinceSample = 0.0;
+    int32 GCCount = 0;
+    int32 GCCountAtRequest = 0;
+    double GCStartSeconds = 0.0;
+    double GCMaxSeconds = 0.0;
+    double GCTotalSeconds = 0.0;
+
+    FDelegateHandle PreGCHandle;
+    FDelegateHandle PostGCHandle;
+
+    TArray<FSoakSample> Samples;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enemy/EnemyTypes.h"
+
+class USpawnTimeline;
+class UEnemyConfig;
+
+/** Parâmetros do modelo de abate usado pelo simulador de timeline. */
+struct VAZIO_API FTimelineSimSettings
+{
+    // Passo fixo da simulação (frames por segundo de jogo)
+    float TickRate = 60.f;
+
+    // Tempo simulado além do último evento da timeline
+    float ExtraSeconds = 60.f;
+
+    // Dano por segundo aplicado a cada alvo, crescendo linearmente por minuto (level ups)
+    float PlayerDPS = 80.f;
+    float DPSGrowthPerMinute = 0.25f;
+
+    // Quantos inimigos engajados o jogador atinge ao mesmo tempo (mais antigos primeiro)
+    int32 MaxTargets = 3;
+
+    // Distância percorrida por spawns lineares até entrar no alcance (LinearSpawnMinDistance do spawner)
+    float LinearApproachDistance = 200.f;
+
+    // Tempo médio até um orb ser coletado
+    float OrbPickupSeconds = 6.f;
+
+    // Folga aplicada aos picos na sugestão de tamanho de pool
+    float PoolHeadroom = 0.25f;
+
+    // >= 0: para nesse tempo e guarda o estado vivo no relatório (seek do spawner)
+    float StopAtSeconds = -1.f;
+
+    // Lê -DPS= -DPSGrowth= -Targets= -Approach= -OrbPickup= -TickRate= -Extra= -Headroom= -StopAt=
+    void ParseFromCommandLine(const TCHAR* Params);
+};
+
+struct VAZIO_API FTimelineSimTypeStats
+{
+    int32 Spawned = 0;
+    int32 Killed = 0;
+    int32 Alive = 0;
+    int32 PeakAlive = 0;
+    float PeakTime = 0.f;
+};
+
+struct VAZIO_API FTimelineSimBossStats
+{
+    FName Type;
+    float SpawnTime = 0.f;
+    float DefeatTime = -1.f;
+    int32 MinionsSummoned = 0;
+    int32 MinionsDenied = 0; // acima do orçamento de lacaios
+    int32 PeakMinions = 0;
+};
+
+// Inimigo vivo quando a simulação parou em StopAtSeconds
+struct VAZIO_API FTimelineSimLiveEnemy
+{
+    FName Type;
+    FEnemyInstanceModifiers Mods;
+    float HealthFraction = 1.f;
+    bool bSplitChild = false;
+    bool bBossMinion = false;
+};
+
+// Uma linha do CSV por segundo simulado
+struct VAZIO_API FTimelineSimSample
+{
+    float Time = 0.f;
+    int32 Enemies = 0;
+    int32 Orbs = 0;
+    int32 BossMinions = 0;
+    int32 Spawns = 0;
+    int32 MaxFrameSpawns = 0;
+    int32 DeferredQueue = 0;
+};
+
+struct VAZIO_API FTimelineSimReport
+{
+    FString TimelineName;
+    float SimulatedSeconds = 0.f;
+    int32 Frames = 0;
+
+    TMap<FName, FTimelineSimTypeStats> Types;
+    TArray<FTimelineSimBossStats> Bosses;
+    TArray<FTimelineSimSample> Samples;
+
+    int32 PeakEnemies = 0;
+    float PeakEnemiesTime = 0.f;
+
+    // Spawns executados num único frame (eventos + filhos de split + invocações)
+    int32 MaxFrameSpawns = 0;
+    float MaxFrameSpawnsTime = 0.f;
+    TArray<int32> FrameSpawnHistogram; // índice = spawns no frame, limitado a 64+
+    int32 SpawnBudget = 0;             // Enemy.DeferredSpawnBudget no momento da simulação
+    int32 FramesOverSpawnBudget = 0;
+    int32 MaxSplitChildren = 0;        // Enemy.MaxSplitChildren
+    int32 PeakSplitChildren = 0;
+    int32 PeakDeferredQueue = 0;
+    int32 DroppedSplitChildren = 0;
+
+    int32 TotalOrbs = 0;
+    int32 PeakOrbs = 0;
+    float PeakOrbsTime = 0.f;
+
+    int32 PeakBossMinions = 0;
+    int32 MaxBossMinions = -1;         // menor entre Enemy.Boss.MaxMinionsPerBoss e Enemy.Boss.MaxMinions (-1 = sem teto)
+    int32 DeniedBossMinions = 0;
+
+    // Estado em StopAtSeconds (só preenchido com StopAtSeconds >= 0). O boss ativo fica fora de LiveEnemies.
+    TArray<FTimelineSimLiveEnemy> LiveEnemies;
+    TArray<FSpawnEvent> HeldEvents;
+    bool bBossActive = false;
+    FBossSpawnEntry ActiveBossEntry;
+    float ActiveBossHealthFraction = 1.f;
+    float ResumeInSeconds = -1.f; // retomada de spawns pendente após um boss
+
+    TArray<FString> Warnings;
+};
+
+/**
+ * Simulador offline de USpawnTimeline: reproduz a timeline em passo fixo, sem mundo nem render,
+ * espelhando as regras do UEnemySpawnerSubsystem (eventos retidos durante o boss, retomada com
+ * atraso, fila de spawns adiados com orçamento por frame e teto de filhos de split) e o ciclo de
+ * ataque/invocação do ABossEnemy a partir dos CDOs. Os abates seguem um modelo simples de DPS por
+ * alvo com tempo de aproximação pela velocidade do arquétipo.
+ *
+ * O relatório (pico por arquétipo, spawns por frame, orbs, minions de boss e sugestão de pool)
+ * vai para Saved/Benchmarks/<Nome>.csv/.json.
+ *   Commandlet (VazioEditor): UnrealEditor-Cmd Vazio.uproject -run=TimelineSim -Timeline=Enemy/TestWave.json [-DPS=80 ...]
+ *   Console:                 Vazio.Timeline.Simulate Enemy/TestWave.json [-DPS=80 ...]
+ */
+class VAZIO_API FTimelineSimulator
+{
+public:
+    static bool Run(const USpawnTimeline& Timeline, const UEnemyConfig& Config, const FTimelineSimSettings& Settings, FTimelineSimReport& OutReport);
+
+    // Grava CSV + JSON e loga o resumo; retorna false se a escrita falhou
+    static bool WriteReport(const FTimelineSimReport& Report, const FTimelineSimSettings& Settings, const FString& Name);
+
+    // Carrega a timeline (relativa a Content/), roda com a config padrão de inimigos e grava o relatório
+    static bool RunFromFile(const FString& TimelinePath, const FTimelineSimSettings& Settings, const FString& Name = FString(), const UEnemyConfig* Config = nullptr);
+};
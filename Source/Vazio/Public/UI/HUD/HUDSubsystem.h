@@ -9,8 +9,12 @@ class UEnemySpawnerSubsystem;
 class ABossEnemy;
 struct FBossSpawnEntry;
 struct FBossPhaseDefinition;
-struct FBossAttackPattern;
 
+/**
+ * Barramento de dados do HUD: Update* e os eventos de boss só guardam o último valor e marcam sujo;
+ * um flush no pré-tick do Slate empurra no máximo uma atualização por widget por intervalo
+ * (Vazio.HUD.UpdateInterval, 0 = todo frame). Mostrar/esconder o boss e avisos não são adiados.
+ */
 UCLASS()
 class VAZIO_API UHUDSubsystem : public UGameInstanceSubsystem
 {
@@ -39,6 +43,26 @@ public:
     void UpdateLevel(int32 NewLevel);
 
 private:
+    // Estado pendente entre flushes
+    struct FPendingHUDState
+    {
+        float Health = 0.f;
+        float MaxHealth = 0.f;
+        int32 XP = 0;
+        int32 XPToNextLevel = 0;
+        int32 Level = 0;
+        float BossHealth = 0.f;
+        int32 BossPhaseIndex = INDEX_NONE;
+        bool bHealthDirty = false;
+        bool bXPDirty = false;
+        bool bLevelDirty = false;
+        bool bBossHealthDirty = false;
+        bool bBossPhaseDirty = false;
+    };
+
+    void HandleSlatePreTick(float DeltaTime);
+    void FlushPendingUpdates();
+
     void SetupDelegateBindings();
     void CleanupDelegateBindings();
 
@@ -50,11 +74,14 @@ private:
     void HandleBossHealthChanged(float NormalizedHealth, ABossEnemy* Boss);
     void HandleBossPhaseChanged(int32 PhaseIndex, const FBossPhaseDefinition& PhaseDefinition);
     void HandleBossWarning(const FBossSpawnEntry& Entry);
-    void HandleBossTelegraph(const FBossAttackPattern& Pattern);
 
     TSharedPtr<SHUDRoot> HUDWidget;
     bool bIsHUDVisible = false;
 
+    FPendingHUDState Pending;
+    double LastFlushSeconds = 0.0;
+    FDelegateHandle SlatePreTickHandle;
+
     TWeakObjectPtr<UEnemySpawnerSubsystem> ObservedSpawner;
 
     FDelegateHandle BossSpawnedHandle;
@@ -62,7 +89,6 @@ private:
     FDelegateHandle BossHealthHandle;
     FDelegateHandle BossPhaseHandle;
     FDelegateHandle BossWarningHandle;
-    FDelegateHandle BossTelegraphHandle;
 
     int32 CachedBossPhaseCount = 0;
     FText CachedBossName;
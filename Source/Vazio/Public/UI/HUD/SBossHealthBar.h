@@ -21,9 +21,11 @@ public:
     void SetBossVisible(bool bVisibleIn);
 
 private:
-    EVisibility GetWidgetVisibility() const;
     FText BuildPhaseLabel(int32 PhaseIndex, int32 PhaseCount) const;
 
+    // Barra completa com o boss vivo; só o aviso enquanto o boss está a caminho
+    void RefreshVisibility();
+
     float HealthPercent;
     FText CachedBossName;
     FText CachedPhaseLabel;
@@ -31,6 +33,7 @@ private:
     bool bVisible;
 
     TSharedPtr<SProgressBar> HealthProgress;
+    TSharedPtr<SWidget> BossInfo;
     TSharedPtr<STextBlock> NameLabel;
     TSharedPtr<STextBlock> PhaseLabel;
     TSharedPtr<STextBlock> WarningLabel;
@@ -7,6 +7,7 @@ class SHealthBar;
 class SXPBar;
 class SLevelText;
 class SBossHealthBar;
+class SPerfOverlay;
 
 class VAZIO_API SHUDRoot : public SCompoundWidget
 {
@@ -35,4 +36,5 @@ private:
     TSharedPtr<SXPBar> XPBar;
     TSharedPtr<SLevelText> LevelText;
     TSharedPtr<SBossHealthBar> BossHealthBar;
+    TSharedPtr<SPerfOverlay> PerfOverlay;
 };
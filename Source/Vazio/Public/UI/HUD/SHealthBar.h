@@ -20,11 +20,13 @@ private:
     // Health data
     float CurrentHealth = 100.0f;
     float MaxHealth = 100.0f;
-    
-    // Binding methods
-    TOptional<float> GetHealthPercent() const;
-    FSlateColor GetHealthColor() const;
-    FText GetHealthText() const;
 
-    void UpdateVisuals(float Current, float Max);
+    // Último texto/faixa de cor aplicados: dano fracionado que não muda o número não reformata
+    int32 DisplayedCurrent = INDEX_NONE;
+    int32 DisplayedMax = INDEX_NONE;
+    int32 DisplayedColorTier = INDEX_NONE;
+
+    static FLinearColor GetTierColor(int32 Tier);
+
+    void UpdateVisuals();
 };
@@ -15,7 +15,4 @@ public:
 private:
     TSharedPtr<class STextBlock> LevelTextBlock;
     int32 CurrentLevel = 1;
-    
-    // Text binding method
-    FText GetLevelText() const;
 };
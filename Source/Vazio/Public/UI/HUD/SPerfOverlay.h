@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+
+class STextBlock;
+class SFrameTimeGraph;
+
+/**
+ * Overlay de desenvolvimento com métricas da horda (Vazio.PerfOverlay 1).
+ * Atualiza o texto a poucos Hz via active timer, a partir de contadores já mantidos pelos
+ * subsistemas; fica dentro de um SInvalidationPanel, então entre atualizações não custa nada
+ * além do registro do frame time para o gráfico.
+ */
+class VAZIO_API SPerfOverlay : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SPerfOverlay) {}
+    SLATE_END_ARGS()
+
+    virtual ~SPerfOverlay() override;
+
+    void Construct(const FArguments& InArgs);
+
+private:
+    EActiveTimerReturnType Refresh(double InCurrentTime, float InDeltaTime);
+    void RegisterRefreshTimer();
+    void SetOverlayEnabled(bool bEnabled);
+    void HandleEndFrame();
+    FString BuildText(UWorld* World);
+
+    TSharedPtr<STextBlock> Text;
+    TSharedPtr<SFrameTimeGraph> Graph;
+
+    bool bEnabled = false;
+    bool bRequestedStats = false;
+    FDelegateHandle EndFrameHandle;
+    double LastFrameSeconds = 0.0;
+
+    // Vazio.PerfOverlay.Hz com que o active timer foi registrado; mudou, registra de novo
+    float RefreshHz = 0.f;
+
+    // Frames desde a última atualização do texto
+    int32 WindowFrames = 0;
+    float WindowFrameMsSum = 0.f;
+    float WindowFrameMsMax = 0.f;
+};
@@ -17,13 +17,9 @@ private:
     TSharedPtr<class SProgressBar> XPProgressBar;
     TSharedPtr<class STextBlock> XPText;
     
-    // XP data
+    // XP data (valores já aplicados aos widgets; só muda -> repinta)
     int32 CurrentXP = 0;
     int32 XPToNextLevel = 100;
-    
-    // Binding methods
-    TOptional<float> GetXPPercent() const;
-    FText GetXPText() const;
 
-    void UpdateVisuals(int32 Current, int32 Needed);
+    void UpdateVisuals();
 };
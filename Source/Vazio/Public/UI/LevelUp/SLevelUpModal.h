@@ -9,13 +9,20 @@ DECLARE_DELEGATE_OneParam(FOnUpgradeChosen, EUpgradeType);
 class VAZIO_API SLevelUpModal : public SCompoundWidget
 {
 public:
-    SLATE_BEGIN_ARGS(SLevelUpModal) {}
+    SLATE_BEGIN_ARGS(SLevelUpModal)
+        : _NumCards(3)
+    {}
         SLATE_EVENT(FOnUpgradeChosen, OnUpgradeChosen)
+        // Cards criados no Construct; SetupUpgrades só reatribui (cria mais apenas se faltar)
+        SLATE_ARGUMENT(int32, NumCards)
     SLATE_END_ARGS()
 
     void Construct(const FArguments& InArgs);
     void SetupUpgrades(const TArray<FUpgradeData>& Upgrades);
 
+    // Level-ups ainda na fila depois desta escolha (mostrado no subtítulo)
+    void SetRemainingChoices(int32 Remaining);
+
     // SWidget interface
     virtual bool SupportsKeyboardFocus() const override { return true; }
     virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
@@ -25,9 +32,13 @@ private:
     FOnUpgradeChosen OnUpgradeChosen;
     TArray<FUpgradeData> CurrentUpgrades;
     int32 SelectedIndex = 0;
+    int32 NumActiveCards = 0;
+    int32 RemainingChoices = INDEX_NONE;
     TArray<TSharedPtr<class SUpgradeCard>> UpgradeCards;
     TSharedPtr<class SHorizontalBox> CardsContainer;
+    TSharedPtr<class STextBlock> SubtitleText;
 
+    void AddCard();
     void SelectCard(int32 Index);
     void ConfirmSelection();
     void OnCardClicked(int32 CardIndex);
@@ -15,6 +15,9 @@ public:
     void Construct(const FArguments& InArgs);
     void SetSelected(bool bSelected);
 
+    // Reaproveita o card para outra opção (modal reutilizado entre level-ups)
+    void SetUpgrade(const FUpgradeData& Upgrade, int32 InCardIndex);
+
     // SWidget interface
     virtual bool SupportsKeyboardFocus() const override { return true; }
     virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
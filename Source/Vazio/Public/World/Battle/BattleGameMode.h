@@ -42,6 +42,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Config")
     TObjectPtr<class UEnemyConfig> DefaultEnemyConfig;
 
+    // Timeline importada (asset) usada por StartTestWave; vazia = Content/Enemy/TestWave (.vtl)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy Spawn")
+    TObjectPtr<class USpawnTimeline> TestWaveTimeline;
+
 private:
     // Cached assets resolved in constructor (legal place for FObjectFinder)
     UPROPERTY() class UStaticMesh* CachedCubeMesh = nullptr;
@@ -93,6 +93,10 @@ public:
 	void OnUpgradeChosen(EUpgradeType ChosenType);
 	void CloseLevelUpModal();
 
+	// Bots de benchmark/soak escolhem a primeira opção para o jogo não ficar pausado
+	bool IsLevelUpModalOpen() const { return bLevelUpModalOpen; }
+	const TArray<FUpgradeData>& GetPendingUpgradeChoices() const { return PendingUpgradeChoices; }
+
 	// Movement input functions
 	void MoveForward(float Value);
 	void MoveRight(float Value);
@@ -134,8 +138,13 @@ private:
 	bool bIsAttacking = false;
 	FTimerHandle AttackTimerHandle;
 	
-	// Level Up UI
-	TSharedPtr<SLevelUpModal> ActiveLevelUpModal;
+	// Level Up UI: widget criado uma vez no BeginPlay e só adicionado/removido do viewport
+	void CreateLevelUpModal();
+
+	TSharedPtr<SLevelUpModal> LevelUpModal;
+	bool bLevelUpModalOpen = false;
+	TArray<FUpgradeData> PendingUpgradeChoices;
+	int32 QueuedLevelUps = 0; // level-ups que chegaram com o modal aberto
 
 	// Network replication
 	UPROPERTY(ReplicatedUsing = OnRep_Health)
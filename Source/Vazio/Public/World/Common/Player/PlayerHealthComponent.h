@@ -36,6 +36,10 @@ public:
     void Heal(float Amount);
     void IncreaseMaxHealth(float Amount);
 
+    // Soak/benchmark: ignora todo dano recebido
+    void SetInvulnerable(bool bInInvulnerable) { bInvulnerable = bInInvulnerable; }
+    bool IsInvulnerable() const { return bInvulnerable; }
+
     // Native delegates (non-dynamic)
     FOnHealthChanged OnHealthChanged;
 
@@ -54,4 +58,6 @@ protected:
 
     UPROPERTY(VisibleAnywhere, Category="Health")
     float CurrentHealth = 0.f;
+
+    bool bInvulnerable = false;
 };
\ No newline at end of file
@@ -9,7 +9,7 @@ public class Vazio : ModuleRules
 
         PublicDependencyModuleNames.AddRange(new string[] {
             "Core","CoreUObject","Engine","InputCore","UMG","Slate","SlateCore","EnhancedInput","NavigationSystem",
-            "OnlineSubsystem", "OnlineSubsystemUtils", "Json"
+            "OnlineSubsystem", "OnlineSubsystemUtils", "Json", "JsonUtilities"
         });
 
         if (Target.Platform == UnrealTargetPlatform.Win64 || Target.Platform == UnrealTargetPlatform.Linux || Target.Platform == UnrealTargetPlatform.Mac)
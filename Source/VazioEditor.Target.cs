@@ -11,5 +11,6 @@ public class VazioEditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_6;
 		ExtraModuleNames.Add("Vazio");
+		ExtraModuleNames.Add("VazioEditor");
 	}
 }
@@ -0,0 +1,81 @@
+#include "CookSpawnTimelinesCommandlet.h"
+#include "SpawnTimelineFactory.h"
+#include "Enemy/SpawnTimeline.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCookSpawnTimelines, Log, All);
+
+UCookSpawnTimelinesCommandlet::UCookSpawnTimelinesCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UCookSpawnTimelinesCommandlet::Main(const FString& Params)
+{
+    TArray<FString> Files;
+    FString File;
+    if (FParse::Value(*Params, TEXT("File="), File))
+    {
+        Files.Add(FPaths::IsRelative(File) ? FPaths::Combine(FPaths::ProjectContentDir(), File) : File);
+    }
+    else
+    {
+        FString Dir = TEXT("Enemy");
+        FParse::Value(*Params, TEXT("Dir="), Dir);
+        const FString FullDir = FPaths::IsRelative(Dir) ? FPaths::Combine(FPaths::ProjectContentDir(), Dir) : Dir;
+        IFileManager::Get().FindFilesRecursive(Files, *FullDir, TEXT("*.json"), true, false);
+    }
+
+    int32 Cooked = 0;
+    int32 Failed = 0;
+    for (const FString& Path : Files)
+    {
+        FString JSON;
+        if (!FFileHelper::LoadFileToString(JSON, *Path))
+        {
+            UE_LOG(LogCookSpawnTimelines, Error, TEXT("Could not read %s"), *Path);
+            ++Failed;
+            continue;
+        }
+
+        // Outros JSON na pasta (configs, DataTables) não são timelines
+        if (!USpawnTimelineFactory::IsSpawnTimelineJSON(JSON))
+        {
+            continue;
+        }
+
+        USpawnTimeline* Timeline = NewObject<USpawnTimeline>(GetTransientPackage());
+        TArray<FString> Errors;
+        if (!USpawnTimelineFactory::ParseAndValidate(JSON, *Timeline, Errors))
+        {
+            for (const FString& Error : Errors)
+            {
+                UE_LOG(LogCookSpawnTimelines, Error, TEXT("%s: %s"), *Path, *Error);
+            }
+            ++Failed;
+            continue;
+        }
+
+        TArray<uint8> Bytes;
+        Timeline->SaveToBinary(Bytes);
+        const FString BinaryPath = FPaths::ChangeExtension(Path, USpawnTimeline::BinaryExtension);
+        if (!FFileHelper::SaveArrayToFile(Bytes, *BinaryPath))
+        {
+            UE_LOG(LogCookSpawnTimelines, Error, TEXT("Could not write %s"), *BinaryPath);
+            ++Failed;
+            continue;
+        }
+
+        UE_LOG(LogCookSpawnTimelines, Display, TEXT("%s -> %s (%d bytes, %d events, %d bosses)"),
+            *FPaths::GetCleanFilename(Path), *FPaths::GetCleanFilename(BinaryPath), Bytes.Num(), Timeline->Events.Num(), Timeline->BossEvents.Num());
+        ++Cooked;
+    }
+
+    UE_LOG(LogCookSpawnTimelines, Display, TEXT("Cooked %d timelines, %d failed"), Cooked, Failed);
+    return Failed > 0 ? 1 : 0;
+}
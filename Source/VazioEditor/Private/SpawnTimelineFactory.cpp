@@ -0,0 +1,137 @@
+#include "SpawnTimelineFactory.h"
+#include "Enemy/SpawnTimeline.h"
+#include "Enemy/EnemyConfig.h"
+#include "EditorFramework/AssetImportData.h"
+#include "Editor.h"
+#include "Subsystems/ImportSubsystem.h"
+#include "Misc/FileHelper.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpawnTimelineImport, Log, All);
+
+USpawnTimelineFactory::USpawnTimelineFactory()
+{
+    SupportedClass = USpawnTimeline::StaticClass();
+    bCreateNew = false;
+    bEditorImport = true;
+    bText = true;
+    Formats.Add(TEXT("json;Spawn Timeline"));
+
+    // Acima das fábricas genéricas de JSON (DataTable/CurveTable); FactoryCanImport filtra o resto
+    ImportPriority = DefaultImportPriority + 10;
+}
+
+bool USpawnTimelineFactory::IsSpawnTimelineJSON(const FString& JSON)
+{
+    return JSON.Contains(TEXT("\"spawnEvents\"")) || JSON.Contains(TEXT("\"bosses\""));
+}
+
+bool USpawnTimelineFactory::ParseAndValidate(const FString& JSON, USpawnTimeline& OutTimeline, TArray<FString>& OutErrors)
+{
+    if (!OutTimeline.ParseFromJSON(JSON, &OutErrors))
+    {
+        return false;
+    }
+
+    // Mesma config que o spawner cria quando o mapa não atribui uma
+    const UEnemyConfig* Config = UEnemyConfig::CreateDefaultConfig();
+    return OutTimeline.Validate(Config, OutErrors);
+}
+
+bool USpawnTimelineFactory::FactoryCanImport(const FString& Filename)
+{
+    FString JSON;
+    return FFileHelper::LoadFileToString(JSON, *Filename) && IsSpawnTimelineJSON(JSON);
+}
+
+UObject* USpawnTimelineFactory::FactoryCreateText(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, UObject* Context,
+                                                  const TCHAR* Type, const TCHAR*& Buffer, const TCHAR* BufferEnd, FFeedbackContext* Warn)
+{
+    UImportSubsystem* ImportSubsystem = GEditor->GetEditorSubsystem<UImportSubsystem>();
+    ImportSubsystem->BroadcastAssetPreImport(this, InClass, InParent, InName, Type);
+
+    // Parse num objeto transitório: se falhar, um asset existente com o mesmo nome não é tocado
+    const FString JSON = FString::ConstructFromPtrSize(Buffer, BufferEnd - Buffer);
+    USpawnTimeline* Parsed = NewObject<USpawnTimeline>(GetTransientPackage());
+    TArray<FString> Errors;
+    if (!ParseAndValidate(JSON, *Parsed, Errors))
+    {
+        for (const FString& Error : Errors)
+        {
+            Warn->Logf(ELogVerbosity::Error, TEXT("%s: %s"), *CurrentFilename, *Error);
+        }
+        ImportSubsystem->BroadcastAssetPostImport(this, nullptr);
+        return nullptr;
+    }
+
+    USpawnTimeline* Timeline = NewObject<USpawnTimeline>(InParent, InClass, InName, Flags | RF_Transactional);
+    Timeline->Events = MoveTemp(Parsed->Events);
+    Timeline->BossEvents = MoveTemp(Parsed->BossEvents);
+    Timeline->AssetImportData->Update(CurrentFilename);
+
+    ImportSubsystem->BroadcastAssetPostImport(this, Timeline);
+    return Timeline;
+}
+
+bool USpawnTimelineFactory::CanReimport(UObject* Obj, TArray<FString>& OutFilenames)
+{
+    const USpawnTimeline* Timeline = Cast<USpawnTimeline>(Obj);
+    if (Timeline && Timeline->AssetImportData)
+    {
+        Timeline->AssetImportData->ExtractFilenames(OutFilenames);
+        return true;
+    }
+    return false;
+}
+
+void USpawnTimelineFactory::SetReimportPaths(UObject* Obj, const TArray<FString>& NewReimportPaths)
+{
+    USpawnTimeline* Timeline = Cast<USpawnTimeline>(Obj);
+    if (Timeline && Timeline->AssetImportData && ensure(NewReimportPaths.Num() == 1))
+    {
+        Timeline->AssetImportData->UpdateFilenameOnly(NewReimportPaths[0]);
+    }
+}
+
+EReimportResult::Type USpawnTimelineFactory::Reimport(UObject* Obj)
+{
+    USpawnTimeline* Timeline = Cast<USpawnTimeline>(Obj);
+    if (!Timeline || !Timeline->AssetImportData)
+    {
+        return EReimportResult::Failed;
+    }
+
+    const FString Filename = Timeline->AssetImportData->GetFirstFilename();
+    FString JSON;
+    if (Filename.IsEmpty() || !FFileHelper::LoadFileToString(JSON, *Filename))
+    {
+        UE_LOG(LogSpawnTimelineImport, Error, TEXT("Reimport: could not read %s"), *Filename);
+        return EReimportResult::Failed;
+    }
+
+    USpawnTimeline* Parsed = NewObject<USpawnTimeline>(GetTransientPackage());
+    TArray<FString> Errors;
+    if (!ParseAndValidate(JSON, *Parsed, Errors))
+    {
+        for (const FString& Error : Errors)
+        {
+            UE_LOG(LogSpawnTimelineImport, Error, TEXT("%s: %s"), *Filename, *Error);
+        }
+        return EReimportResult::Failed;
+    }
+
+    Timeline->Modify();
+    Timeline->Events = MoveTemp(Parsed->Events);
+    Timeline->BossEvents = MoveTemp(Parsed->BossEvents);
+    Timeline->AssetImportData->Update(Filename);
+    Timeline->PostEditChange();
+    Timeline->MarkPackageDirty();
+
+    UE_LOG(LogSpawnTimelineImport, Log, TEXT("Reimported %s (%d events, %d bosses)"),
+        *Timeline->GetName(), Timeline->Events.Num(), Timeline->BossEvents.Num());
+    return EReimportResult::Succeeded;
+}
+
+int32 USpawnTimelineFactory::GetPriority() const
+{
+    return ImportPriority;
+}
@@ -0,0 +1,37 @@
+#include "TimelineSimCommandlet.h"
+#include "Testing/TimelineSimulator.h"
+#include "Enemy/EnemyConfig.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTimelineSimCommandlet, Log, All);
+
+UTimelineSimCommandlet::UTimelineSimCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UTimelineSimCommandlet::Main(const FString& Params)
+{
+    FString TimelinePath;
+    FString Name;
+    FString ConfigPath;
+    FParse::Value(*Params, TEXT("Timeline="), TimelinePath);
+    FParse::Value(*Params, TEXT("Name="), Name);
+
+    const UEnemyConfig* Config = nullptr;
+    if (FParse::Value(*Params, TEXT("EnemyConfig="), ConfigPath))
+    {
+        Config = LoadObject<UEnemyConfig>(nullptr, *ConfigPath);
+        if (!Config)
+        {
+            UE_LOG(LogTimelineSimCommandlet, Error, TEXT("EnemyConfig não encontrada: %s"), *ConfigPath);
+            return 1;
+        }
+    }
+
+    FTimelineSimSettings Settings;
+    Settings.ParseFromCommandLine(*Params);
+    return FTimelineSimulator::RunFromFile(TimelinePath, Settings, Name, Config) ? 0 : 1;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CookSpawnTimelinesCommandlet.generated.h"
+
+/**
+ * -run=CookSpawnTimelines [-Dir=Enemy] [-File=Enemy/TestWave.json]
+ * Valida cada timeline JSON sob Content/<Dir> e grava o .vtl binário ao lado (lido por
+ * UEnemySpawnHelper::LoadTimelineFile). Retorna 1 se alguma timeline tiver erros.
+ */
+UCLASS()
+class VAZIOEDITOR_API UCookSpawnTimelinesCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UCookSpawnTimelinesCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Factories/Factory.h"
+#include "EditorReimportHandler.h"
+#include "SpawnTimelineFactory.generated.h"
+
+class USpawnTimeline;
+
+/**
+ * Importa timelines JSON (Content/Enemy/*.json) como assets USpawnTimeline. A timeline é validada
+ * na importação contra a EnemyConfig padrão: JSON malformado ou tipo desconhecido não gera asset.
+ * O reimport relê o arquivo guardado em AssetImportData e mantém o asset antigo se falhar.
+ */
+UCLASS()
+class VAZIOEDITOR_API USpawnTimelineFactory : public UFactory, public FReimportHandler
+{
+    GENERATED_BODY()
+
+public:
+    USpawnTimelineFactory();
+
+    virtual bool FactoryCanImport(const FString& Filename) override;
+    virtual UObject* FactoryCreateText(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, UObject* Context,
+                                       const TCHAR* Type, const TCHAR*& Buffer, const TCHAR* BufferEnd, FFeedbackContext* Warn) override;
+
+    virtual bool CanReimport(UObject* Obj, TArray<FString>& OutFilenames) override;
+    virtual void SetReimportPaths(UObject* Obj, const TArray<FString>& NewReimportPaths) override;
+    virtual EReimportResult::Type Reimport(UObject* Obj) override;
+    virtual int32 GetPriority() const override;
+
+    // Diferencia timelines de outros JSON (DataTables, configs) pelos campos da raiz
+    static bool IsSpawnTimelineJSON(const FString& JSON);
+
+    // Parse + validação usados pela importação e pelo commandlet de cook
+    static bool ParseAndValidate(const FString& JSON, USpawnTimeline& OutTimeline, TArray<FString>& OutErrors);
+};
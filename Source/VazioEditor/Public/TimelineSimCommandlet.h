@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TimelineSimCommandlet.generated.h"
+
+/**
+ * -run=TimelineSim -Timeline=Enemy/TestWave.json [-Name=] [-EnemyConfig=/Game/...] + parâmetros do
+ * modelo de abate (ver FTimelineSimSettings). Sem -Timeline simula GetExampleJSON().
+ */
+UCLASS()
+class VAZIOEDITOR_API UTimelineSimCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UTimelineSimCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,13 @@
+using UnrealBuildTool;
+
+public class VazioEditor : ModuleRules
+{
+    public VazioEditor(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(new string[] {
+            "Core","CoreUObject","Engine","UnrealEd","Vazio"
+        });
+    }
+}